@@ -108,6 +108,10 @@ UnhandledEngine::handleCharacter(UChar32 c) {
 
 ICULanguageBreakFactory::ICULanguageBreakFactory(UErrorCode &/*status*/) {
     fEngines = 0;
+    for (int32_t i = 0; i < kSlotCount; ++i) {
+        fScriptEngines[i] = NULL;
+        umtx_storeRelease(fScriptStates[i], kSlotUnknown);
+    }
 }
 
 ICULanguageBreakFactory::~ICULanguageBreakFactory() {
@@ -126,11 +130,50 @@ U_NAMESPACE_BEGIN
 
 static UMutex gBreakEngineMutex = U_MUTEX_INITIALIZER;
 
+int32_t
+ICULanguageBreakFactory::getScriptSlot(UScriptCode script) {
+    switch (script) {
+    case USCRIPT_THAI:
+        return 0;
+    case USCRIPT_LAO:
+        return 1;
+    case USCRIPT_MYANMAR:
+        return 2;
+    case USCRIPT_KHMER:
+        return 3;
+    case USCRIPT_HANGUL:
+        return 4;
+    // Chinese and Japanese share one engine.
+    case USCRIPT_HAN:
+    case USCRIPT_HIRAGANA:
+    case USCRIPT_KATAKANA:
+        return 5;
+    default:
+        return -1;
+    }
+}
+
 const LanguageBreakEngine *
 ICULanguageBreakFactory::getEngineFor(UChar32 c) {
     const LanguageBreakEngine *lbe = NULL;
     UErrorCode  status = U_ZERO_ERROR;
 
+    // Fast path: Once the engine for a dictionary script has been created,
+    // or it is known that there is none, the lookup does not take the lock.
+    int32_t slot = getScriptSlot(uscript_getScript(c, &status));
+    if (slot >= 0) {
+        int32_t state = umtx_loadAcquire(fScriptStates[slot]);
+        if (state == kSlotNoEngine) {
+            return NULL;
+        } else if (state == kSlotHasEngine) {
+            lbe = fScriptEngines[slot];
+            if (lbe->handles(c)) {
+                return lbe;
+            }
+            lbe = NULL;
+        }
+    }
+
     Mutex m(&gBreakEngineMutex);
 
     if (fEngines == NULL) {
@@ -146,75 +189,50 @@ ICULanguageBreakFactory::getEngineFor(UChar32 c) {
         while (--i >= 0) {
             lbe = (const LanguageBreakEngine *)(fEngines->elementAt(i));
             if (lbe != NULL && lbe->handles(c)) {
+                publishEngine(slot, lbe);
                 return lbe;
             }
         }
     }
     
     // We didn't find an engine. Create one.
-    lbe = loadEngineFor(c);
+    UErrorCode loadStatus = U_ZERO_ERROR;
+    lbe = loadEngineFor(c, loadStatus);
     if (lbe != NULL) {
         fEngines->push((void *)lbe, status);
+        if (U_SUCCESS(status) && lbe->handles(c)) {
+            publishEngine(slot, lbe);
+        }
+    } else if (slot >= 0 && U_SUCCESS(loadStatus) &&
+               umtx_loadAcquire(fScriptStates[slot]) == kSlotUnknown) {
+        // Remember that there is no engine for this script, but not a failure
+        // (like out of memory) which might not happen next time.
+        umtx_storeRelease(fScriptStates[slot], kSlotNoEngine);
     }
     return lbe;
 }
 
+// Must be called with gBreakEngineMutex held.
+// The engine must be owned by fEngines so that it lives as long as this factory.
+void
+ICULanguageBreakFactory::publishEngine(int32_t slot, const LanguageBreakEngine *engine) {
+    if (slot >= 0 && umtx_loadAcquire(fScriptStates[slot]) == kSlotUnknown) {
+        fScriptEngines[slot] = engine;
+        umtx_storeRelease(fScriptStates[slot], kSlotHasEngine);
+    }
+}
+
 const LanguageBreakEngine *
-ICULanguageBreakFactory::loadEngineFor(UChar32 c) {
-    UErrorCode status = U_ZERO_ERROR;
+ICULanguageBreakFactory::loadEngineFor(UChar32 c, UErrorCode &status) {
+    if (U_FAILURE(status)) {
+        return NULL;
+    }
     UScriptCode code = uscript_getScript(c, &status);
     if (U_SUCCESS(status)) {
-        DictionaryMatcher *m = loadDictionaryMatcherFor(code);
+        DictionaryMatcher *m = loadDictionaryMatcherFor(code, status);
         if (m != NULL) {
-            const LanguageBreakEngine *engine = NULL;
-            switch(code) {
-            case USCRIPT_THAI:
-                engine = new ThaiBreakEngine(m, status);
-                break;
-            case USCRIPT_LAO:
-                engine = new LaoBreakEngine(m, status);
-                break;
-            case USCRIPT_MYANMAR:
-                engine = new BurmeseBreakEngine(m, status);
-                break;
-            case USCRIPT_KHMER:
-                engine = new KhmerBreakEngine(m, status);
-                break;
-
-#if !UCONFIG_NO_NORMALIZATION
-                // CJK not available w/o normalization
-            case USCRIPT_HANGUL:
-                engine = new CjkBreakEngine(m, kKorean, status);
-                break;
-
-            // use same BreakEngine and dictionary for both Chinese and Japanese
-            case USCRIPT_HIRAGANA:
-            case USCRIPT_KATAKANA:
-            case USCRIPT_HAN:
-                engine = new CjkBreakEngine(m, kChineseJapanese, status);
-                break;
-#if 0
-            // TODO: Have to get some characters with script=common handled
-            // by CjkBreakEngine (e.g. U+309B). Simply subjecting
-            // them to CjkBreakEngine does not work. The engine has to
-            // special-case them.
-            case USCRIPT_COMMON:
-            {
-                UBlockCode block = ublock_getCode(code);
-                if (block == UBLOCK_HIRAGANA || block == UBLOCK_KATAKANA)
-                   engine = new CjkBreakEngine(dict, kChineseJapanese, status);
-                break;
-            }
-#endif
-#endif
-
-            default:
-                break;
-            }
-            if (engine == NULL) {
-                delete m;
-            }
-            else if (U_FAILURE(status)) {
+            const LanguageBreakEngine *engine = createEngineFor(code, m, status);
+            if (U_FAILURE(status)) {
                 delete engine;
                 engine = NULL;
             }
@@ -224,9 +242,116 @@ ICULanguageBreakFactory::loadEngineFor(UChar32 c) {
     return NULL;
 }
 
+const LanguageBreakEngine *
+ICULanguageBreakFactory::createEngineFor(UScriptCode script, DictionaryMatcher *adoptDictionary,
+                                         UErrorCode &status) {
+    DictionaryMatcher *m = adoptDictionary;
+    const LanguageBreakEngine *engine = NULL;
+    switch(script) {
+    case USCRIPT_THAI:
+        engine = new ThaiBreakEngine(m, status);
+        break;
+    case USCRIPT_LAO:
+        engine = new LaoBreakEngine(m, status);
+        break;
+    case USCRIPT_MYANMAR:
+        engine = new BurmeseBreakEngine(m, status);
+        break;
+    case USCRIPT_KHMER:
+        engine = new KhmerBreakEngine(m, status);
+        break;
+
+#if !UCONFIG_NO_NORMALIZATION
+        // CJK not available w/o normalization
+    case USCRIPT_HANGUL:
+        engine = new CjkBreakEngine(m, kKorean, status);
+        break;
+
+    // use same BreakEngine and dictionary for both Chinese and Japanese
+    case USCRIPT_HIRAGANA:
+    case USCRIPT_KATAKANA:
+    case USCRIPT_HAN:
+        engine = new CjkBreakEngine(m, kChineseJapanese, status);
+        break;
+#if 0
+    // TODO: Have to get some characters with script=common handled
+    // by CjkBreakEngine (e.g. U+309B). Simply subjecting
+    // them to CjkBreakEngine does not work. The engine has to
+    // special-case them.
+    case USCRIPT_COMMON:
+    {
+        UBlockCode block = ublock_getCode(code);
+        if (block == UBLOCK_HIRAGANA || block == UBLOCK_KATAKANA)
+           engine = new CjkBreakEngine(dict, kChineseJapanese, status);
+        break;
+    }
+#endif
+#endif
+
+    default:
+        break;
+    }
+    if (engine == NULL) {
+        delete m;
+    }
+    return engine;
+}
+
+const LanguageBreakEngine *
+ICULanguageBreakFactory::createCustomDictionaryEngine(UScriptCode script,
+                                                      const void *data, int32_t length,
+                                                      UErrorCode &status) {
+    if (U_FAILURE(status)) {
+        return NULL;
+    }
+    DictionaryMatcher *custom = DictionaryMatcher::openFromMemory(data, length, status);
+    if (U_FAILURE(status)) {
+        return NULL;
+    }
+    // The built-in dictionary is loaded separately from the one in the shared
+    // engines so that this engine does not depend on the factory's lifetime.
+    // udata_open() maps the same data without copying it.
+    // Use a separate status so that resource fallback warnings do not reach the caller.
+    UErrorCode builtInStatus = U_ZERO_ERROR;
+    DictionaryMatcher *builtIn = loadBuiltInDictionaryMatcherFor(script, builtInStatus);
+    if (U_FAILURE(builtInStatus)) {
+        delete custom;
+        status = builtInStatus;
+        return NULL;
+    }
+    DictionaryMatcher *m = new LayeredDictionaryMatcher(custom, builtIn);
+    if (m == NULL) {
+        delete custom;
+        delete builtIn;
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return NULL;
+    }
+    // The engine may load other data with fallback and set U_USING_DEFAULT_WARNING,
+    // which is not meaningful to the caller.
+    UErrorCode engineStatus = U_ZERO_ERROR;
+    const LanguageBreakEngine *engine = createEngineFor(script, m, engineStatus);
+    if (U_FAILURE(engineStatus)) {
+        status = engineStatus;
+        delete engine;
+        return NULL;
+    }
+    if (engine == NULL) {
+        // The matcher was deleted: No engine handles this script.
+        status = U_UNSUPPORTED_ERROR;
+    }
+    return engine;
+}
+
+DictionaryMatcher *
+ICULanguageBreakFactory::loadDictionaryMatcherFor(UScriptCode script, UErrorCode &status) {
+    return loadBuiltInDictionaryMatcherFor(script, status);
+}
+
 DictionaryMatcher *
-ICULanguageBreakFactory::loadDictionaryMatcherFor(UScriptCode script) { 
-    UErrorCode status = U_ZERO_ERROR;
+ICULanguageBreakFactory::loadBuiltInDictionaryMatcherFor(UScriptCode script, UErrorCode &status) {
+    if (U_FAILURE(status)) {
+        return NULL;
+    }
     // open root from brkitr tree.
     UResourceBundle *b = ures_open(U_ICUDATA_BRKITR, "", &status);
     b = ures_getByKeyWithFallback(b, "dictionaries", b, &status);
@@ -235,6 +360,10 @@ ICULanguageBreakFactory::loadDictionaryMatcherFor(UScriptCode script) {
         ures_getStringByKeyWithFallback(b, uscript_getShortName(script), &dictnlength, &status);
     if (U_FAILURE(status)) {
         ures_close(b);
+        if (status == U_MISSING_RESOURCE_ERROR) {
+            // no dictionary for this script
+            status = U_ZERO_ERROR;
+        }
         return NULL;
     }
     CharString dictnbuf;
@@ -269,17 +398,26 @@ ICULanguageBreakFactory::loadDictionaryMatcherFor(UScriptCode script) {
             // no matcher exists to take ownership - either we are an invalid 
             // type or memory allocation failed
             udata_close(file);
+            if (trieType == DictionaryData::TRIE_TYPE_BYTES || trieType == DictionaryData::TRIE_TYPE_UCHARS) {
+                status = U_MEMORY_ALLOCATION_ERROR;
+            }
         }
         return m;
     } else if (dictfname != NULL) {
         // we don't have a dictionary matcher.
         // returning NULL here will cause us to fail to find a dictionary break engine, as expected
-        status = U_ZERO_ERROR;
+        if (status != U_MEMORY_ALLOCATION_ERROR) {
+            status = U_ZERO_ERROR;
+        }
         return NULL;
     }
     return NULL;
 }
 
+SharedBreakEngine::~SharedBreakEngine() {
+    delete fEngine;
+}
+
 U_NAMESPACE_END
 
 #endif /* #if !UCONFIG_NO_BREAK_ITERATION */
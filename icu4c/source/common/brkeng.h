@@ -14,6 +14,8 @@
 #include "unicode/uobject.h"
 #include "unicode/utext.h"
 #include "unicode/uscript.h"
+#include "sharedobject.h"
+#include "umutex.h"
 
 U_NAMESPACE_BEGIN
 
@@ -100,7 +102,7 @@ class LanguageBreakEngine : public UMemory {
  * not be deleted until the LanguageBreakEngines it has returned are no
  * longer needed.</p>
  */
-class LanguageBreakFactory : public UMemory {
+class U_COMMON_API LanguageBreakFactory : public UMemory {
  public:
 
   /**
@@ -210,7 +212,7 @@ class UnhandledEngine : public LanguageBreakEngine {
  * ICU. It creates dictionary-based LanguageBreakEngines from dictionary
  * data in the ICU data file.</p>
  */
-class ICULanguageBreakFactory : public LanguageBreakFactory {
+class U_COMMON_API ICULanguageBreakFactory : public LanguageBreakFactory {
  private:
 
     /**
@@ -220,6 +222,26 @@ class ICULanguageBreakFactory : public LanguageBreakFactory {
 
   UStack    *fEngines;
 
+    /**
+     * Engines published for lock-free lookup, one slot per dictionary script,
+     * see getScriptSlot(). A slot's state is set with release semantics after
+     * its engine pointer has been written, and is never changed again.
+     * kSlotNoEngine is set only when there is no engine for the script,
+     * not when loading one failed.
+     * @internal
+     */
+  enum {
+      kSlotUnknown,
+      kSlotNoEngine,
+      kSlotHasEngine,
+      kSlotCount = 6
+  };
+  const LanguageBreakEngine *fScriptEngines[kSlotCount];
+  u_atomic_int32_t fScriptStates[kSlotCount];
+
+  static int32_t getScriptSlot(UScriptCode script);
+  void publishEngine(int32_t slot, const LanguageBreakEngine *engine);
+
  public:
 
   /**
@@ -237,7 +259,9 @@ class ICULanguageBreakFactory : public LanguageBreakFactory {
   * <p>Find and return a LanguageBreakEngine that can find the desired
   * kind of break for the set of characters to which the supplied
   * character belongs. It is up to the set of available engines to
-  * determine what the sets of characters are.</p>
+  * determine what the sets of characters are.
+  * After the first lookup for a dictionary script, its engine is found
+  * without taking a lock.</p>
   *
   * @param c A character that begins a run for which a LanguageBreakEngine is
   * sought.
@@ -252,17 +276,62 @@ protected:
   *
   * @param c A character that begins a run for which a LanguageBreakEngine is
   * sought.
+  * @param status Set to a failure code if an engine could not be created
+  * for another reason than that there is none for the script (for example,
+  * out of memory). Then a later call may succeed.
   * @return A LanguageBreakEngine with the desired characteristics, or 0.
   */
-  virtual const LanguageBreakEngine *loadEngineFor(UChar32 c);
+  virtual const LanguageBreakEngine *loadEngineFor(UChar32 c, UErrorCode &status);
 
   /**
    * <p>Create a DictionaryMatcher for the specified script and break type.</p>
    * @param script An ISO 15924 script code that identifies the dictionary to be
    * created.
+   * @param status Set to a failure code if the dictionary could not be loaded
+   * for another reason than that there is none for the script.
    * @return A DictionaryMatcher with the desired characteristics, or NULL.
    */
-  virtual DictionaryMatcher *loadDictionaryMatcherFor(UScriptCode script);
+  virtual DictionaryMatcher *loadDictionaryMatcherFor(UScriptCode script, UErrorCode &status);
+
+public:
+  /**
+   * <p>Create a LanguageBreakEngine for a script whose dictionary is the
+   * custom dictionary in the data layered over the built-in one, if any.
+   * The data is in the .dict format and is aliased, not copied.</p>
+   * @param script the script; Hiragana and Katakana map to the Han engine
+   * @param data custom dictionary data, see DictionaryMatcher::openFromMemory()
+   * @param length length of the data in bytes
+   * @param status Set to U_UNSUPPORTED_ERROR if there is no dictionary-based
+   * break engine for the script.
+   * @return A new LanguageBreakEngine owned by the caller, or NULL.
+   */
+  static const LanguageBreakEngine *createCustomDictionaryEngine(UScriptCode script,
+                                                                 const void *data, int32_t length,
+                                                                 UErrorCode &status);
+
+private:
+  static const LanguageBreakEngine *createEngineFor(UScriptCode script,
+                                                    DictionaryMatcher *adoptDictionary,
+                                                    UErrorCode &status);
+  static DictionaryMatcher *loadBuiltInDictionaryMatcherFor(UScriptCode script, UErrorCode &status);
+};
+
+/**
+ * <p>SharedBreakEngine owns a LanguageBreakEngine that is shared by reference
+ * counting, for example by a break iterator and its clones.</p>
+ */
+class SharedBreakEngine : public SharedObject {
+ public:
+  SharedBreakEngine(UScriptCode script, const LanguageBreakEngine *adoptEngine)
+          : fScript(script), fEngine(adoptEngine) {}
+  virtual ~SharedBreakEngine();
+
+  UScriptCode getScript() const { return fScript; }
+  const LanguageBreakEngine *getEngine() const { return fEngine; }
+
+ private:
+  UScriptCode fScript;
+  const LanguageBreakEngine *fEngine;
 };
 
 U_NAMESPACE_END
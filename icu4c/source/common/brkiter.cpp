@@ -39,6 +39,8 @@
 #include "uassert.h"
 #include "ubrkimpl.h"
 #include "charstr.h"
+#include "sharedobject.h"
+#include "unifiedcache.h"
 
 // *****************************************************************************
 // class BreakIterator
@@ -398,10 +400,110 @@ BreakIterator::createInstance(const Locale& loc, int32_t kind, UErrorCode& statu
 }
 
 // -------------------------------------
-enum { kKeyValueLenMax = 32 };
+//
+// Break iterators are made by cloning a prototype for the locale and kind.
+// The prototypes are kept in the UnifiedCache. Their clones share the rule data
+// with the prototype, so that the resource bundles are opened and the rules
+// are loaded only once per locale and kind.
+
+class SharedBreakIteratorPrototype : public SharedObject {
+public:
+    SharedBreakIteratorPrototype(BreakIterator *biToAdopt) : ptr(biToAdopt) {}
+    virtual ~SharedBreakIteratorPrototype();
+    const BreakIterator *get() const { return ptr; }
+private:
+    BreakIterator *ptr;
+    SharedBreakIteratorPrototype(const SharedBreakIteratorPrototype &);
+    SharedBreakIteratorPrototype &operator=(const SharedBreakIteratorPrototype &);
+};
+
+SharedBreakIteratorPrototype::~SharedBreakIteratorPrototype() {
+    delete ptr;
+}
+
+template<> U_COMMON_API
+const SharedBreakIteratorPrototype *LocaleCacheKey<SharedBreakIteratorPrototype>::createObject(
+        const void * /*creationContext*/, UErrorCode &status) const {
+    status = U_UNSUPPORTED_ERROR;
+    return NULL;
+}
+
+class BreakIteratorCacheKey : public LocaleCacheKey<SharedBreakIteratorPrototype> {
+private:
+    int32_t fKind;
+public:
+    BreakIteratorCacheKey(const Locale &loc, int32_t kind)
+            : LocaleCacheKey<SharedBreakIteratorPrototype>(loc), fKind(kind) { }
+    BreakIteratorCacheKey(const BreakIteratorCacheKey &other)
+            : LocaleCacheKey<SharedBreakIteratorPrototype>(other), fKind(other.fKind) { }
+    virtual ~BreakIteratorCacheKey();
+    virtual int32_t hashCode() const {
+        return (int32_t)(37u * (uint32_t)LocaleCacheKey<SharedBreakIteratorPrototype>::hashCode() +
+                         (uint32_t)fKind);
+    }
+    virtual UBool operator==(const CacheKeyBase &other) const {
+        // reflexive
+        if (this == &other) {
+            return TRUE;
+        }
+        if (!LocaleCacheKey<SharedBreakIteratorPrototype>::operator==(other)) {
+            return FALSE;
+        }
+        // We know that this and other are of same class if we get this far.
+        const BreakIteratorCacheKey &realOther =
+                static_cast<const BreakIteratorCacheKey &>(other);
+        return realOther.fKind == fKind;
+    }
+    virtual CacheKeyBase *clone() const {
+        return new BreakIteratorCacheKey(*this);
+    }
+    virtual const SharedBreakIteratorPrototype *createObject(
+            const void * /*unused*/, UErrorCode &status) const {
+        LocalPointer<BreakIterator> bi(BreakIterator::makePrototype(fLoc, fKind, status));
+        if (U_FAILURE(status)) {
+            return NULL;
+        }
+        LocalPointer<SharedBreakIteratorPrototype> result(
+                new SharedBreakIteratorPrototype(bi.getAlias()), status);
+        if (U_FAILURE(status)) {
+            return NULL;
+        }
+        bi.orphan();
+        result->addRef();
+        return result.orphan();
+    }
+};
+
+BreakIteratorCacheKey::~BreakIteratorCacheKey() { }
 
 BreakIterator*
 BreakIterator::makeInstance(const Locale& loc, int32_t kind, UErrorCode& status)
+{
+    if (U_FAILURE(status)) {
+        return NULL;
+    }
+    const UnifiedCache *cache = UnifiedCache::getInstance(status);
+    if (U_FAILURE(status)) {
+        return NULL;
+    }
+    const SharedBreakIteratorPrototype *prototype = NULL;
+    cache->get(BreakIteratorCacheKey(loc, kind), prototype, status);
+    if (U_FAILURE(status)) {
+        return NULL;
+    }
+    BreakIterator *result = prototype->get()->clone();
+    prototype->removeRef();
+    if (result == NULL) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+    }
+    return result;
+}
+
+// -------------------------------------
+enum { kKeyValueLenMax = 32 };
+
+BreakIterator*
+BreakIterator::makePrototype(const Locale& loc, int32_t kind, UErrorCode& status)
 {
 
     if (U_FAILURE(status)) {
@@ -496,6 +598,29 @@ int32_t BreakIterator::getRuleStatusVec(int32_t *fillInVec, int32_t capacity, UE
     return 1;
 }
 
+// Default implementation of getBoundaries(), iterates with first() and next().
+// Subclasses may override it with something faster.
+int32_t BreakIterator::getBoundaries(int32_t *fillInVec, int32_t capacity, UErrorCode &status) {
+    if (U_FAILURE(status)) {
+        return 0;
+    }
+    if (capacity < 0 || (fillInVec == NULL && capacity > 0)) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    int32_t count = 0;
+    for (int32_t n = first(); n != UBRK_DONE; n = next()) {
+        if (count < capacity) {
+            fillInVec[count] = n;
+        }
+        ++count;
+    }
+    if (count > capacity) {
+        status = U_BUFFER_OVERFLOW_ERROR;
+    }
+    return count;
+}
+
 BreakIterator::BreakIterator (const Locale& valid, const Locale& actual) {
   U_LOCALE_BASED(locBased, (*this));
   locBased.setLocaleIDs(valid, actual);
@@ -229,22 +229,40 @@ BytesTrieBuilder::buildBytes(UStringTrieBuildOption buildOption, UErrorCode &err
             errorCode=U_INDEX_OUTOFBOUNDS_ERROR;
             return;
         }
-        uprv_sortArray(elements, elementsLength, (int32_t)sizeof(BytesTrieElement),
-                      compareElementStrings, strings,
-                      FALSE,  // need not be a stable sort
-                      &errorCode);
-        if(U_FAILURE(errorCode)) {
-            return;
-        }
-        // Duplicate strings are not allowed.
-        StringPiece prev=elements[0].getString(*strings);
+        // Large inputs often come from sorted word lists.
+        // Skip the sort if the strings were added in order;
+        // this linear pass also finds adjacent duplicates.
+        UBool isSorted=TRUE;
         for(int32_t i=1; i<elementsLength; ++i) {
-            StringPiece current=elements[i].getString(*strings);
-            if(prev==current) {
-                errorCode=U_ILLEGAL_ARGUMENT_ERROR;
+            int32_t diff=elements[i-1].compareStringTo(elements[i], *strings);
+            if(diff>=0) {
+                if(diff==0) {
+                    // Duplicate strings are not allowed.
+                    errorCode=U_ILLEGAL_ARGUMENT_ERROR;
+                    return;
+                }
+                isSorted=FALSE;
+                break;
+            }
+        }
+        if(!isSorted) {
+            uprv_sortArray(elements, elementsLength, (int32_t)sizeof(BytesTrieElement),
+                          compareElementStrings, strings,
+                          FALSE,  // need not be a stable sort
+                          &errorCode);
+            if(U_FAILURE(errorCode)) {
                 return;
             }
-            prev=current;
+            // Duplicate strings are not allowed.
+            StringPiece prev=elements[0].getString(*strings);
+            for(int32_t i=1; i<elementsLength; ++i) {
+                StringPiece current=elements[i].getString(*strings);
+                if(prev==current) {
+                    errorCode=U_ILLEGAL_ARGUMENT_ERROR;
+                    return;
+                }
+                prev=current;
+            }
         }
     }
     // Create and byte-serialize the trie for the elements.
@@ -365,7 +383,7 @@ BytesTrieBuilder::BTLinearMatchNode::write(StringTrieBuilder &builder) {
 StringTrieBuilder::Node *
 BytesTrieBuilder::createLinearMatchNode(int32_t i, int32_t byteIndex, int32_t length,
                                         Node *nextNode) const {
-    return new BTLinearMatchNode(
+    return new(allocateNode(sizeof(BTLinearMatchNode))) BTLinearMatchNode(
             elements[i].getString(*strings).data()+byteIndex,
             length,
             nextNode);
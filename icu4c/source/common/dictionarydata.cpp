@@ -16,6 +16,7 @@
 #include "unicode/bytestrie.h"
 #include "unicode/udata.h"
 #include "cmemory.h"
+#include "ucmndata.h"
 
 #if !UCONFIG_NO_BREAK_ITERATION
 
@@ -34,6 +35,57 @@ const int32_t  DictionaryData::TRANSFORM_OFFSET_MASK = 0x1fffff;
 DictionaryMatcher::~DictionaryMatcher() {
 }
 
+DictionaryMatcher *
+DictionaryMatcher::openFromMemory(const void *data, int32_t length, UErrorCode &status) {
+    if (U_FAILURE(status)) {
+        return NULL;
+    }
+    if (data == NULL || length < 0 || U_POINTER_MASK_LSB(data, 3) != 0) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return NULL;
+    }
+    // Check the standard data header: This must be native-endian "Dict" format version 1 data.
+    const DataHeader *header = (const DataHeader *)data;
+    int32_t headerSize;
+    if (length < (int32_t)sizeof(DataHeader) ||
+            header->dataHeader.magic1 != 0xda || header->dataHeader.magic2 != 0x27 ||
+            header->info.isBigEndian != U_IS_BIG_ENDIAN ||
+            header->info.charsetFamily != U_CHARSET_FAMILY ||
+            header->info.dataFormat[0] != 0x44 || header->info.dataFormat[1] != 0x69 ||
+            header->info.dataFormat[2] != 0x63 || header->info.dataFormat[3] != 0x74 ||
+            header->info.formatVersion[0] != 1 ||
+            (headerSize = header->dataHeader.headerSize) < (int32_t)sizeof(DataHeader) ||
+            (headerSize & 3) != 0 ||
+            length - headerSize < DictionaryData::IX_COUNT * 4) {
+        status = U_INVALID_FORMAT_ERROR;
+        return NULL;
+    }
+    const uint8_t *bytes = (const uint8_t *)data + headerSize;
+    const int32_t *indexes = (const int32_t *)bytes;
+    int32_t offset = indexes[DictionaryData::IX_STRING_TRIE_OFFSET];
+    int32_t trieType = indexes[DictionaryData::IX_TRIE_TYPE] & DictionaryData::TRIE_TYPE_MASK;
+    if (offset < DictionaryData::IX_COUNT * 4 || (offset & 1) != 0 ||
+            indexes[DictionaryData::IX_TOTAL_SIZE] > length - headerSize ||
+            offset >= indexes[DictionaryData::IX_TOTAL_SIZE]) {
+        status = U_INVALID_FORMAT_ERROR;
+        return NULL;
+    }
+    DictionaryMatcher *m;
+    if (trieType == DictionaryData::TRIE_TYPE_BYTES) {
+        m = new BytesDictionaryMatcher((const char *)(bytes + offset),
+                                       indexes[DictionaryData::IX_TRANSFORM], NULL);
+    } else if (trieType == DictionaryData::TRIE_TYPE_UCHARS) {
+        m = new UCharsDictionaryMatcher((const UChar *)(bytes + offset), NULL);
+    } else {
+        status = U_INVALID_FORMAT_ERROR;
+        return NULL;
+    }
+    if (m == NULL) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+    }
+    return m;
+}
+
 UCharsDictionaryMatcher::~UCharsDictionaryMatcher() {
     udata_close(file);
 }
@@ -153,6 +205,85 @@ int32_t BytesDictionaryMatcher::matches(UText *text, int32_t maxLength, int32_t
     return wordCount;
 }
 
+LayeredDictionaryMatcher::~LayeredDictionaryMatcher() {
+    delete custom;
+    delete base;
+}
+
+int32_t LayeredDictionaryMatcher::getType() const {
+    return custom->getType();
+}
+
+int32_t LayeredDictionaryMatcher::matches(UText *text, int32_t maxLength, int32_t limit,
+                            int32_t *lengths, int32_t *cpLengths, int32_t *values,
+                            int32_t *prefix) const {
+    if (base == NULL) {
+        return custom->matches(text, maxLength, limit, lengths, cpLengths, values, prefix);
+    }
+    // Collect each dictionary's matches with code unit lengths for merging.
+    // Lengths are distinct and ascending, so neither list is longer than maxLength.
+    int32_t capacity = limit < maxLength ? limit : maxLength;
+    if (capacity <= 0) {
+        capacity = 1;
+    }
+    MaybeStackArray<int32_t, 3 * 20> customMatches, baseMatches;
+    if (customMatches.resize(3 * capacity) == NULL || baseMatches.resize(3 * capacity) == NULL) {
+        return custom->matches(text, maxLength, limit, lengths, cpLengths, values, prefix);
+    }
+    int32_t *customLengths = customMatches.getAlias();
+    int32_t *customCPLengths = customLengths + capacity;
+    int32_t *customValues = customCPLengths + capacity;
+    int32_t *baseLengths = baseMatches.getAlias();
+    int32_t *baseCPLengths = baseLengths + capacity;
+    int32_t *baseValues = baseCPLengths + capacity;
+
+    int64_t start = utext_getNativeIndex(text);
+    int32_t customPrefix = 0, basePrefix = 0;
+    int32_t customCount = custom->matches(text, maxLength, capacity,
+                                          customLengths, customCPLengths, customValues, &customPrefix);
+    int64_t customEnd = utext_getNativeIndex(text);
+    utext_setNativeIndex(text, start);
+    int32_t baseCount = base->matches(text, maxLength, capacity,
+                                      baseLengths, baseCPLengths, baseValues, &basePrefix);
+    // Like the other matchers, leave the text after the longest prefix.
+    if (customPrefix > basePrefix) {
+        utext_setNativeIndex(text, customEnd);
+    }
+    if (prefix != NULL) {
+        *prefix = customPrefix > basePrefix ? customPrefix : basePrefix;
+    }
+
+    int32_t wordCount = 0;
+    int32_t i = 0, j = 0;
+    while (i < customCount || j < baseCount) {
+        int32_t length, cpLength, value;
+        if (j >= baseCount || (i < customCount && customLengths[i] <= baseLengths[j])) {
+            if (j < baseCount && customLengths[i] == baseLengths[j]) {
+                ++j;  // Same word in both dictionaries.
+            }
+            length = customLengths[i];
+            cpLength = customCPLengths[i];
+            value = customValues[i++];
+        } else {
+            length = baseLengths[j];
+            cpLength = baseCPLengths[j];
+            value = baseValues[j++];
+        }
+        if (wordCount < limit) {
+            if (lengths != NULL) {
+                lengths[wordCount] = length;
+            }
+            if (cpLengths != NULL) {
+                cpLengths[wordCount] = cpLength;
+            }
+            if (values != NULL) {
+                values[wordCount] = value;
+            }
+            ++wordCount;
+        }
+    }
+    return wordCount;
+}
 
 U_NAMESPACE_END
 
@@ -96,6 +96,18 @@ public:
 
     /** @return DictionaryData::TRIE_TYPE_XYZ */
     virtual int32_t getType() const = 0;
+
+    /**
+     * Creates a matcher for .dict format data in memory, including the
+     * standard ICU data header, as written by the gendict tool.
+     * The data is aliased, not copied, and must outlive the matcher.
+     * @param data      pointer to 4-aligned data in the platform endianness
+     * @param length    length of the data in bytes
+     * @param status    Set to U_INVALID_FORMAT_ERROR if the data is not a valid dictionary,
+     *                  or to U_ILLEGAL_ARGUMENT_ERROR if data is NULL or misaligned.
+     * @return a new matcher, or NULL if an error occurred
+     */
+    static DictionaryMatcher *openFromMemory(const void *data, int32_t length, UErrorCode &status);
 };
 
 // Implementation of the DictionaryMatcher interface for a UCharsTrie dictionary
@@ -135,6 +147,24 @@ private:
     UDataMemory *file;
 };
 
+// Implementation of the DictionaryMatcher interface that looks up words in two dictionaries,
+// typically a custom dictionary layered over a built-in one.
+// Matches are merged by length; for a word in both dictionaries the custom value wins.
+class U_COMMON_API LayeredDictionaryMatcher : public DictionaryMatcher {
+public:
+    // Adopts both matchers. The base matcher can be NULL.
+    LayeredDictionaryMatcher(DictionaryMatcher *adoptCustom, DictionaryMatcher *adoptBase)
+            : custom(adoptCustom), base(adoptBase) { }
+    virtual ~LayeredDictionaryMatcher();
+    virtual int32_t matches(UText *text, int32_t maxLength, int32_t limit,
+                            int32_t *lengths, int32_t *cpLengths, int32_t *values,
+                            int32_t *prefix) const;
+    virtual int32_t getType() const;
+private:
+    DictionaryMatcher *custom;
+    DictionaryMatcher *base;
+};
+
 U_NAMESPACE_END
 
 U_CAPI int32_t U_EXPORT2
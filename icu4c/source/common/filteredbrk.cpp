@@ -15,11 +15,15 @@
 #include "unicode/filteredbrk.h"
 #include "unicode/ucharstriebuilder.h"
 #include "unicode/ures.h"
+#include "unicode/utf16.h"
+#include "unicode/utf8.h"
 
 #include "uresimp.h" // ures_getByKeyWithFallback
+#include "utextimp.h" // utext_getUTF8String
 #include "ubrkimpl.h" // U_ICUDATA_BRKITR
 #include "uvector.h"
 #include "cmemory.h"
+#include "umutex.h"
 
 U_NAMESPACE_BEGIN
 
@@ -133,19 +137,24 @@ static const int32_t kAddToForward = (1<<1);
 static const UChar   kFULLSTOP = 0x002E; // '.'
 
 /**
- * Shared data for SimpleFilteredSentenceBreakIterator
+ * Shared data for SimpleFilteredSentenceBreakIterator.
+ * Clones in different threads share it, so the reference count is atomic,
+ * and the tries are stored in serialized form: Each lookup walks its own
+ * UCharsTrie on the stack, rather than a shared trie object with iteration state.
  */
 class SimpleFilteredSentenceBreakData : public UMemory {
 public:
-  SimpleFilteredSentenceBreakData(UCharsTrie *forwards, UCharsTrie *backwards ) 
-      : fForwardsPartialTrie(forwards), fBackwardsTrie(backwards), refcount(1) { }
-  SimpleFilteredSentenceBreakData *incr() { refcount++;  return this; }
-  SimpleFilteredSentenceBreakData *decr() { if((--refcount) <= 0) delete this; return 0; }
+  // Copies the serialized tries, which usually alias the memory of a UCharsTrieBuilder.
+  SimpleFilteredSentenceBreakData(const UnicodeString &forwards, const UnicodeString &backwards )
+      : fForwardsPartialTrie(forwards.getBuffer(), forwards.length()),
+        fBackwardsTrie(backwards.getBuffer(), backwards.length()), refcount(1) { }
+  SimpleFilteredSentenceBreakData *incr() { umtx_atomic_inc(&refcount);  return this; }
+  SimpleFilteredSentenceBreakData *decr() { if(umtx_atomic_dec(&refcount) <= 0) delete this; return 0; }
   virtual ~SimpleFilteredSentenceBreakData();
 
-  LocalPointer<UCharsTrie>    fForwardsPartialTrie; //  Has ".a" for "a.M."
-  LocalPointer<UCharsTrie>    fBackwardsTrie; //  i.e. ".srM" for Mrs.
-  int32_t                     refcount;
+  const UnicodeString         fForwardsPartialTrie; //  Has ".a" for "a.M."; empty if none
+  const UnicodeString         fBackwardsTrie; //  i.e. ".srM" for Mrs.; empty if none
+  u_atomic_int32_t            refcount;
 };
 
 SimpleFilteredSentenceBreakData::~SimpleFilteredSentenceBreakData() {}
@@ -155,13 +164,17 @@ SimpleFilteredSentenceBreakData::~SimpleFilteredSentenceBreakData() {}
  */
 class SimpleFilteredSentenceBreakIterator : public BreakIterator {
 public:
-  SimpleFilteredSentenceBreakIterator(BreakIterator *adopt, UCharsTrie *forwards, UCharsTrie *backwards, UErrorCode &status);
+  SimpleFilteredSentenceBreakIterator(BreakIterator *adopt, const UnicodeString &forwards, const UnicodeString &backwards, UErrorCode &status);
   SimpleFilteredSentenceBreakIterator(const SimpleFilteredSentenceBreakIterator& other);
   virtual ~SimpleFilteredSentenceBreakIterator();
 private:
   SimpleFilteredSentenceBreakData *fData;
   LocalPointer<BreakIterator> fDelegate;
   LocalUTextPointer           fText;
+  UBool                       fTextIsStale; // fText needs to be re-fetched from fDelegate
+  int32_t                     fTextLength;
+  const UChar                 *fChars16; // direct access to fText if it is a single UTF-16 chunk, or NULL
+  const uint8_t               *fChars8;  // direct access to fText if it is UTF-8, or NULL
 
   /* -- subclass interface -- */
 public:
@@ -178,10 +191,10 @@ public:
   virtual UBool operator==(const BreakIterator& o) const { if(this==&o) return true; return false; }
 
   /* -- text modifying -- */
-  virtual void setText(UText *text, UErrorCode &status) { fDelegate->setText(text,status); }
-  virtual BreakIterator &refreshInputText(UText *input, UErrorCode &status) { fDelegate->refreshInputText(input,status); return *this; }
-  virtual void adoptText(CharacterIterator* it) { fDelegate->adoptText(it); }
-  virtual void setText(const UnicodeString &text) { fDelegate->setText(text); }
+  virtual void setText(UText *text, UErrorCode &status) { fTextIsStale = TRUE; fDelegate->setText(text,status); }
+  virtual BreakIterator &refreshInputText(UText *input, UErrorCode &status) { fTextIsStale = TRUE; fDelegate->refreshInputText(input,status); return *this; }
+  virtual void adoptText(CharacterIterator* it) { fTextIsStale = TRUE; fDelegate->adoptText(it); }
+  virtual void setText(const UnicodeString &text) { fTextIsStale = TRUE; fDelegate->setText(text); }
 
   /* -- other functions that are just delegated -- */
   virtual UText *getUText(UText *fillIn, UErrorCode &status) const { return fDelegate->getUText(fillIn,status); }
@@ -200,6 +213,9 @@ public:
   virtual int32_t following(int32_t offset);
   virtual int32_t last(void);
 
+  /* -- bulk -- */
+  virtual int32_t getBoundaries(int32_t *fillInVec, int32_t capacity, UErrorCode &status);
+
 private:
     /**
      * Given that the fDelegate has already given its "initial" answer,
@@ -218,7 +234,7 @@ private:
     /**
      * set up the UText with the value of the fDelegate.
      * Call this before calling breakExceptionAt. 
-     * May be able to avoid excess calls
+     * Only fetches the text again after it was changed.
      */
     void resetState(UErrorCode &status);
     /**
@@ -231,18 +247,25 @@ private:
      * @return kNoExceptionHere or kExceptionHere
      **/
     enum EFBMatchResult breakExceptionAt(int32_t n);
+    /**
+     * Same as breakExceptionAt(n), but with direct access to the UTF-16 or UTF-8 text.
+     */
+    template<typename CharType>
+    enum EFBMatchResult breakExceptionAt(const CharType *s, int32_t length, int32_t n) const;
 };
 
 SimpleFilteredSentenceBreakIterator::SimpleFilteredSentenceBreakIterator(const SimpleFilteredSentenceBreakIterator& other)
-  : BreakIterator(other), fData(other.fData->incr()), fDelegate(other.fDelegate->clone())
+  : BreakIterator(other), fData(other.fData->incr()), fDelegate(other.fDelegate->clone()),
+    fTextIsStale(TRUE), fTextLength(0), fChars16(NULL), fChars8(NULL)
 {
 }
 
 
-SimpleFilteredSentenceBreakIterator::SimpleFilteredSentenceBreakIterator(BreakIterator *adopt, UCharsTrie *forwards, UCharsTrie *backwards, UErrorCode &status) :
+SimpleFilteredSentenceBreakIterator::SimpleFilteredSentenceBreakIterator(BreakIterator *adopt, const UnicodeString &forwards, const UnicodeString &backwards, UErrorCode &status) :
   BreakIterator(adopt->getLocale(ULOC_VALID_LOCALE,status),adopt->getLocale(ULOC_ACTUAL_LOCALE,status)),
   fData(new SimpleFilteredSentenceBreakData(forwards, backwards)),
-  fDelegate(adopt)
+  fDelegate(adopt),
+  fTextIsStale(TRUE), fTextLength(0), fChars16(NULL), fChars8(NULL)
 {
   // all set..
 }
@@ -252,16 +275,122 @@ SimpleFilteredSentenceBreakIterator::~SimpleFilteredSentenceBreakIterator() {
 }
 
 void SimpleFilteredSentenceBreakIterator::resetState(UErrorCode &status) {
+  if(!fTextIsStale || U_FAILURE(status)) {
+    return;
+  }
   fText.adoptInstead(fDelegate->getUText(fText.orphan(), status));
+  if(U_FAILURE(status)) {
+    return;
+  }
+  fTextIsStale = FALSE;
+  UText *ut = fText.getAlias();
+  fTextLength = (int32_t)utext_nativeLength(ut);
+  fChars16 = NULL;
+  fChars8 = (const uint8_t *)utext_getUTF8String(ut, NULL);
+  if(fChars8 == NULL) {
+    // UnicodeString and UChar * text is accessible as one chunk.
+    utext_setNativeIndex(ut, 0);
+    if(ut->chunkNativeStart == 0 && ut->chunkNativeLimit == fTextLength &&
+        ut->nativeIndexingLimit == ut->chunkLength) {
+      fChars16 = ut->chunkContents;
+    }
+  }
+}
+
+namespace {
+
+inline UChar32 prevCodePoint(const UChar *s, int32_t &i) {
+  UChar32 c;
+  U16_PREV(s, 0, i, c);
+  return c;
+}
+
+inline UChar32 prevCodePoint(const uint8_t *s, int32_t &i) {
+  UChar32 c;
+  U8_PREV(s, 0, i, c);
+  return c >= 0 ? c : 0xfffd;  // same as utext_previous32() for ill-formed UTF-8
+}
+
+inline UChar32 nextCodePoint(const UChar *s, int32_t &i, int32_t length) {
+  UChar32 c;
+  U16_NEXT(s, i, length, c);
+  return c;
+}
+
+inline UChar32 nextCodePoint(const uint8_t *s, int32_t &i, int32_t length) {
+  UChar32 c;
+  U8_NEXT(s, i, length, c);
+  return c >= 0 ? c : 0xfffd;
+}
+
+}  // namespace
+
+template<typename CharType>
+SimpleFilteredSentenceBreakIterator::EFBMatchResult
+SimpleFilteredSentenceBreakIterator::breakExceptionAt(const CharType *s, int32_t length, int32_t n) const {
+    // Same logic as breakExceptionAt(n) on the UText, see there.
+    int32_t bestPosn = -1;
+    int32_t bestValue = -1;
+    int32_t i = n;
+    UCharsTrie backwardsTrie(fData->fBackwardsTrie.getBuffer());
+
+    // Assume a space is following the '.'  (so we handle the case:  "Mr. /Brown")
+    if(i > 0) {
+      if(prevCodePoint(s, i) != 0x0020) {
+        i = n;
+      }
+    } else if(i < length) {
+      nextCodePoint(s, i, length);  // like utext_previous32() at the start followed by utext_next32()
+    }
+
+    UStringTrieResult r = USTRINGTRIE_INTERMEDIATE_VALUE;
+
+    while(i > 0 &&   // more to consume backwards and..
+          USTRINGTRIE_HAS_NEXT(r=backwardsTrie.nextForCodePoint(prevCodePoint(s, i)))) {// more in the trie
+      if(USTRINGTRIE_HAS_VALUE(r)) { // remember the best match so far
+        bestPosn = i;
+        bestValue = backwardsTrie.getValue();
+      }
+    }
+
+    if(USTRINGTRIE_MATCHES(r)) { // exact match?
+      bestValue = backwardsTrie.getValue();
+      bestPosn = i;
+    }
+
+    if(bestPosn < 0) {
+      return kNoExceptionHere; // No match - so exit. Not an exception.
+    }
+    if(bestValue == kMATCH) { // exact match!
+      return kExceptionHere;
+    }
+    if(bestValue != kPARTIAL || fData->fForwardsPartialTrie.isEmpty()) {
+      return kNoExceptionHere; // internal error and/or no forwards trie
+    }
+    // We matched the "Ph." in "Ph.D." - now we need to run everything through the forwards trie
+    // to see if it matches something going forward.
+    UCharsTrie forwardsPartialTrie(fData->fForwardsPartialTrie.getBuffer());
+    UStringTrieResult rfwd = USTRINGTRIE_INTERMEDIATE_VALUE;
+    i = bestPosn;
+    while(i < length &&
+          USTRINGTRIE_HAS_NEXT(rfwd=forwardsPartialTrie.nextForCodePoint(nextCodePoint(s, i, length)))) {
+    }
+    // only full matches here, nothing to check
+    return USTRINGTRIE_MATCHES(rfwd) ? kExceptionHere : kNoExceptionHere;
 }
 
 SimpleFilteredSentenceBreakIterator::EFBMatchResult
 SimpleFilteredSentenceBreakIterator::breakExceptionAt(int32_t n) {
+    if(fChars16 != NULL) {
+      return breakExceptionAt(fChars16, fTextLength, n);
+    } else if(fChars8 != NULL) {
+      return breakExceptionAt(fChars8, fTextLength, n);
+    }
     int64_t bestPosn = -1;
     int32_t bestValue = -1;
     // loops while 'n' points to an exception.
     utext_setNativeIndex(fText.getAlias(), n); // from n..
-    fData->fBackwardsTrie->reset();
+    UCharsTrie backwardsTrie(fData->fBackwardsTrie.getBuffer());
     UChar32 uch;
 
     //if(debug2) u_printf(" n@ %d\n", n);
@@ -278,17 +407,17 @@ SimpleFilteredSentenceBreakIterator::breakExceptionAt(int32_t n) {
     UStringTrieResult r = USTRINGTRIE_INTERMEDIATE_VALUE;
 
     while((uch=utext_previous32(fText.getAlias()))!=U_SENTINEL  &&   // more to consume backwards and..
-          USTRINGTRIE_HAS_NEXT(r=fData->fBackwardsTrie->nextForCodePoint(uch))) {// more in the trie
+          USTRINGTRIE_HAS_NEXT(r=backwardsTrie.nextForCodePoint(uch))) {// more in the trie
       if(USTRINGTRIE_HAS_VALUE(r)) { // remember the best match so far
         bestPosn = utext_getNativeIndex(fText.getAlias());
-        bestValue = fData->fBackwardsTrie->getValue();
+        bestValue = backwardsTrie.getValue();
       }
       //if(debug2) u_printf("rev< /%C/ cont?%d @%d\n", (UChar)uch, r, utext_getNativeIndex(fText.getAlias()));
     }
 
     if(USTRINGTRIE_MATCHES(r)) { // exact match?
       //if(debug2) u_printf("rev<?/%C/?end of seq.. r=%d, bestPosn=%d, bestValue=%d\n", (UChar)uch, r, bestPosn, bestValue);
-      bestValue = fData->fBackwardsTrie->getValue();
+      bestValue = backwardsTrie.getValue();
       bestPosn = utext_getNativeIndex(fText.getAlias());
       //if(debug2) u_printf("rev<+/%C/+end of seq.. r=%d, bestPosn=%d, bestValue=%d\n", (UChar)uch, r, bestPosn, bestValue);
     }
@@ -304,16 +433,16 @@ SimpleFilteredSentenceBreakIterator::breakExceptionAt(int32_t n) {
         //if(debug2) u_printf(" exact backward match\n");
         return kExceptionHere; // See if the next is another exception.
       } else if(bestValue == kPARTIAL
-                && fData->fForwardsPartialTrie.isValid()) { // make sure there's a forward trie
+                && !fData->fForwardsPartialTrie.isEmpty()) { // make sure there's a forward trie
         //if(debug2) u_printf(" partial backward match\n");
         // We matched the "Ph." in "Ph.D." - now we need to run everything through the forwards trie
         // to see if it matches something going forward.
-        fData->fForwardsPartialTrie->reset();
+        UCharsTrie forwardsPartialTrie(fData->fForwardsPartialTrie.getBuffer());
         UStringTrieResult rfwd = USTRINGTRIE_INTERMEDIATE_VALUE;
         utext_setNativeIndex(fText.getAlias(), bestPosn); // hope that's close ..
         //if(debug2) u_printf("Retrying at %d\n", bestPosn);
         while((uch=utext_next32(fText.getAlias()))!=U_SENTINEL &&
-              USTRINGTRIE_HAS_NEXT(rfwd=fData->fForwardsPartialTrie->nextForCodePoint(uch))) {
+              USTRINGTRIE_HAS_NEXT(rfwd=forwardsPartialTrie.nextForCodePoint(uch))) {
           //if(debug2) u_printf("fwd> /%C/ cont?%d @%d\n", (UChar)uch, rfwd, utext_getNativeIndex(fText.getAlias()));
         }
         if(USTRINGTRIE_MATCHES(rfwd)) {
@@ -339,7 +468,7 @@ SimpleFilteredSentenceBreakIterator::breakExceptionAt(int32_t n) {
 int32_t
 SimpleFilteredSentenceBreakIterator::internalNext(int32_t n) {
   if(n == UBRK_DONE || // at end  or
-    fData->fBackwardsTrie.isNull()) { // .. no backwards table loaded == no exceptions
+    fData->fBackwardsTrie.isEmpty()) { // .. no backwards table loaded == no exceptions
       return n;
   }
   // OK, do we need to break here?
@@ -347,10 +476,9 @@ SimpleFilteredSentenceBreakIterator::internalNext(int32_t n) {
   // refresh text
   resetState(status);
   if(U_FAILURE(status)) return UBRK_DONE; // bail out
-  int64_t utextLen = utext_nativeLength(fText.getAlias());
 
   //if(debug2) u_printf("str, native len=%d\n", utext_nativeLength(fText.getAlias()));
-  while (n != UBRK_DONE && n != utextLen) { // outer loop runs once per underlying break (from fDelegate).
+  while (n != UBRK_DONE && n != fTextLength) { // outer loop runs once per underlying break (from fDelegate).
     SimpleFilteredSentenceBreakIterator::EFBMatchResult m = breakExceptionAt(n);
 
     switch(m) {
@@ -369,7 +497,7 @@ SimpleFilteredSentenceBreakIterator::internalNext(int32_t n) {
 int32_t
 SimpleFilteredSentenceBreakIterator::internalPrev(int32_t n) {
   if(n == 0 || n == UBRK_DONE || // at end  or
-    fData->fBackwardsTrie.isNull()) { // .. no backwards table loaded == no exceptions
+    fData->fBackwardsTrie.isEmpty()) { // .. no backwards table loaded == no exceptions
       return n;
   }
   // OK, do we need to break here?
@@ -420,7 +548,7 @@ SimpleFilteredSentenceBreakIterator::previous(void) {
 UBool SimpleFilteredSentenceBreakIterator::isBoundary(int32_t offset) {
   if (!fDelegate->isBoundary(offset)) return false; // no break to suppress
 
-  if (fData->fBackwardsTrie.isNull()) return true; // no data = no suppressions
+  if (fData->fBackwardsTrie.isEmpty()) return true; // no data = no suppressions
 
   UErrorCode status = U_ZERO_ERROR;
   resetState(status);
@@ -452,6 +580,40 @@ SimpleFilteredSentenceBreakIterator::last(void) {
   return fDelegate->last();
 }
 
+// Finds the candidate breaks and suppresses the exceptions in one forward pass.
+int32_t
+SimpleFilteredSentenceBreakIterator::getBoundaries(int32_t *fillInVec, int32_t capacity, UErrorCode &status) {
+  if(fData->fBackwardsTrie.isEmpty()) { // no data = no suppressions
+    return fDelegate->getBoundaries(fillInVec, capacity, status);
+  }
+  if(U_FAILURE(status)) {
+    return 0;
+  }
+  if(capacity < 0 || (fillInVec == NULL && capacity > 0)) {
+    status = U_ILLEGAL_ARGUMENT_ERROR;
+    return 0;
+  }
+  resetState(status);
+  if(U_FAILURE(status)) {
+    return 0;
+  }
+  int32_t count = 0;
+  for(int32_t n = fDelegate->first(); n != UBRK_DONE; n = fDelegate->next()) {
+    // Don't suppress a break opportunity at the beginning or end of text.
+    if(n != 0 && n != fTextLength && breakExceptionAt(n) == kExceptionHere) {
+      continue;
+    }
+    if(count < capacity) {
+      fillInVec[count] = n;
+    }
+    ++count;
+  }
+  if(count > capacity) {
+    status = U_BUFFER_OVERFLOW_ERROR;
+  }
+  return count;
+}
+
 
 /**
  * Concrete implementation of builder class.
@@ -579,8 +741,8 @@ SimpleFilteredBreakIteratorBuilder::build(BreakIterator* adoptBreakIterator, UEr
   LocalMemory<int> partials;
   partials.allocateInsteadAndReset(subCount);
 
-  LocalPointer<UCharsTrie>    backwardsTrie; //  i.e. ".srM" for Mrs.
-  LocalPointer<UCharsTrie>    forwardsPartialTrie; //  Has ".a" for "a.M."
+  UnicodeString backwardsTrie; //  i.e. ".srM" for Mrs.
+  UnicodeString forwardsPartialTrie; //  Has ".a" for "a.M."
 
   int n=0;
   for ( int32_t i = 0;
@@ -659,7 +821,7 @@ SimpleFilteredBreakIteratorBuilder::build(BreakIterator* adoptBreakIterator, UEr
   FB_TRACE("AbbrCount",NULL,FALSE, subCount);
 
   if(revCount>0) {
-    backwardsTrie.adoptInstead(builder->build(USTRINGTRIE_BUILD_FAST, status));
+    builder->buildUnicodeString(USTRINGTRIE_BUILD_FAST, backwardsTrie, status);
     if(U_FAILURE(status)) {
       FB_TRACE(u_errorName(status),NULL,FALSE, -1);
       return NULL;
@@ -667,14 +829,14 @@ SimpleFilteredBreakIteratorBuilder::build(BreakIterator* adoptBreakIterator, UEr
   }
 
   if(fwdCount>0) {
-    forwardsPartialTrie.adoptInstead(builder2->build(USTRINGTRIE_BUILD_FAST, status));
+    builder2->buildUnicodeString(USTRINGTRIE_BUILD_FAST, forwardsPartialTrie, status);
     if(U_FAILURE(status)) {
       FB_TRACE(u_errorName(status),NULL,FALSE, -1);
       return NULL;
     }
   }
 
-  return new SimpleFilteredSentenceBreakIterator(adopt.orphan(), forwardsPartialTrie.orphan(), backwardsTrie.orphan(), status);
+  return new SimpleFilteredSentenceBreakIterator(adopt.orphan(), forwardsPartialTrie, backwardsTrie, status);
 }
 
 
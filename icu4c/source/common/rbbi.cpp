@@ -33,6 +33,7 @@
 #include "rbbirb.h"
 #include "uassert.h"
 #include "umutex.h"
+#include "uvector.h"
 #include "uvectr32.h"
 
 // if U_LOCAL_SERVICE_HOOK is defined, then localsvc.cpp is expected to be included.
@@ -44,6 +45,12 @@
 static UBool gTrace = FALSE;
 #endif
 
+U_CDECL_BEGIN
+static void U_CALLCONV _releaseSharedBreakEngine(void *obj) {
+    ((const icu::SharedBreakEngine *)obj)->removeRef();
+}
+U_CDECL_END
+
 U_NAMESPACE_BEGIN
 
 // The state number of the starting state
@@ -209,6 +216,9 @@ RuleBasedBreakIterator::~RuleBasedBreakIterator() {
 
     delete fUnhandledBreakEngine;
     fUnhandledBreakEngine = NULL;
+
+    delete fCustomBreakEngines;
+    fCustomBreakEngines = NULL;
 }
 
 /**
@@ -228,6 +238,29 @@ RuleBasedBreakIterator::operator=(const RuleBasedBreakIterator& that) {
     }
     // TODO: clone fLanguageBreakEngines from "that"
     UErrorCode status = U_ZERO_ERROR;
+
+    // Custom dictionary engines are immutable and shared.
+    delete fCustomBreakEngines;
+    fCustomBreakEngines = NULL;
+    if (that.fCustomBreakEngines != NULL) {
+        fCustomBreakEngines = new UVector(_releaseSharedBreakEngine, NULL,
+                                          that.fCustomBreakEngines->size(), status);
+        if (U_SUCCESS(status) && fCustomBreakEngines == NULL) {
+            status = U_MEMORY_ALLOCATION_ERROR;
+        }
+        for (int32_t i = 0; U_SUCCESS(status) && i < that.fCustomBreakEngines->size(); ++i) {
+            const SharedBreakEngine *engine =
+                (const SharedBreakEngine *)that.fCustomBreakEngines->elementAt(i);
+            engine->addRef();
+            fCustomBreakEngines->addElement((void *)engine, status);
+        }
+        // Without its custom dictionaries the copy still works, with the built-in ones.
+        if (U_FAILURE(status)) {
+            delete fCustomBreakEngines;
+            fCustomBreakEngines = NULL;
+            status = U_ZERO_ERROR;
+        }
+    }
     utext_clone(&fText, &that.fText, FALSE, TRUE, &status);
 
     if (fCharIter != &fSCharIter) {
@@ -262,8 +295,13 @@ RuleBasedBreakIterator::operator=(const RuleBasedBreakIterator& that) {
     //       Current position could be within a dictionary range. Trying to continue
     //       the iteration without the caches present would go to the rules, with
     //       the assumption that the current position is on a rule boundary.
-    fBreakCache->reset(fPosition, fRuleStatusIndex);
-    fDictionaryCache->reset();
+    // A cache that has not been allocated yet starts out from fPosition when it is.
+    if (fBreakCache != NULL) {
+        fBreakCache->reset(fPosition, fRuleStatusIndex);
+    }
+    if (fDictionaryCache != NULL) {
+        fDictionaryCache->reset();
+    }
 
     return *this;
 }
@@ -285,6 +323,7 @@ void RuleBasedBreakIterator::init(UErrorCode &status) {
     fDictionaryCharCount  = 0;
     fLanguageBreakEngines = NULL;
     fUnhandledBreakEngine = NULL;
+    fCustomBreakEngines   = NULL;
     fBreakCache           = NULL;
     fDictionaryCache      = NULL;
 
@@ -298,11 +337,6 @@ void RuleBasedBreakIterator::init(UErrorCode &status) {
     }
 
     utext_openUChars(&fText, NULL, 0, &status);
-    fDictionaryCache = new DictionaryCache(this, status);
-    fBreakCache      = new BreakCache(this, status);
-    if (U_SUCCESS(status) && (fDictionaryCache == NULL || fBreakCache == NULL)) {
-        status = U_MEMORY_ALLOCATION_ERROR;
-    }
 
 #ifdef RBBI_DEBUG
     static UBool debugInitDone = FALSE;
@@ -318,6 +352,54 @@ void RuleBasedBreakIterator::init(UErrorCode &status) {
 
 
 
+//-----------------------------------------------------------------------------
+//
+//    reset()     Dumps the caches for new text, and sets the iteration
+//                position to the start of the text.
+//
+//-----------------------------------------------------------------------------
+void RuleBasedBreakIterator::reset() {
+    fPosition = 0;
+    fRuleStatusIndex = 0;
+    if (fBreakCache != NULL) {
+        fBreakCache->reset();
+    }
+    if (fDictionaryCache != NULL) {
+        fDictionaryCache->reset();
+    }
+}
+
+
+UBool RuleBasedBreakIterator::ensureBreakCache() {
+    if (fBreakCache != NULL) {
+        return TRUE;
+    }
+    UErrorCode status = U_ZERO_ERROR;
+    LocalPointer<BreakCache> cache(new BreakCache(this, status), status);
+    if (U_FAILURE(status)) {
+        return FALSE;
+    }
+    fBreakCache = cache.orphan();
+    fBreakCache->reset(fPosition, fRuleStatusIndex);
+    return TRUE;
+}
+
+
+UBool RuleBasedBreakIterator::ensureDictionaryCache() {
+    if (fDictionaryCache != NULL) {
+        return TRUE;
+    }
+    UErrorCode status = U_ZERO_ERROR;
+    LocalPointer<DictionaryCache> cache(new DictionaryCache(this, status), status);
+    if (U_FAILURE(status)) {
+        return FALSE;
+    }
+    fDictionaryCache = cache.orphan();
+    return TRUE;
+}
+
+
+
 //-----------------------------------------------------------------------------
 //
 //    clone - Returns a newly-constructed RuleBasedBreakIterator with the same
@@ -388,8 +470,7 @@ void RuleBasedBreakIterator::setText(UText *ut, UErrorCode &status) {
     if (U_FAILURE(status)) {
         return;
     }
-    fBreakCache->reset();
-    fDictionaryCache->reset();
+    reset();
     utext_clone(&fText, ut, FALSE, TRUE, &status);
 
     // Set up a dummy CharacterIterator to be returned if anyone
@@ -443,8 +524,7 @@ RuleBasedBreakIterator::adoptText(CharacterIterator* newText) {
 
     fCharIter = newText;
     UErrorCode status = U_ZERO_ERROR;
-    fBreakCache->reset();
-    fDictionaryCache->reset();
+    reset();
     if (newText==NULL || newText->startIndex() != 0) {
         // startIndex !=0 wants to be an error, but there's no way to report it.
         // Make the iterator text be an empty string.
@@ -463,8 +543,7 @@ RuleBasedBreakIterator::adoptText(CharacterIterator* newText) {
 void
 RuleBasedBreakIterator::setText(const UnicodeString& newText) {
     UErrorCode status = U_ZERO_ERROR;
-    fBreakCache->reset();
-    fDictionaryCache->reset();
+    reset();
     utext_openConstUnicodeString(&fText, &newText, &status);
 
     // Set up a character iterator on the string.
@@ -521,6 +600,9 @@ RuleBasedBreakIterator &RuleBasedBreakIterator::refreshInputText(UText *input, U
  */
 int32_t RuleBasedBreakIterator::first(void) {
     UErrorCode status = U_ZERO_ERROR;
+    if (!ensureBreakCache()) {
+        return UBRK_DONE;
+    }
     if (!fBreakCache->seek(0)) {
         fBreakCache->populateNear(0, status);
     }
@@ -572,6 +654,9 @@ int32_t RuleBasedBreakIterator::next(int32_t n) {
  * @return The position of the first boundary after this one.
  */
 int32_t RuleBasedBreakIterator::next(void) {
+    if (!ensureBreakCache()) {
+        return UBRK_DONE;
+    }
     fBreakCache->next();
     return fDone ? UBRK_DONE : fPosition;
 }
@@ -586,6 +671,9 @@ int32_t RuleBasedBreakIterator::next(void) {
  */
 int32_t RuleBasedBreakIterator::previous(void) {
     UErrorCode status = U_ZERO_ERROR;
+    if (!ensureBreakCache()) {
+        return UBRK_DONE;
+    }
     fBreakCache->previous(status);
     return fDone ? UBRK_DONE : fPosition;
 }
@@ -609,6 +697,9 @@ int32_t RuleBasedBreakIterator::following(int32_t startPos) {
     startPos = (int32_t)utext_getNativeIndex(&fText);
 
     UErrorCode status = U_ZERO_ERROR;
+    if (!ensureBreakCache()) {
+        return UBRK_DONE;
+    }
     fBreakCache->following(startPos, status);
     return fDone ? UBRK_DONE : fPosition;
 }
@@ -631,6 +722,9 @@ int32_t RuleBasedBreakIterator::preceding(int32_t offset) {
     int32_t adjustedOffset = utext_getNativeIndex(&fText);
 
     UErrorCode status = U_ZERO_ERROR;
+    if (!ensureBreakCache()) {
+        return UBRK_DONE;
+    }
     fBreakCache->preceding(adjustedOffset, status);
     return fDone ? UBRK_DONE : fPosition;
 }
@@ -659,6 +753,9 @@ UBool RuleBasedBreakIterator::isBoundary(int32_t offset) {
 
     bool result = false;
     UErrorCode status = U_ZERO_ERROR;
+    if (!ensureBreakCache()) {
+        return FALSE;
+    }
     if (fBreakCache->seek(adjustedOffset) || fBreakCache->populateNear(adjustedOffset, status)) {
         result = (fBreakCache->current() == offset);
     }
@@ -1199,6 +1296,17 @@ RuleBasedBreakIterator::getLanguageBreakEngine(UChar32 c) {
         }
     }
 
+    if (fCustomBreakEngines != NULL) {
+        // Custom dictionaries take precedence over the built-in ones.
+        int32_t i = fCustomBreakEngines->size();
+        while (--i >= 0) {
+            lbe = ((const SharedBreakEngine *)fCustomBreakEngines->elementAt(i))->getEngine();
+            if (lbe->handles(c)) {
+                return lbe;
+            }
+        }
+    }
+
     int32_t i = fLanguageBreakEngines->size();
     while (--i >= 0) {
         lbe = (const LanguageBreakEngine *)(fLanguageBreakEngines->elementAt(i));
@@ -1245,8 +1353,58 @@ RuleBasedBreakIterator::getLanguageBreakEngine(UChar32 c) {
     return fUnhandledBreakEngine;
 }
 
+void RuleBasedBreakIterator::addCustomDictionary(UScriptCode script, const void *data, int32_t length,
+                                                 UErrorCode &status) {
+    if (U_FAILURE(status)) {
+        return;
+    }
+    if (script == USCRIPT_HIRAGANA || script == USCRIPT_KATAKANA) {
+        script = USCRIPT_HAN;
+    }
+    const LanguageBreakEngine *engine =
+        ICULanguageBreakFactory::createCustomDictionaryEngine(script, data, length, status);
+    if (U_FAILURE(status)) {
+        return;
+    }
+    SharedBreakEngine *shared = new SharedBreakEngine(script, engine);
+    if (shared == NULL) {
+        delete engine;
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    shared->addRef();
+    if (fCustomBreakEngines == NULL) {
+        fCustomBreakEngines = new UVector(_releaseSharedBreakEngine, NULL, status);
+        if (U_SUCCESS(status) && fCustomBreakEngines == NULL) {
+            status = U_MEMORY_ALLOCATION_ERROR;
+        }
+        if (U_FAILURE(status)) {
+            delete fCustomBreakEngines;
+            fCustomBreakEngines = NULL;
+            shared->removeRef();
+            return;
+        }
+    }
+    // Replace an earlier dictionary for the same script.
+    for (int32_t i = fCustomBreakEngines->size(); --i >= 0;) {
+        if (((const SharedBreakEngine *)fCustomBreakEngines->elementAt(i))->getScript() == script) {
+            fCustomBreakEngines->removeElementAt(i);
+        }
+    }
+    fCustomBreakEngines->addElement(shared, status);
+    if (U_FAILURE(status)) {
+        shared->removeRef();
+        return;
+    }
+    // Boundaries in dictionary ranges may change: Discard the cached ones, as in setText().
+    reset();
+    first();
+}
+
 void RuleBasedBreakIterator::dumpCache() {
-    fBreakCache->dumpCache();
+    if (fBreakCache != NULL) {
+        fBreakCache->dumpCache();
+    }
 }
 
 void RuleBasedBreakIterator::dumpTables() {
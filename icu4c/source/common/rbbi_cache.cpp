@@ -431,7 +431,8 @@ UBool RuleBasedBreakIterator::BreakCache::populateFollowing() {
     int32_t pos = 0;
     int32_t ruleStatusIdx = 0;
 
-    if (fBI->fDictionaryCache->following(fromPosition, &pos, &ruleStatusIdx)) {
+    if (fBI->fDictionaryCache != NULL &&
+            fBI->fDictionaryCache->following(fromPosition, &pos, &ruleStatusIdx)) {
         addFollowing(pos, ruleStatusIdx, UpdateCachePosition);
         return TRUE;
     }
@@ -443,7 +444,7 @@ UBool RuleBasedBreakIterator::BreakCache::populateFollowing() {
     }
 
     ruleStatusIdx = fBI->fRuleStatusIndex;
-    if (fBI->fDictionaryCharCount > 0) {
+    if (fBI->fDictionaryCharCount > 0 && fBI->ensureDictionaryCache()) {
         // The text segment obtained from the rules includes dictionary characters.
         // Subdivide it, with subdivided results going into the dictionary cache.
         fBI->fDictionaryCache->populateDictionary(fromPosition, pos, fromRuleStatusIdx, ruleStatusIdx);
@@ -489,7 +490,8 @@ UBool RuleBasedBreakIterator::BreakCache::populatePreceding(UErrorCode &status)
     int32_t position = 0;
     int32_t positionStatusIdx = 0;
 
-    if (fBI->fDictionaryCache->preceding(fromPosition, &position, &positionStatusIdx)) {
+    if (fBI->fDictionaryCache != NULL &&
+            fBI->fDictionaryCache->preceding(fromPosition, &position, &positionStatusIdx)) {
         addPreceding(position, positionStatusIdx, UpdateCachePosition);
         return TRUE;
     }
@@ -546,7 +548,7 @@ UBool RuleBasedBreakIterator::BreakCache::populatePreceding(UErrorCode &status)
         }
 
         UBool segmentHandledByDictionary = FALSE;
-        if (fBI->fDictionaryCharCount != 0) {
+        if (fBI->fDictionaryCharCount != 0 && fBI->ensureDictionaryCache()) {
             // Segment from the rules includes dictionary characters.
             // Subdivide it, with subdivided results going into the dictionary cache.
             int32_t dictSegEndPosition = position;
@@ -17,6 +17,7 @@
 #include "utypeinfo.h"  // for 'typeid' to work
 #include "unicode/utypes.h"
 #include "unicode/stringtriebuilder.h"
+#include "cmemory.h"
 #include "uassert.h"
 #include "uhash.h"
 
@@ -36,7 +37,69 @@ U_CDECL_END
 
 U_NAMESPACE_BEGIN
 
-StringTrieBuilder::StringTrieBuilder() : nodes(NULL) {}
+/**
+ * Bump allocator for the nodes of one compact build.
+ * Building a trie for a large set of strings creates millions of small nodes,
+ * many of which are immediately discarded as duplicates.
+ * Carving them out of large blocks avoids one heap allocation per node,
+ * and a discarded node is simply handed back if it was the last one allocated.
+ *
+ * The node destructors are trivial, so the blocks are freed without
+ * running them.
+ */
+class StringTrieNodeArena : public UMemory {
+public:
+    StringTrieNodeArena() : blocks(NULL), start(NULL), limit(NULL), lastNode(NULL) {}
+    ~StringTrieNodeArena() {
+        while(blocks!=NULL) {
+            Block *next=blocks->next;
+            uprv_free(blocks);
+            blocks=next;
+        }
+    }
+
+    void *allocate(size_t size) {
+        size=(size+kAlignment-1)&~(kAlignment-1);
+        if((size_t)(limit-start)<size) {
+            size_t blockSize=kBlockSize>size ? kBlockSize : size;
+            Block *block=(Block *)uprv_malloc(sizeof(Block)+blockSize);
+            if(block==NULL) {
+                return NULL;
+            }
+            block->next=blocks;
+            blocks=block;
+            start=(char *)(block+1);
+            limit=start+blockSize;
+        }
+        lastNode=start;
+        start+=size;
+        return lastNode;
+    }
+
+    void release(void *p) {
+        if(p!=NULL && p==lastNode) {
+            start=lastNode;
+            lastNode=NULL;
+        }
+    }
+
+private:
+    // The union pads the block header so that nodes are suitably aligned.
+    union Block {
+        Block *next;
+        double d;
+        int64_t i;
+    };
+    static const size_t kAlignment=sizeof(Block);
+    static const size_t kBlockSize=64*1024;
+
+    Block *blocks;
+    char *start;
+    char *limit;
+    char *lastNode;
+};
+
+StringTrieBuilder::StringTrieBuilder() : nodes(NULL), nodeArena(NULL) {}
 
 StringTrieBuilder::~StringTrieBuilder() {
     deleteCompactBuilder();
@@ -50,10 +113,10 @@ StringTrieBuilder::createCompactBuilder(int32_t sizeGuess, UErrorCode &errorCode
     nodes=uhash_openSize(hashStringTrieNode, equalStringTrieNodes, NULL,
                          sizeGuess, &errorCode);
     if(U_SUCCESS(errorCode)) {
-        if(nodes==NULL) {
+        // The nodes are owned by the arena, not by the hash table.
+        nodeArena=new StringTrieNodeArena();
+        if(nodes==NULL || nodeArena==NULL) {
           errorCode=U_MEMORY_ALLOCATION_ERROR;
-        } else {
-          uhash_setKeyDeleter(nodes, uprv_deleteUObject);
         }
     }
 }
@@ -62,6 +125,21 @@ void
 StringTrieBuilder::deleteCompactBuilder() {
     uhash_close(nodes);
     nodes=NULL;
+    delete nodeArena;
+    nodeArena=NULL;
+}
+
+void *
+StringTrieBuilder::allocateNode(size_t size) const {
+    return nodeArena->allocate(size);
+}
+
+void
+StringTrieBuilder::releaseNode(Node *node) {
+    if(node!=NULL) {
+        node->~Node();
+        nodeArena->release(node);
+    }
 }
 
 void
@@ -242,13 +320,14 @@ StringTrieBuilder::makeNode(int32_t start, int32_t limit, int32_t unitIndex, UEr
         int32_t length=countElementUnits(start, limit, unitIndex);
         // length>=2 because minUnit!=maxUnit.
         Node *subNode=makeBranchSubNode(start, limit, unitIndex, length, errorCode);
-        node=new BranchHeadNode(length, subNode);
+        node=new(allocateNode(sizeof(BranchHeadNode))) BranchHeadNode(length, subNode);
     }
     if(hasValue && node!=NULL) {
         if(matchNodesCanHaveValues()) {
             ((ValueNode *)node)->setValue(value);
         } else {
-            node=new IntermediateValueNode(value, registerNode(node, errorCode));
+            node=registerNode(node, errorCode);
+            node=new(allocateNode(sizeof(IntermediateValueNode))) IntermediateValueNode(value, node);
         }
     }
     return registerNode(node, errorCode);
@@ -280,11 +359,10 @@ StringTrieBuilder::makeBranchSubNode(int32_t start, int32_t limit, int32_t unitI
     if(U_FAILURE(errorCode)) {
         return NULL;
     }
-    ListBranchNode *listNode=new ListBranchNode();
-    if(listNode==NULL) {
-        errorCode=U_MEMORY_ALLOCATION_ERROR;
-        return NULL;
-    }
+    // Fill in the list node on the stack and copy it into the arena only after
+    // its sub-nodes have been made, so that releasing it as a duplicate
+    // can reuse its memory.
+    ListBranchNode listNode;
     // For each unit, find its elements array start and whether it has a final value.
     int32_t unitNumber=0;
     do {
@@ -292,25 +370,27 @@ StringTrieBuilder::makeBranchSubNode(int32_t start, int32_t limit, int32_t unitI
         UChar unit=getElementUnit(i++, unitIndex);
         i=indexOfElementWithNextUnit(i, unitIndex, unit);
         if(start==i-1 && unitIndex+1==getElementStringLength(start)) {
-            listNode->add(unit, getElementValue(start));
+            listNode.add(unit, getElementValue(start));
         } else {
-            listNode->add(unit, makeNode(start, i, unitIndex+1, errorCode));
+            listNode.add(unit, makeNode(start, i, unitIndex+1, errorCode));
         }
         start=i;
     } while(++unitNumber<length-1);
     // unitNumber==length-1, and the maxUnit elements range is [start..limit[
     UChar unit=getElementUnit(start, unitIndex);
     if(start==limit-1 && unitIndex+1==getElementStringLength(start)) {
-        listNode->add(unit, getElementValue(start));
+        listNode.add(unit, getElementValue(start));
     } else {
-        listNode->add(unit, makeNode(start, limit, unitIndex+1, errorCode));
+        listNode.add(unit, makeNode(start, limit, unitIndex+1, errorCode));
     }
-    Node *node=registerNode(listNode, errorCode);
+    Node *node=registerNode(
+        new(allocateNode(sizeof(ListBranchNode))) ListBranchNode(listNode), errorCode);
     // Create the split-branch nodes.
     while(ltLength>0) {
         --ltLength;
         node=registerNode(
-            new SplitBranchNode(middleUnits[ltLength], lessThan[ltLength], node), errorCode);
+            new(allocateNode(sizeof(SplitBranchNode)))
+                SplitBranchNode(middleUnits[ltLength], lessThan[ltLength], node), errorCode);
     }
     return node;
 }
@@ -318,7 +398,7 @@ StringTrieBuilder::makeBranchSubNode(int32_t start, int32_t limit, int32_t unitI
 StringTrieBuilder::Node *
 StringTrieBuilder::registerNode(Node *newNode, UErrorCode &errorCode) {
     if(U_FAILURE(errorCode)) {
-        delete newNode;
+        releaseNode(newNode);
         return NULL;
     }
     if(newNode==NULL) {
@@ -327,7 +407,7 @@ StringTrieBuilder::registerNode(Node *newNode, UErrorCode &errorCode) {
     }
     const UHashElement *old=uhash_find(nodes, newNode);
     if(old!=NULL) {
-        delete newNode;
+        releaseNode(newNode);
         return (Node *)old->key.pointer;
     }
     // If uhash_puti() returns a non-zero value from an equivalent, previously
@@ -338,7 +418,7 @@ StringTrieBuilder::registerNode(Node *newNode, UErrorCode &errorCode) {
     uhash_puti(nodes, newNode, 1, &errorCode);
     U_ASSERT(oldValue==0);
     if(U_FAILURE(errorCode)) {
-        delete newNode;
+        releaseNode(newNode);
         return NULL;
     }
     return newNode;
@@ -354,7 +434,7 @@ StringTrieBuilder::registerFinalValue(int32_t value, UErrorCode &errorCode) {
     if(old!=NULL) {
         return (Node *)old->key.pointer;
     }
-    Node *newNode=new FinalValueNode(value);
+    Node *newNode=new(allocateNode(sizeof(FinalValueNode))) FinalValueNode(value);
     if(newNode==NULL) {
         errorCode=U_MEMORY_ALLOCATION_ERROR;
         return NULL;
@@ -367,13 +447,13 @@ StringTrieBuilder::registerFinalValue(int32_t value, UErrorCode &errorCode) {
     uhash_puti(nodes, newNode, 1, &errorCode);
     U_ASSERT(oldValue==0);
     if(U_FAILURE(errorCode)) {
-        delete newNode;
+        releaseNode(newNode);
         return NULL;
     }
     return newNode;
 }
 
-UBool
+int32_t
 StringTrieBuilder::hashNode(const void *node) {
     return ((const Node *)node)->hashCode();
 }
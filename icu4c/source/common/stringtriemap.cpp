@@ -0,0 +1,387 @@
+// © 2018 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+/*
+*******************************************************************************
+*   file name:  stringtriemap.cpp
+*   encoding:   UTF-8
+*   tab size:   8 (not used)
+*   indentation:4
+*/
+
+#include "unicode/utypes.h"
+#include "unicode/stringtriemap.h"
+#include "unicode/ucharstrie.h"
+#include "unicode/ucharstriebuilder.h"
+#include "unicode/ustring.h"
+#include "unicode/utf8.h"
+#include "charstr.h"
+#include "cmemory.h"
+#include "uvectr32.h"
+
+U_NAMESPACE_BEGIN
+
+namespace {
+
+/*
+ * Serialized format, in the platform endianness:
+ *
+ * int32_t indexes[IX_COUNT];
+ * char16_t trie[indexes[IX_TRIE_LENGTH]];  -- UCharsTrie mapping keys to value indexes,
+ *                                          -- padded to a multiple of 4 bytes
+ * int32_t valueOffsets[indexes[IX_VALUE_COUNT]+1];  -- value i is
+ *                                          -- values[valueOffsets[i]..valueOffsets[i+1]-1]
+ * char values[];                           -- padded to a multiple of 4 bytes
+ *
+ * All offsets in indexes[] are byte offsets from the start of the data.
+ */
+enum {
+    IX_SIGNATURE,
+    IX_TRIE_OFFSET,
+    IX_TRIE_LENGTH,
+    IX_VALUE_OFFSETS_OFFSET,
+    IX_VALUES_OFFSET,
+    IX_VALUE_COUNT,
+    IX_TOTAL_SIZE,
+    IX_RESERVED7,
+    IX_COUNT
+};
+
+const int32_t SIGNATURE = 0x53544d31;  // "STM1"
+
+}  // namespace
+
+StringTrieMap::StringTrieMap(const uint8_t *data, uint8_t *ownedData)
+        : memory(data), ownedMemory(ownedData) {
+    const int32_t *indexes = reinterpret_cast<const int32_t *>(data);
+    trieUChars = indexes[IX_TRIE_LENGTH] > 0 ?
+        reinterpret_cast<const UChar *>(data + indexes[IX_TRIE_OFFSET]) : NULL;
+    valueOffsets = reinterpret_cast<const int32_t *>(data + indexes[IX_VALUE_OFFSETS_OFFSET]);
+    values = reinterpret_cast<const char *>(data + indexes[IX_VALUES_OFFSET]);
+    valueCount = indexes[IX_VALUE_COUNT];
+    totalSize = indexes[IX_TOTAL_SIZE];
+}
+
+StringTrieMap::~StringTrieMap() {
+    uprv_free(ownedMemory);
+}
+
+UBool StringTrieMap::isValid(const uint8_t *data, int32_t length) {
+    if (length < (int32_t)(IX_COUNT * 4)) {
+        return FALSE;
+    }
+    const int32_t *indexes = reinterpret_cast<const int32_t *>(data);
+    int32_t trieOffset = indexes[IX_TRIE_OFFSET];
+    int32_t trieLength = indexes[IX_TRIE_LENGTH];
+    int32_t offsetsOffset = indexes[IX_VALUE_OFFSETS_OFFSET];
+    int32_t valuesOffset = indexes[IX_VALUES_OFFSET];
+    int32_t count = indexes[IX_VALUE_COUNT];
+    int32_t size = indexes[IX_TOTAL_SIZE];
+    if (indexes[IX_SIGNATURE] != SIGNATURE ||
+            size > length || trieOffset != (int32_t)(IX_COUNT * 4) ||
+            trieLength < 0 || trieLength > (size - trieOffset) / 2 ||
+            (count > 0) != (trieLength > 0) ||
+            offsetsOffset < trieOffset + trieLength * 2 || (offsetsOffset & 3) != 0 ||
+            count < 0 || count >= (size - offsetsOffset) / 4 ||
+            valuesOffset != offsetsOffset + (count + 1) * 4) {
+        return FALSE;
+    }
+    const int32_t *offsets = reinterpret_cast<const int32_t *>(data + offsetsOffset);
+    if (offsets[0] != 0) {
+        return FALSE;
+    }
+    for (int32_t i = 0; i < count; ++i) {
+        if (offsets[i + 1] < offsets[i]) {
+            return FALSE;
+        }
+    }
+    return offsets[count] <= size - valuesOffset;
+}
+
+StringTrieMap *
+StringTrieMap::openFromMemory(const void *data, int32_t length, UErrorCode &errorCode) {
+    if (U_FAILURE(errorCode)) {
+        return NULL;
+    }
+    if (data == NULL || length < 0 || (U_POINTER_MASK_LSB(data, 3) != 0)) {
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return NULL;
+    }
+    const uint8_t *bytes = static_cast<const uint8_t *>(data);
+    if (!isValid(bytes, length)) {
+        errorCode = U_INVALID_FORMAT_ERROR;
+        return NULL;
+    }
+    StringTrieMap *map = new StringTrieMap(bytes, NULL);
+    if (map == NULL) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+    }
+    return map;
+}
+
+StringPiece StringTrieMap::getValue(int32_t valueIndex) const {
+    if (valueIndex < 0 || valueIndex >= valueCount) {
+        return StringPiece();
+    }
+    return StringPiece(values + valueOffsets[valueIndex],
+                       valueOffsets[valueIndex + 1] - valueOffsets[valueIndex]);
+}
+
+int32_t StringTrieMap::find(const UnicodeString &key) const {
+    if (trieUChars == NULL) {
+        return -1;
+    }
+    UCharsTrie trie(trieUChars);
+    UStringTrieResult result = trie.next(key.getBuffer(), key.length());
+    return USTRINGTRIE_HAS_VALUE(result) ? trie.getValue() : -1;
+}
+
+int32_t StringTrieMap::findUTF8(StringPiece key) const {
+    if (trieUChars == NULL) {
+        return -1;
+    }
+    UCharsTrie trie(trieUChars);
+    UStringTrieResult result = trie.current();
+    const uint8_t *s = reinterpret_cast<const uint8_t *>(key.data());
+    int32_t length = key.length();
+    for (int32_t i = 0; i < length;) {
+        UChar32 c;
+        U8_NEXT(s, i, length, c);
+        if (c < 0) {
+            return -1;
+        }
+        result = trie.nextForCodePoint(c);
+        if (result == USTRINGTRIE_NO_MATCH) {
+            return -1;
+        }
+    }
+    return USTRINGTRIE_HAS_VALUE(result) ? trie.getValue() : -1;
+}
+
+void StringTrieMap::findAll(const UnicodeString keys[], int32_t count, int32_t valueIndexes[]) const {
+    for (int32_t i = 0; i < count; ++i) {
+        valueIndexes[i] = find(keys[i]);
+    }
+}
+
+void StringTrieMap::findAllUTF8(const StringPiece keys[], int32_t count, int32_t valueIndexes[]) const {
+    for (int32_t i = 0; i < count; ++i) {
+        valueIndexes[i] = findUTF8(keys[i]);
+    }
+}
+
+int32_t StringTrieMap::matchLongest(const UChar *s, int32_t length, int32_t &matchLength) const {
+    matchLength = 0;
+    if (trieUChars == NULL) {
+        return -1;
+    }
+    if (length < 0) {
+        length = u_strlen(s);
+    }
+    UCharsTrie trie(trieUChars);
+    UStringTrieResult result = trie.current();
+    int32_t valueIndex = USTRINGTRIE_HAS_VALUE(result) ? trie.getValue() : -1;
+    for (int32_t i = 0; i < length;) {
+        result = trie.next(s[i++]);
+        if (USTRINGTRIE_HAS_VALUE(result)) {
+            valueIndex = trie.getValue();
+            matchLength = i;
+        }
+        if (!USTRINGTRIE_HAS_NEXT(result)) {
+            break;
+        }
+    }
+    return valueIndex;
+}
+
+int32_t StringTrieMap::matchLongestUTF8(StringPiece s, int32_t &matchLength) const {
+    matchLength = 0;
+    if (trieUChars == NULL) {
+        return -1;
+    }
+    UCharsTrie trie(trieUChars);
+    UStringTrieResult result = trie.current();
+    int32_t valueIndex = USTRINGTRIE_HAS_VALUE(result) ? trie.getValue() : -1;
+    const uint8_t *p = reinterpret_cast<const uint8_t *>(s.data());
+    int32_t length = s.length();
+    for (int32_t i = 0; i < length;) {
+        UChar32 c;
+        U8_NEXT(p, i, length, c);
+        if (c < 0) {
+            break;
+        }
+        result = trie.nextForCodePoint(c);
+        if (USTRINGTRIE_HAS_VALUE(result)) {
+            valueIndex = trie.getValue();
+            matchLength = i;
+        }
+        if (!USTRINGTRIE_HAS_NEXT(result)) {
+            break;
+        }
+    }
+    return valueIndex;
+}
+
+int32_t StringTrieMap::matchAll(const UChar *s, int32_t length,
+                                int32_t *matchLengths, int32_t *valueIndexes, int32_t capacity) const {
+    if (trieUChars == NULL) {
+        return 0;
+    }
+    if (length < 0) {
+        length = u_strlen(s);
+    }
+    UCharsTrie trie(trieUChars);
+    UStringTrieResult result = trie.current();
+    int32_t count = 0;
+    if (USTRINGTRIE_HAS_VALUE(result)) {
+        if (count < capacity) {
+            matchLengths[count] = 0;
+            valueIndexes[count] = trie.getValue();
+        }
+        ++count;
+    }
+    for (int32_t i = 0; i < length;) {
+        result = trie.next(s[i++]);
+        if (USTRINGTRIE_HAS_VALUE(result)) {
+            if (count < capacity) {
+                matchLengths[count] = i;
+                valueIndexes[count] = trie.getValue();
+            }
+            ++count;
+        }
+        if (!USTRINGTRIE_HAS_NEXT(result)) {
+            break;
+        }
+    }
+    return count;
+}
+
+int32_t StringTrieMap::matchAllUTF8(StringPiece s,
+                                    int32_t *matchLengths, int32_t *valueIndexes, int32_t capacity) const {
+    if (trieUChars == NULL) {
+        return 0;
+    }
+    UCharsTrie trie(trieUChars);
+    UStringTrieResult result = trie.current();
+    int32_t count = 0;
+    if (USTRINGTRIE_HAS_VALUE(result)) {
+        if (count < capacity) {
+            matchLengths[count] = 0;
+            valueIndexes[count] = trie.getValue();
+        }
+        ++count;
+    }
+    const uint8_t *p = reinterpret_cast<const uint8_t *>(s.data());
+    int32_t length = s.length();
+    for (int32_t i = 0; i < length;) {
+        UChar32 c;
+        U8_NEXT(p, i, length, c);
+        if (c < 0) {
+            break;
+        }
+        result = trie.nextForCodePoint(c);
+        if (USTRINGTRIE_HAS_VALUE(result)) {
+            if (count < capacity) {
+                matchLengths[count] = i;
+                valueIndexes[count] = trie.getValue();
+            }
+            ++count;
+        }
+        if (!USTRINGTRIE_HAS_NEXT(result)) {
+            break;
+        }
+    }
+    return count;
+}
+
+StringTrieMapBuilder::StringTrieMapBuilder(UErrorCode &errorCode)
+        : trieBuilder(NULL), values(NULL), valueOffsets(NULL) {
+    if (U_FAILURE(errorCode)) {
+        return;
+    }
+    trieBuilder = new UCharsTrieBuilder(errorCode);
+    values = new CharString();
+    valueOffsets = new UVector32(errorCode);
+    if (trieBuilder == NULL || values == NULL || valueOffsets == NULL) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    valueOffsets->addElement(0, errorCode);
+}
+
+StringTrieMapBuilder::~StringTrieMapBuilder() {
+    delete trieBuilder;
+    delete values;
+    delete valueOffsets;
+}
+
+StringTrieMapBuilder &
+StringTrieMapBuilder::add(const UnicodeString &key, StringPiece value, UErrorCode &errorCode) {
+    if (U_FAILURE(errorCode)) {
+        return *this;
+    }
+    if (trieBuilder == NULL) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+        return *this;
+    }
+    trieBuilder->add(key, valueOffsets->size() - 1, errorCode);
+    values->append(value.data(), value.length(), errorCode);
+    valueOffsets->addElement(values->length(), errorCode);
+    return *this;
+}
+
+StringTrieMapBuilder &StringTrieMapBuilder::clear() {
+    if (trieBuilder != NULL) {
+        trieBuilder->clear();
+        values->clear();
+        valueOffsets->setSize(1);
+    }
+    return *this;
+}
+
+StringTrieMap *
+StringTrieMapBuilder::build(UStringTrieBuildOption buildOption, UErrorCode &errorCode) {
+    if (U_FAILURE(errorCode)) {
+        return NULL;
+    }
+    if (trieBuilder == NULL) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+        return NULL;
+    }
+    int32_t count = valueOffsets->size() - 1;
+    UnicodeString trie;
+    if (count > 0) {
+        trieBuilder->buildUnicodeString(buildOption, trie, errorCode);
+        if (U_FAILURE(errorCode)) {
+            return NULL;
+        }
+    }
+    int32_t trieOffset = IX_COUNT * 4;
+    int32_t offsetsOffset = trieOffset + ((trie.length() * 2 + 3) & ~3);
+    int32_t valuesOffset = offsetsOffset + (count + 1) * 4;
+    int32_t totalSize = (valuesOffset + values->length() + 3) & ~3;
+    uint8_t *data = static_cast<uint8_t *>(uprv_malloc(totalSize));
+    if (data == NULL) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+        return NULL;
+    }
+    uprv_memset(data, 0, totalSize);
+    int32_t *indexes = reinterpret_cast<int32_t *>(data);
+    indexes[IX_SIGNATURE] = SIGNATURE;
+    indexes[IX_TRIE_OFFSET] = trieOffset;
+    indexes[IX_TRIE_LENGTH] = trie.length();
+    indexes[IX_VALUE_OFFSETS_OFFSET] = offsetsOffset;
+    indexes[IX_VALUES_OFFSET] = valuesOffset;
+    indexes[IX_VALUE_COUNT] = count;
+    indexes[IX_TOTAL_SIZE] = totalSize;
+    uprv_memcpy(data + trieOffset, trie.getBuffer(), trie.length() * 2);
+    uprv_memcpy(data + offsetsOffset, valueOffsets->getBuffer(), (count + 1) * 4);
+    uprv_memcpy(data + valuesOffset, values->data(), values->length());
+    StringTrieMap *map = new StringTrieMap(data, data);
+    if (map == NULL) {
+        uprv_free(data);
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+    }
+    return map;
+}
+
+U_NAMESPACE_END
@@ -295,6 +295,13 @@ ubrk_getRuleStatusVec(UBreakIterator *bi, int32_t *fillInVec, int32_t capacity,
 }
 
 
+U_CAPI int32_t U_EXPORT2
+ubrk_getBoundaries(UBreakIterator *bi, int32_t *fillInVec, int32_t capacity, UErrorCode *status)
+{
+    return ((BreakIterator*)bi)->getBoundaries(fillInVec, capacity, *status);
+}
+
+
 U_CAPI const char* U_EXPORT2
 ubrk_getLocaleByType(const UBreakIterator *bi,
                      ULocDataLocaleType type,
@@ -82,7 +82,20 @@ UCharsTrieElement::setTo(const UnicodeString &s, int32_t val,
 
 int32_t
 UCharsTrieElement::compareStringTo(const UCharsTrieElement &other, const UnicodeString &strings) const {
-    return getString(strings).compare(other.getString(strings));
+    // Compare the units in place rather than via temporary UnicodeString objects:
+    // This is the sort comparator, called O(n log n) times.
+    const UChar *buffer=strings.getBuffer();
+    const UChar *s=buffer+stringOffset;
+    const UChar *t=buffer+other.stringOffset;
+    int32_t length=*s++;
+    int32_t otherLength=*t++;
+    int32_t commonLength=length<=otherLength ? length : otherLength;
+    for(int32_t i=0; i<commonLength; ++i) {
+        if(s[i]!=t[i]) {
+            return (int32_t)s[i]-(int32_t)t[i];
+        }
+    }
+    return length-otherLength;
 }
 
 UCharsTrieBuilder::UCharsTrieBuilder(UErrorCode & /*errorCode*/)
@@ -186,22 +199,37 @@ UCharsTrieBuilder::buildUChars(UStringTrieBuildOption buildOption, UErrorCode &e
             errorCode=U_MEMORY_ALLOCATION_ERROR;
             return;
         }
-        uprv_sortArray(elements, elementsLength, (int32_t)sizeof(UCharsTrieElement),
-                      compareElementStrings, &strings,
-                      FALSE,  // need not be a stable sort
-                      &errorCode);
-        if(U_FAILURE(errorCode)) {
-            return;
-        }
-        // Duplicate strings are not allowed.
-        UnicodeString prev=elements[0].getString(strings);
+        // Large inputs often come from sorted word lists.
+        // Skip the sort if the strings were added in order;
+        // this linear pass also finds adjacent duplicates.
+        UBool isSorted=TRUE;
         for(int32_t i=1; i<elementsLength; ++i) {
-            UnicodeString current=elements[i].getString(strings);
-            if(prev==current) {
-                errorCode=U_ILLEGAL_ARGUMENT_ERROR;
+            int32_t diff=elements[i-1].compareStringTo(elements[i], strings);
+            if(diff>=0) {
+                if(diff==0) {
+                    // Duplicate strings are not allowed.
+                    errorCode=U_ILLEGAL_ARGUMENT_ERROR;
+                    return;
+                }
+                isSorted=FALSE;
+                break;
+            }
+        }
+        if(!isSorted) {
+            uprv_sortArray(elements, elementsLength, (int32_t)sizeof(UCharsTrieElement),
+                          compareElementStrings, &strings,
+                          FALSE,  // need not be a stable sort
+                          &errorCode);
+            if(U_FAILURE(errorCode)) {
                 return;
             }
-            prev.fastCopyFrom(current);
+            // Duplicate strings are not allowed.
+            for(int32_t i=1; i<elementsLength; ++i) {
+                if(elements[i-1].compareStringTo(elements[i], strings)==0) {
+                    errorCode=U_ILLEGAL_ARGUMENT_ERROR;
+                    return;
+                }
+            }
         }
     }
     // Create and UChar-serialize the trie for the elements.
@@ -313,7 +341,7 @@ UCharsTrieBuilder::UCTLinearMatchNode::write(StringTrieBuilder &builder) {
 StringTrieBuilder::Node *
 UCharsTrieBuilder::createLinearMatchNode(int32_t i, int32_t unitIndex, int32_t length,
                                          Node *nextNode) const {
-    return new UCTLinearMatchNode(
+    return new(allocateNode(sizeof(UCTLinearMatchNode))) UCTLinearMatchNode(
             elements[i].getString(strings).getBuffer()+unitIndex,
             length,
             nextNode);
@@ -2522,6 +2522,54 @@ ucnv_convert(const char *toConverterName, const char *fromConverterName,
     return targetLength;
 }
 
+U_CAPI int32_t U_EXPORT2
+ucnv_convertToUChars(const char *converterName,
+                     UChar *dest, int32_t destCapacity,
+                     const char *src, int32_t srcLength,
+                     UErrorCode *pErrorCode) {
+    UConverter stackCnv; /* stack-allocated */
+    UConverter *cnv;
+    int32_t destLength;
+
+    if(pErrorCode==NULL || U_FAILURE(*pErrorCode)) {
+        return 0;
+    }
+
+    cnv=ucnv_createConverter(&stackCnv, converterName, pErrorCode);
+    if(U_FAILURE(*pErrorCode)) {
+        return 0;
+    }
+
+    destLength=ucnv_toUChars(cnv, dest, destCapacity, src, srcLength, pErrorCode);
+
+    ucnv_close(cnv);
+    return destLength;
+}
+
+U_CAPI int32_t U_EXPORT2
+ucnv_convertFromUChars(const char *converterName,
+                       char *dest, int32_t destCapacity,
+                       const UChar *src, int32_t srcLength,
+                       UErrorCode *pErrorCode) {
+    UConverter stackCnv; /* stack-allocated */
+    UConverter *cnv;
+    int32_t destLength;
+
+    if(pErrorCode==NULL || U_FAILURE(*pErrorCode)) {
+        return 0;
+    }
+
+    cnv=ucnv_createConverter(&stackCnv, converterName, pErrorCode);
+    if(U_FAILURE(*pErrorCode)) {
+        return 0;
+    }
+
+    destLength=ucnv_fromUChars(cnv, dest, destCapacity, src, srcLength, pErrorCode);
+
+    ucnv_close(cnv);
+    return destLength;
+}
+
 /* @internal */
 static int32_t
 ucnv_convertAlgorithmic(UBool convertToAlgorithmic,
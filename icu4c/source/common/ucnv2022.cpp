@@ -566,6 +566,17 @@ _ISO2022Open(UConverter *cnv, UConverterLoadArgs *pArgs, UErrorCode *errorCode){
                     return;
                 }
 
+                /*
+                 * The IBM-style ISO-2022-KR conversion functions run the subconverter
+                 * with args->converter set to it. Its default SUBSTITUTE callbacks
+                 * would make the MBCS code substitute inline with the subconverter's
+                 * settings; with STOP it returns all unassigned input to the
+                 * callbacks of this converter, as before inline handling.
+                 * (Like the ASCII subconverter in T_UConverter_toUnicode_ISO_2022_OFFSETS_LOGIC().)
+                 */
+                myConverterData->currentConverter->fromUCharErrorBehaviour = UCNV_FROM_U_CALLBACK_STOP;
+                myConverterData->currentConverter->fromCharErrorBehaviour = UCNV_TO_U_CALLBACK_STOP;
+
                 if(version==1) {
                     (void)uprv_strcpy(myConverterData->name,"ISO_2022,locale=ko,version=1");
                     uprv_memcpy(cnv->subChars, myConverterData->currentConverter->subChars, 4);
@@ -1695,6 +1706,71 @@ UConverter_fromUnicode_ISO_2022_JP_OFFSETS_LOGIC(UConverterFromUnicodeArgs* args
     while(source < sourceLimit) {
         if(target < targetLimit) {
 
+            /*
+             * Convert a run of characters that stay in the current G0 charset
+             * at once if possible: ASCII, or double-byte characters with
+             * round-trip mappings. Everything else goes through the choices below.
+             */
+            if(pFromU2022State->g == 0) {
+                const UChar *runStart = source;
+                cs = pFromU2022State->cs[0];
+                if(cs == ASCII) {
+                    int32_t count = (int32_t)(sourceLimit - source);
+                    if(count > (targetLimit - target)) {
+                        count = (int32_t)(targetLimit - target);
+                    }
+                    while(count > 0) {
+                        UChar c = *source;
+                        if(c > 0x7f || IS_2022_CONTROL(c)) {
+                            break;
+                        }
+                        if(c == CR || c == LF) {
+                            /* reset the G2 state at the end of a line */
+                            pFromU2022State->cs[2] = 0;
+                            choiceCount = 0;
+                        }
+                        *target++ = (uint8_t)c;
+                        if(offsets) {
+                            *offsets++ = (int32_t)(source - args->source);
+                        }
+                        ++source;
+                        --count;
+                    }
+                } else if(IS_JP_DBCS(cs)) {
+                    UConverterSharedData *sharedData = converterData->myConverterArray[cs];
+                    while(source < sourceLimit && (targetLimit - target) >= 2) {
+                        UChar c = *source;
+                        uint32_t value;
+                        if( U16_IS_SURROGATE(c) ||
+                            /* JIS7/8 prefer single-byte half-width Katakana */
+                            (uint32_t)(c - HWKANA_START) <= (HWKANA_END - HWKANA_START) ||
+                            MBCS_FROM_UCHAR32_ISO2022(sharedData, c, &value, FALSE, MBCS_OUTPUT_2) != 2
+                        ) {
+                            break;
+                        }
+                        if(cs == JISX208) {
+                            value = _2022FromSJIS(value);
+                        } else if(cs == KSC5601) {
+                            value = _2022FromGR94DBCS(value);
+                        }
+                        if(value == 0) {
+                            break;
+                        }
+                        *target++ = (uint8_t)(value >> 8);
+                        *target++ = (uint8_t)value;
+                        if(offsets) {
+                            int32_t sourceIndex = (int32_t)(source - args->source);
+                            *offsets++ = sourceIndex;
+                            *offsets++ = sourceIndex;
+                        }
+                        ++source;
+                    }
+                }
+                if(source != runStart) {
+                    continue;
+                }
+            }
+
             sourceChar  = *(source++);
             /*check if the char is a First surrogate*/
             if(U16_IS_SURROGATE(sourceChar)) {
@@ -2077,6 +2153,124 @@ getTrail:
 
 /*************** to unicode *******************/
 
+/*
+ * Run-based toUnicode fast paths, shared by the ISO-2022-JP, -KR and -CN converters.
+ * Text usually consists of long runs of ASCII or double-byte characters between
+ * escape and shift sequences. These functions convert such a run with direct
+ * table access, without the per-character state handling of the main loops.
+ * They stop before any byte that needs more than that (escape/shift sequences,
+ * CR/LF, illegal, unassigned or fallback mappings, end of a buffer)
+ * and leave it to the regular code.
+ *
+ * offsets is NULL or points to where the offset for the first output unit goes.
+ * Each function returns the new source pointer.
+ */
+
+/*
+ * Converts a run of ASCII bytes except for ISO 2022 controls and CR/LF.
+ * With a non-NULL sharedData, the bytes are looked up in its state table,
+ * otherwise they map to themselves.
+ */
+static const char *
+_2022ToUSingleByteRun(const UConverterSharedData *sharedData,
+                      const char *source, const char *sourceLimit,
+                      UChar **pTarget, const UChar *targetLimit,
+                      int32_t *offsets, int32_t sourceIndex) {
+    const int32_t *stateTable0 = sharedData != NULL ?
+        sharedData->mbcs.stateTable[sharedData->mbcs.dbcsOnlyState] : NULL;
+    UChar *target = *pTarget;
+    int32_t count = (int32_t)(sourceLimit - source);
+    if(count > (targetLimit - target)) {
+        count = (int32_t)(targetLimit - target);
+    }
+    while(count > 0) {
+        uint8_t b = (uint8_t)*source;
+        UChar c;
+        if(b > 0x7f || (b <= ESC_2022 && (IS_2022_CONTROL(b) || b == CR || b == LF))) {
+            break;
+        }
+        if(stateTable0 == NULL) {
+            c = b;
+        } else {
+            int32_t entry = stateTable0[b];
+            if(!MBCS_ENTRY_FINAL_IS_VALID_DIRECT_16(entry)) {
+                break;
+            }
+            c = (UChar)MBCS_ENTRY_FINAL_VALUE_16(entry);
+        }
+        *target++ = c;
+        ++source;
+        if(offsets != NULL) {
+            *offsets++ = sourceIndex++;
+        }
+        --count;
+    }
+    *pTarget = target;
+    return source;
+}
+
+/* forms of ISO 2022 double-byte characters in the underlying MBCS tables */
+enum {
+    DBCS_FORM_GL,   /* bytes 21..7E as is */
+    DBCS_FORM_GR,   /* bytes A1..FE (EUC) */
+    DBCS_FORM_SJIS  /* Shift-JIS */
+};
+
+/*
+ * Converts a run of double-byte characters with both bytes in 21..7E.
+ * For CNS 11643, prefix is the plane byte 0x80+n that precedes each pair
+ * in the table, otherwise it is negative.
+ */
+static const char *
+_2022ToUDBCSRun(const UConverterSharedData *sharedData, int32_t prefix, int32_t form,
+                const char *source, const char *sourceLimit,
+                UChar **pTarget, const UChar *targetLimit,
+                int32_t *offsets, int32_t sourceIndex) {
+    const UConverterMBCSTable *mbcsTable = &sharedData->mbcs;
+    UChar *target = *pTarget;
+    uint8_t state = mbcsTable->dbcsOnlyState;
+    uint32_t offset = 0;
+
+    if(prefix >= 0) {
+        int32_t entry = mbcsTable->stateTable[state][prefix];
+        if(!MBCS_ENTRY_IS_TRANSITION(entry)) {
+            return source;
+        }
+        state = (uint8_t)MBCS_ENTRY_TRANSITION_STATE(entry);
+        offset = MBCS_ENTRY_TRANSITION_OFFSET(entry);
+    }
+
+    while(target < targetLimit && (sourceLimit - source) >= 2) {
+        uint8_t lead = (uint8_t)source[0];
+        uint8_t trail = (uint8_t)source[1];
+        UChar c;
+        if((uint8_t)(lead - 0x21) > (0x7e - 0x21) || (uint8_t)(trail - 0x21) > (0x7e - 0x21)) {
+            break;
+        }
+        if(form == DBCS_FORM_GR) {
+            lead += 0x80;
+            trail += 0x80;
+        } else if(form == DBCS_FORM_SJIS) {
+            char bytes[2];
+            _2022ToSJIS(lead, trail, bytes);
+            lead = (uint8_t)bytes[0];
+            trail = (uint8_t)bytes[1];
+        }
+        c = ucnv_MBCSSimpleGetNextDBCS(mbcsTable, state, offset, lead, trail);
+        if(c >= 0xfffe) {
+            break;
+        }
+        *target++ = c;
+        source += 2;
+        if(offsets != NULL) {
+            *offsets++ = sourceIndex;
+            sourceIndex += 2;
+        }
+    }
+    *pTarget = target;
+    return source;
+}
+
 static void U_CALLCONV
 UConverter_toUnicode_ISO_2022_JP_OFFSETS_LOGIC(UConverterToUnicodeArgs *args,
                                                UErrorCode* err){
@@ -2112,6 +2306,30 @@ UConverter_toUnicode_ISO_2022_JP_OFFSETS_LOGIC(UConverterToUnicodeArgs *args,
 
         if(myTarget < args->targetLimit){
 
+            /* convert a run of ASCII or double-byte characters at once if possible */
+            cs = (StateEnum)pToU2022State->cs[pToU2022State->g];
+            if(cs == ASCII || IS_JP_DBCS(cs)) {
+                const char *runStart = mySource;
+                int32_t *offsets = args->offsets != NULL ? args->offsets + (myTarget - args->target) : NULL;
+                int32_t sourceIndex = (int32_t)(mySource - args->source);
+                if(cs == ASCII) {
+                    mySource = _2022ToUSingleByteRun(NULL, mySource, mySourceLimit,
+                                                     &myTarget, args->targetLimit,
+                                                     offsets, sourceIndex);
+                } else {
+                    mySource = _2022ToUDBCSRun(myData->myConverterArray[cs], -1,
+                                               cs == JISX208 ? DBCS_FORM_SJIS :
+                                                   cs == KSC5601 ? DBCS_FORM_GR : DBCS_FORM_GL,
+                                               mySource, mySourceLimit,
+                                               &myTarget, args->targetLimit,
+                                               offsets, sourceIndex);
+                }
+                if(mySource != runStart) {
+                    myData->isEmptySegment = FALSE;
+                    continue;
+                }
+            }
+
             mySourceChar= (unsigned char) *mySource++;
 
             switch(mySourceChar) {
@@ -2707,6 +2925,27 @@ UConverter_toUnicode_ISO_2022_KR_OFFSETS_LOGIC(UConverterToUnicodeArgs *args,
 
         if(myTarget < args->targetLimit){
 
+            /* convert a run of single-byte or double-byte characters at once if possible */
+            {
+                const char *runStart = mySource;
+                int32_t *offsets = args->offsets != NULL ? args->offsets + (myTarget - args->target) : NULL;
+                int32_t sourceIndex = (int32_t)(mySource - args->source);
+                if(myData->toU2022State.g == 1) {
+                    mySource = _2022ToUDBCSRun(sharedData, -1, DBCS_FORM_GR,
+                                               mySource, mySourceLimit,
+                                               &myTarget, args->targetLimit,
+                                               offsets, sourceIndex);
+                } else {
+                    mySource = _2022ToUSingleByteRun(sharedData, mySource, mySourceLimit,
+                                                     &myTarget, args->targetLimit,
+                                                     offsets, sourceIndex);
+                }
+                if(mySource != runStart) {
+                    myData->isEmptySegment = FALSE;
+                    continue;
+                }
+            }
+
             mySourceChar= (unsigned char) *mySource++;
 
             if(mySourceChar==UCNV_SI){
@@ -3295,6 +3534,39 @@ UConverter_toUnicode_ISO_2022_CN_OFFSETS_LOGIC(UConverterToUnicodeArgs *args,
 
         if(myTarget < args->targetLimit){
 
+            /*
+             * Convert a run of ASCII or SO double-byte characters at once if possible.
+             * Single-shifted (SS2/SS3) characters are handled one at a time below.
+             */
+            if(pToU2022State->g <= 1) {
+                const char *runStart = mySource;
+                int32_t *offsets = args->offsets != NULL ? args->offsets + (myTarget - args->target) : NULL;
+                int32_t sourceIndex = (int32_t)(mySource - args->source);
+                if(pToU2022State->g == 0) {
+                    mySource = _2022ToUSingleByteRun(NULL, mySource, mySourceLimit,
+                                                     &myTarget, args->targetLimit,
+                                                     offsets, sourceIndex);
+                } else {
+                    StateEnum tempState = (StateEnum)pToU2022State->cs[1];
+                    if(tempState >= CNS_11643_0) {
+                        mySource = _2022ToUDBCSRun(myData->myConverterArray[CNS_11643],
+                                                   0x80 + (tempState - CNS_11643_0), DBCS_FORM_GL,
+                                                   mySource, mySourceLimit,
+                                                   &myTarget, args->targetLimit,
+                                                   offsets, sourceIndex);
+                    } else {
+                        mySource = _2022ToUDBCSRun(myData->myConverterArray[tempState], -1, DBCS_FORM_GL,
+                                                   mySource, mySourceLimit,
+                                                   &myTarget, args->targetLimit,
+                                                   offsets, sourceIndex);
+                    }
+                }
+                if(mySource != runStart) {
+                    myData->isEmptySegment = FALSE;
+                    continue;
+                }
+            }
+
             mySourceChar= (unsigned char) *mySource++;
 
             switch(mySourceChar){
@@ -198,6 +198,23 @@ static UMutex cnvCacheMutex = U_MUTEX_INITIALIZER;  /* Mutex for synchronizing c
                                                     /*  Note:  the global mutex is used for      */
                                                     /*         reference count updates.          */
 
+/*
+ * Small cache of recently loaded converter names without options,
+ * so that repeated opens by the same name skip parsing and the alias lookup.
+ * Protected by cnvCacheMutex; cleared by ucnv_flushCache() which may delete
+ * the shared data, and by ucnv_cleanup() which also unloads the alias data
+ * that canonicalName points into.
+ */
+#define UCNV_RECENT_NAMES_COUNT 16
+
+typedef struct UConverterRecentName {
+    char name[UCNV_MAX_CONVERTER_NAME_LENGTH];
+    const char *canonicalName;
+    UConverterSharedData *sharedData;
+} UConverterRecentName;
+
+static UConverterRecentName gRecentNames[UCNV_RECENT_NAMES_COUNT];
+
 static const char **gAvailableConverters = NULL;
 static uint16_t gAvailableConverterCount = 0;
 static icu::UInitOnce gAvailableConvertersInitOnce = U_INITONCE_INITIALIZER;
@@ -243,6 +260,7 @@ ucnv_flushAvailableConverterCache() {
 /*                Not supported API.                                          */
 static UBool U_CALLCONV ucnv_cleanup(void) {
     ucnv_flushCache();
+    uprv_memset(gRecentNames, 0, sizeof(gRecentNames));
     if (SHARED_DATA_HASHTABLE != NULL && uhash_count(SHARED_DATA_HASHTABLE) == 0) {
         uhash_close(SHARED_DATA_HASHTABLE);
         SHARED_DATA_HASHTABLE = NULL;
@@ -701,6 +719,25 @@ parseConverterOptions(const char *inName,
     }
 }
 
+/*
+ * Returns the gRecentNames slot for a converter name,
+ * or -1 if the name contains options or is too long to be cached.
+ */
+static int32_t
+getRecentNameSlot(const char *name) {
+    uint32_t hash = 0;
+    int32_t length = 0;
+    char c;
+
+    while((c = name[length]) != 0) {
+        if(c == UCNV_OPTION_SEP_CHAR || ++length >= UCNV_MAX_CONVERTER_NAME_LENGTH) {
+            return -1;
+        }
+        hash = hash * 37 + (uint8_t)c;
+    }
+    return (int32_t)(hash % UCNV_RECENT_NAMES_COUNT);
+}
+
 /*Logic determines if the converter is Algorithmic AND/OR cached
  *depending on that:
  * -we either go to get data from disk and cache it (Data=TRUE, Cached=False)
@@ -719,6 +756,7 @@ ucnv_loadSharedData(const char *converterName,
     UErrorCode internalErrorCode = U_ZERO_ERROR;
     UBool mayContainOption = TRUE;
     UBool checkForAlgorithmic = TRUE;
+    int32_t recentSlot = -1;
 
     if (U_FAILURE (*err)) {
         return NULL;
@@ -773,6 +811,23 @@ ucnv_loadSharedData(const char *converterName,
         return (UConverterSharedData *)converterData[UCNV_UTF8];
     }
     else {
+        /* fastpath for a name that was loaded recently */
+        if (!pArgs->onlyTestIsLoadable && (recentSlot = getRecentNameSlot(converterName)) >= 0) {
+            UConverterRecentName *recent = gRecentNames + recentSlot;
+            umtx_lock(&cnvCacheMutex);
+            if (recent->sharedData != NULL && uprv_strcmp(recent->name, converterName) == 0) {
+                mySharedConverterData = recent->sharedData;
+                if (mySharedConverterData->isReferenceCounted) {
+                    mySharedConverterData->referenceCounter++;
+                }
+                pArgs->name = recent->canonicalName;
+            }
+            umtx_unlock(&cnvCacheMutex);
+            if (mySharedConverterData != NULL) {
+                return mySharedConverterData;
+            }
+        }
+
         /* separate the converter name from the options */
         parseConverterOptions(converterName, pPieces, pArgs, err);
         if (U_FAILURE(*err)) {
@@ -790,6 +845,7 @@ ucnv_loadSharedData(const char *converterName,
             pArgs->name = pPieces->cnvName;
         } else if (internalErrorCode == U_AMBIGUOUS_ALIAS_WARNING) {
             *err = U_AMBIGUOUS_ALIAS_WARNING;
+            recentSlot = -1;  /* keep returning the warning */
         }
     }
 
@@ -821,6 +877,23 @@ ucnv_loadSharedData(const char *converterName,
         }
     }
 
+    /*
+     * Remember the name if it resolved to a canonical name without options.
+     * The canonical name must not point into the caller's pPieces.
+     */
+    if (recentSlot >= 0 && pArgs->name != pPieces->cnvName &&
+            pPieces->options == 0 && pPieces->locale[0] == 0) {
+        UConverterRecentName *recent = gRecentNames + recentSlot;
+        umtx_lock(&cnvCacheMutex);
+        if (!mySharedConverterData->isReferenceCounted || mySharedConverterData->sharedDataCached) {
+            uprv_strcpy(recent->name, converterName);
+            recent->canonicalName = pArgs->name;
+            recent->sharedData = mySharedConverterData;
+        }
+        umtx_unlock(&cnvCacheMutex);
+        ucln_common_registerCleanup(UCLN_COMMON_UCNV, ucnv_cleanup);
+    }
+
     return mySharedConverterData;
 }
 
@@ -1062,6 +1135,8 @@ ucnv_flushCache ()
     *                   is protected by cnvCacheMutex.
     */
     umtx_lock(&cnvCacheMutex);
+    /* The recently loaded names may refer to shared data that is about to be deleted. */
+    uprv_memset(gRecentNames, 0, sizeof(gRecentNames));
     /*
      * double loop: A delta/extension-only converter has a pointer to its base table's
      * shared data; the first iteration of the outer loop may see the delta converter
@@ -318,6 +318,33 @@ ucnv_toUWriteCodePoint(UConverter *cnv,
                        int32_t sourceIndex,
                        UErrorCode *pErrorCode);
 
+/**
+ * Return values for ucnv_getFromUUnassignedAction() and ucnv_getToUUnassignedAction():
+ * What the converter's callback would do for unassigned input.
+ * @internal
+ */
+enum {
+    UCNV_UNASSIGNED_CALLBACK,   /* return U_INVALID_CHAR_FOUND for the framework to call the callback */
+    UCNV_UNASSIGNED_SKIP,       /* write nothing and continue */
+    UCNV_UNASSIGNED_SUBSTITUTE  /* write the substitution character and continue */
+};
+
+/**
+ * For an unassigned code point c, determines whether the converter's
+ * fromUnicode callback is a built-in one that the converter can emulate inline.
+ * UCNV_UNASSIGNED_SUBSTITUTE is only returned for a codepage substitution
+ * character (cnv->subCharLen>0).
+ */
+U_CFUNC int32_t
+ucnv_getFromUUnassignedAction(const UConverter *cnv, UChar32 c);
+
+/**
+ * For an unassigned byte sequence, determines whether the converter's
+ * toUnicode callback is a built-in one that the converter can emulate inline.
+ */
+U_CFUNC int32_t
+ucnv_getToUUnassignedAction(const UConverter *cnv);
+
 #endif
 
 #endif /* UCNV_CNV */
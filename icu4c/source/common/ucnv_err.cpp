@@ -24,6 +24,7 @@
 #include "unicode/ucnv_err.h"
 #include "unicode/ucnv_cb.h"
 #include "ucnv_cnv.h"
+#include "ucnv_bld.h"
 #include "cmemory.h"
 #include "unicode/ucnv.h"
 #include "ustrfmt.h"
@@ -483,4 +484,53 @@ UCNV_TO_U_CALLBACK_ESCAPE (
     ucnv_cbToUWriteUChars(toArgs, uniValueString, valueStringLength, 0, err);
 }
 
+/*
+ * Converters call these for unassigned input before returning U_INVALID_CHAR_FOUND,
+ * so that they can skip or substitute inline when the converter uses
+ * one of the built-in callbacks which would do just that.
+ * Only the built-in callbacks are recognized, with contexts that affect unassigned input
+ * like the default (NULL or UCNV_SKIP_STOP_ON_ILLEGAL etc.).
+ * Everything else goes through the callback framework as before.
+ * In particular, the escape callbacks convert their escape sequence text
+ * through the converter itself (with a temporary substitution callback),
+ * and STOP is left alone so that a subconverter with STOP callbacks
+ * returns all unassigned input to its parent converter.
+ */
+U_CFUNC int32_t
+ucnv_getFromUUnassignedAction(const UConverter *cnv, UChar32 c) {
+    const char *context=(const char *)cnv->fromUContext;
+    if(cnv->fromUCharErrorBehaviour==UCNV_FROM_U_CALLBACK_SUBSTITUTE) {
+        if(IS_DEFAULT_IGNORABLE_CODE_POINT(c)) {
+            return UCNV_UNASSIGNED_SKIP;
+        } else if(context==NULL || *context==UCNV_PRV_STOP_ON_ILLEGAL) {
+            if(cnv->subCharLen>0) {
+                return UCNV_UNASSIGNED_SUBSTITUTE;
+            } else if(cnv->subCharLen==0) {
+                return UCNV_UNASSIGNED_SKIP;
+            }
+            /* a substitution string needs to be converted by the framework */
+        }
+    } else if(cnv->fromUCharErrorBehaviour==UCNV_FROM_U_CALLBACK_SKIP) {
+        if(IS_DEFAULT_IGNORABLE_CODE_POINT(c) ||
+            context==NULL || *context==UCNV_PRV_STOP_ON_ILLEGAL
+        ) {
+            return UCNV_UNASSIGNED_SKIP;
+        }
+    }
+    return UCNV_UNASSIGNED_CALLBACK;
+}
+
+U_CFUNC int32_t
+ucnv_getToUUnassignedAction(const UConverter *cnv) {
+    const char *context=(const char *)cnv->toUContext;
+    if(context==NULL || *context==UCNV_PRV_STOP_ON_ILLEGAL) {
+        if(cnv->fromCharErrorBehaviour==UCNV_TO_U_CALLBACK_SUBSTITUTE) {
+            return UCNV_UNASSIGNED_SUBSTITUTE;
+        } else if(cnv->fromCharErrorBehaviour==UCNV_TO_U_CALLBACK_SKIP) {
+            return UCNV_UNASSIGNED_SKIP;
+        }
+    }
+    return UCNV_UNASSIGNED_CALLBACK;
+}
+
 #endif
@@ -107,6 +107,41 @@ ucnv_extFindToU(const uint32_t *toUSection, int32_t length, uint8_t byte) {
     }
 }
 
+/*
+ * Hash index of the two-byte toUnicode mappings, see ucnv_extBuildToUIndex().
+ *
+ * toUIndex[0] is the shift value s for 2^s hash slots.
+ * Each slot is a pair of words at toUIndex[1+2*i]:
+ * The key (0 for an empty slot) and the section value as in the toUTable.
+ * Collisions are resolved with linear probing; the index is at most half full.
+ */
+#define UCNV_EXT_TO_U_INDEX_KEY(b0, b1) (0x10000|((uint32_t)(b0)<<8)|(b1))
+
+static inline uint32_t
+ucnv_extToUIndexHash(uint32_t key, int32_t shift) {
+    return (key*0x9e3779b1)>>(32-shift);
+}
+
+/*
+ * @return section value for the two bytes, if found; else 0
+ */
+static inline uint32_t
+ucnv_extFindToUIndex(const uint32_t *toUIndex, uint8_t b0, uint8_t b1) {
+    int32_t shift=(int32_t)toUIndex[0];
+    uint32_t key=UCNV_EXT_TO_U_INDEX_KEY(b0, b1);
+    uint32_t mask=((uint32_t)1<<shift)-1;
+    uint32_t i=ucnv_extToUIndexHash(key, shift);
+    for(;;) {
+        const uint32_t *slot=toUIndex+1+2*i;
+        if(slot[0]==key) {
+            return slot[1];
+        } else if(slot[0]==0) {
+            return 0;
+        }
+        i=(i+1)&mask;
+    }
+}
+
 /*
  * TRUE if not an SI/SO stateful converter,
  * or if the match length fits with the current converter state
@@ -117,11 +152,12 @@ ucnv_extFindToU(const uint32_t *toUSection, int32_t length, uint8_t byte) {
 /*
  * this works like ucnv_extMatchFromU() except
  * - the first character is in pre
- * - no trie is used
+ * - no trie is used, but complete two-byte mappings are looked up
+ *   in the optional toUIndex before walking the byte sections
  * - the returned matchLength is not offset by 2
  */
 static int32_t
-ucnv_extMatchToU(const int32_t *cx, int8_t sisoState,
+ucnv_extMatchToU(const int32_t *cx, const uint32_t *toUIndex, int8_t sisoState,
                  const char *pre, int32_t preLength,
                  const char *src, int32_t srcLength,
                  uint32_t *pMatchValue,
@@ -136,6 +172,26 @@ ucnv_extMatchToU(const int32_t *cx, int8_t sisoState,
         return 0; /* no extension data, no match */
     }
 
+    if(toUIndex!=NULL && sisoState!=0 && preLength<=2 && (preLength+srcLength)>=2) {
+        /*
+         * The index contains only two-byte sequences that are not prefixes of
+         * longer ones, so the section walk below would stop with the same result.
+         * Otherwise fall through to the section walk.
+         */
+        uint8_t b0, b1;
+
+        b0=(uint8_t)(preLength>0 ? pre[0] : src[0]);
+        b1=(uint8_t)(preLength>1 ? pre[1] : src[1-preLength]);
+        value=ucnv_extFindToUIndex(toUIndex, b0, b1);
+        if( value!=0 &&
+            (UCNV_EXT_TO_U_IS_ROUNDTRIP(value) ||
+             TO_U_USE_FALLBACK(useFallback))
+        ) {
+            *pMatchValue=UCNV_EXT_TO_U_MASK_ROUNDTRIP(value);
+            return 2;
+        }
+    }
+
     /* initialize */
     toUTable=UCNV_EXT_ARRAY(cx, UCNV_EXT_TO_U_INDEX, uint32_t);
     idx=0;
@@ -283,11 +339,15 @@ ucnv_extInitialMatchToU(UConverter *cnv, const int32_t *cx,
                         int32_t **offsets, int32_t srcIndex,
                         UBool flush,
                         UErrorCode *pErrorCode) {
+    const uint32_t *toUIndex;
     uint32_t value = 0;  /* initialize output-only param to 0 to silence gcc */
     int32_t match;
 
+    /* the index belongs to the converter's own extension data */
+    toUIndex= cx==cnv->sharedData->mbcs.extIndexes ? cnv->sharedData->mbcs.extToUIndex : NULL;
+
     /* try to match */
-    match=ucnv_extMatchToU(cx, (int8_t)UCNV_SISO_STATE(cnv),
+    match=ucnv_extMatchToU(cx, toUIndex, (int8_t)UCNV_SISO_STATE(cnv),
                            (const char *)cnv->toUBytes, firstLength,
                            *src, (int32_t)(srcLimit-*src),
                            &value,
@@ -341,7 +401,7 @@ ucnv_extSimpleMatchToU(const int32_t *cx,
     }
 
     /* try to match */
-    match=ucnv_extMatchToU(cx, -1,
+    match=ucnv_extMatchToU(cx, NULL, -1,
                            source, length,
                            NULL, 0,
                            &value,
@@ -374,7 +434,7 @@ ucnv_extContinueMatchToU(UConverter *cnv,
     uint32_t value = 0;  /* initialize output-only param to 0 to silence gcc */
     int32_t match, length;
 
-    match=ucnv_extMatchToU(cnv->sharedData->mbcs.extIndexes, (int8_t)UCNV_SISO_STATE(cnv),
+    match=ucnv_extMatchToU(cnv->sharedData->mbcs.extIndexes, NULL, (int8_t)UCNV_SISO_STATE(cnv),
                            cnv->preToU, cnv->preToULength,
                            pArgs->source, (int32_t)(pArgs->sourceLimit-pArgs->source),
                            &value,
@@ -447,6 +507,78 @@ ucnv_extContinueMatchToU(UConverter *cnv,
     }
 }
 
+U_CFUNC uint32_t *
+ucnv_extBuildToUIndex(const int32_t *cx, UErrorCode *pErrorCode) {
+    const uint32_t *toUTable, *toUSection;
+    uint32_t *toUIndex;
+    uint32_t word, value;
+    int32_t pass, count, shift, i, j, length, sectionLength;
+
+    if(U_FAILURE(*pErrorCode) || cx==NULL || cx[UCNV_EXT_TO_U_LENGTH]<=0) {
+        return NULL;
+    }
+
+    toUTable=UCNV_EXT_ARRAY(cx, UCNV_EXT_TO_U_INDEX, uint32_t);
+    toUIndex=NULL;
+    count=shift=0;
+
+    /* pass 0 counts the mappings, pass 1 inserts them */
+    for(pass=0; pass<2; ++pass) {
+        length=(int32_t)UCNV_EXT_TO_U_GET_BYTE(toUTable[0]);
+        for(i=1; i<=length; ++i) {
+            value=UCNV_EXT_TO_U_GET_VALUE(toUTable[i]);
+            if(value==0 || !UCNV_EXT_TO_U_IS_PARTIAL(value)) {
+                continue; /* no mapping, or a single-byte mapping */
+            }
+
+            /* walk the section for the second byte */
+            toUSection=toUTable+UCNV_EXT_TO_U_GET_PARTIAL_INDEX(value);
+            sectionLength=(int32_t)UCNV_EXT_TO_U_GET_BYTE(toUSection[0]);
+            for(j=1; j<=sectionLength; ++j) {
+                word=toUSection[j];
+                value=UCNV_EXT_TO_U_GET_VALUE(word);
+                if(value==0 || UCNV_EXT_TO_U_IS_PARTIAL(value)) {
+                    continue; /* no mapping, or a prefix of longer mappings */
+                }
+                if(pass==0) {
+                    ++count;
+                } else {
+                    uint32_t key=UCNV_EXT_TO_U_INDEX_KEY(
+                        UCNV_EXT_TO_U_GET_BYTE(toUTable[i]), UCNV_EXT_TO_U_GET_BYTE(word));
+                    uint32_t mask=((uint32_t)1<<shift)-1;
+                    uint32_t k=ucnv_extToUIndexHash(key, shift);
+                    while(toUIndex[1+2*k]!=0) {
+                        k=(k+1)&mask;
+                    }
+                    toUIndex[1+2*k]=key;
+                    toUIndex[2+2*k]=value;
+                }
+            }
+        }
+
+        if(pass==0) {
+            if(count==0) {
+                return NULL;
+            }
+
+            /* at least twice as many slots as mappings */
+            shift=1;
+            while(((int32_t)1<<shift)<2*count) {
+                ++shift;
+            }
+            length=1+2*((int32_t)1<<shift);
+            toUIndex=(uint32_t *)uprv_malloc(length*4);
+            if(toUIndex==NULL) {
+                *pErrorCode=U_MEMORY_ALLOCATION_ERROR;
+                return NULL;
+            }
+            uprv_memset(toUIndex, 0, length*4);
+            toUIndex[0]=(uint32_t)shift;
+        }
+    }
+    return toUIndex;
+}
+
 /* from Unicode ------------------------------------------------------------- */
 
 // Use roundtrips, "good one-way" mappings, and some normal fallbacks.
@@ -368,6 +368,16 @@ ucnv_extContinueMatchToU(UConverter *cnv,
                          UConverterToUnicodeArgs *pArgs, int32_t srcIndex,
                          UErrorCode *pErrorCode);
 
+/*
+ * Build a hash index of the two-byte toUnicode mappings that are not
+ * prefixes of longer mappings, for ucnv_extInitialMatchToU().
+ * Called when an MBCS converter is loaded; the result must be released
+ * with uprv_free().
+ * @return the index, or NULL if there are no such mappings or on failure
+ */
+U_CFUNC uint32_t *
+ucnv_extBuildToUIndex(const int32_t *cx, UErrorCode *pErrorCode);
+
 
 U_CFUNC UBool
 ucnv_extInitialMatchFromU(UConverter *cnv, const int32_t *cx,
@@ -174,7 +174,54 @@ UConverter_toUnicode_HZ_OFFSETS_LOGIC(UConverterToUnicodeArgs *args,
     while(mySource< mySourceLimit){
         
         if(myTarget < args->targetLimit){
-            
+
+            /*
+             * Convert a run of single-byte characters or of GB 2312 byte pairs
+             * at once if possible, with direct table access for the pairs.
+             * Escapes, errors and unassigned characters are handled below.
+             */
+            if(args->converter->mode == 0 && args->converter->toUnicodeStatus == 0) {
+                const char *runStart = mySource;
+                int32_t *offsets = args->offsets != NULL ? args->offsets + (myTarget - args->target) : NULL;
+                if(myData->isStateDBCS) {
+                    const UConverterMBCSTable *mbcsTable = &myData->gbConverter->sharedData->mbcs;
+                    while(myTarget < args->targetLimit && (mySourceLimit - mySource) >= 2) {
+                        uint8_t lead = (uint8_t)mySource[0];
+                        uint8_t trail = (uint8_t)mySource[1];
+                        UChar c;
+                        if((uint8_t)(lead - 0x21) > (0x7d - 0x21) || (uint8_t)(trail - 0x21) > (0x7e - 0x21)) {
+                            break;
+                        }
+                        c = ucnv_MBCSSimpleGetNextDBCS(mbcsTable, mbcsTable->dbcsOnlyState, 0,
+                                                       (uint8_t)(lead + 0x80), (uint8_t)(trail + 0x80));
+                        if(c >= 0xfffe) {
+                            break;
+                        }
+                        if(offsets != NULL) {
+                            *offsets++ = (int32_t)(mySource - args->source);
+                        }
+                        *myTarget++ = c;
+                        mySource += 2;
+                    }
+                } else {
+                    while(myTarget < args->targetLimit && mySource < mySourceLimit) {
+                        uint8_t b = (uint8_t)*mySource;
+                        if(b > 0x7f || b == UCNV_TILDE) {
+                            break;
+                        }
+                        if(offsets != NULL) {
+                            *offsets++ = (int32_t)(mySource - args->source);
+                        }
+                        *myTarget++ = b;
+                        ++mySource;
+                    }
+                }
+                if(mySource != runStart) {
+                    myData->isEmptySegment = FALSE;
+                    continue;
+                }
+            }
+
             mySourceChar= (unsigned char) *mySource++;
 
             if(args->converter->mode == UCNV_TILDE) {
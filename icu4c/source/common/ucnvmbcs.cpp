@@ -536,25 +536,57 @@ const UConverterSharedData _MBCSData={
  *
  * Note that single surrogates are not mapped by GB 18030
  * as of the re-released mapping tables from 2000-nov-30.
+ *
+ * The ranges are sorted in ascending order of their Unicode code points.
+ * The four-byte sequences are assigned in the same order,
+ * so the table is also sorted by the linear GB values and
+ * findGB18030Range() can binary-search it in either direction.
  */
 static const uint32_t
 gb18030Ranges[14][4]={
-    {0x10000, 0x10FFFF, LINEAR(0x90308130), LINEAR(0xE3329A35)},
-    {0x9FA6, 0xD7FF, LINEAR(0x82358F33), LINEAR(0x8336C738)},
     {0x0452, 0x1E3E, LINEAR(0x8130D330), LINEAR(0x8135F436)},
     {0x1E40, 0x200F, LINEAR(0x8135F438), LINEAR(0x8136A531)},
-    {0xE865, 0xF92B, LINEAR(0x8336D030), LINEAR(0x84308534)},
     {0x2643, 0x2E80, LINEAR(0x8137A839), LINEAR(0x8138FD38)},
-    {0xFA2A, 0xFE2F, LINEAR(0x84309C38), LINEAR(0x84318537)},
-    {0x3CE1, 0x4055, LINEAR(0x8231D438), LINEAR(0x8232AF32)},
     {0x361B, 0x3917, LINEAR(0x8230A633), LINEAR(0x8230F237)},
-    {0x49B8, 0x4C76, LINEAR(0x8234A131), LINEAR(0x8234E733)},
+    {0x3CE1, 0x4055, LINEAR(0x8231D438), LINEAR(0x8232AF32)},
     {0x4160, 0x4336, LINEAR(0x8232C937), LINEAR(0x8232F837)},
-    {0x478E, 0x4946, LINEAR(0x8233E838), LINEAR(0x82349638)},
     {0x44D7, 0x464B, LINEAR(0x8233A339), LINEAR(0x8233C931)},
-    {0xFFE6, 0xFFFF, LINEAR(0x8431A234), LINEAR(0x8431A439)}
+    {0x478E, 0x4946, LINEAR(0x8233E838), LINEAR(0x82349638)},
+    {0x49B8, 0x4C76, LINEAR(0x8234A131), LINEAR(0x8234E733)},
+    {0x9FA6, 0xD7FF, LINEAR(0x82358F33), LINEAR(0x8336C738)},
+    {0xE865, 0xF92B, LINEAR(0x8336D030), LINEAR(0x84308534)},
+    {0xFA2A, 0xFE2F, LINEAR(0x84309C38), LINEAR(0x84318537)},
+    {0xFFE6, 0xFFFF, LINEAR(0x8431A234), LINEAR(0x8431A439)},
+    {0x10000, 0x10FFFF, LINEAR(0x90308130), LINEAR(0xE3329A35)}
 };
 
+/* gb18030Ranges column indexes for findGB18030Range() */
+#define GB18030_RANGE_UNICODE 0
+#define GB18030_RANGE_LINEAR 2
+
+/*
+ * Binary search for the GB 18030 range that contains the value.
+ * @param value a Unicode code point or a linear GB 18030 four-byte value
+ * @param column GB18030_RANGE_UNICODE or GB18030_RANGE_LINEAR
+ * @return the range row (start & end of Unicode & GB codes), or NULL if not found
+ */
+static const uint32_t *
+findGB18030Range(uint32_t value, int32_t column) {
+    int32_t start=0, limit=UPRV_LENGTHOF(gb18030Ranges);
+    while(start<limit) {
+        int32_t i=(start+limit)/2;
+        const uint32_t *range=gb18030Ranges[i];
+        if(value<range[column]) {
+            limit=i;
+        } else if(value>range[column+1]) {
+            start=i+1;
+        } else {
+            return range;
+        }
+    }
+    return NULL;
+}
+
 /* bit flag for UConverter.options indicating GB 18030 special handling */
 #define _MBCS_OPTION_GB18030 0x8000
 
@@ -1095,7 +1127,79 @@ ucnv_MBCSGetUnicodeSet(const UConverter *cnv,
  *
  * If an input character cannot be mapped, then these functions set an error
  * code. The framework will then call the callback function.
+ * If the callback is a built-in one that just skips or substitutes
+ * (see ucnv_getFromUUnassignedAction()), then they do that directly
+ * so that the conversion loop need not return to the framework.
+ */
+
+/*
+ * Get the substitution bytes for an unmappable code point.
+ * For an EBCDIC_STATEFUL converter, this includes the SI/SO byte if needed,
+ * and the fromUnicodeStatus (prevLength) is updated.
+ * @param isLowCodePoint TRUE if the unmappable code point is up to U+00ff,
+ *                       for selecting subChar1 when there is no extension table
+ * @param buffer scratch space for the SI/SO sequence
+ * @param pLength receives the number of substitution bytes
+ * @return the substitution bytes (cnv->subChars, cnv->subChar1 or buffer),
+ *         or NULL if the substitution character does not fit the SI/SO scheme
  */
+static const char *
+getSubBytes(UConverter *cnv, const UConverterSharedData *sharedData,
+            UBool isLowCodePoint, char buffer[4], int32_t *pLength) {
+    const char *subchar;
+    char *p;
+    int32_t length;
+
+    /* first, select between subChar and subChar1 */
+    if( cnv->subChar1!=0 &&
+        (sharedData->mbcs.extIndexes!=NULL ?
+            cnv->useSubChar1 :
+            isLowCodePoint)
+    ) {
+        /* select subChar1 if it is set (not 0) and the unmappable Unicode code point is up to U+00ff (IBM MBCS behavior) */
+        subchar=(const char *)&cnv->subChar1;
+        length=1;
+    } else {
+        /* select subChar in all other cases */
+        subchar=(const char *)cnv->subChars;
+        length=cnv->subCharLen;
+    }
+
+    /* reset the selector for the next code point */
+    cnv->useSubChar1=FALSE;
+
+    if (sharedData->mbcs.outputType == MBCS_OUTPUT_2_SISO) {
+        p=buffer;
+
+        /* fromUnicodeStatus contains prevLength */
+        switch(length) {
+        case 1:
+            if(cnv->fromUnicodeStatus==2) {
+                /* DBCS mode and SBCS sub char: change to SBCS */
+                cnv->fromUnicodeStatus=1;
+                *p++=UCNV_SI;
+            }
+            *p++=subchar[0];
+            break;
+        case 2:
+            if(cnv->fromUnicodeStatus<=1) {
+                /* SBCS mode and DBCS sub char: change to DBCS */
+                cnv->fromUnicodeStatus=2;
+                *p++=UCNV_SO;
+            }
+            *p++=subchar[0];
+            *p++=subchar[1];
+            break;
+        default:
+            *pLength=0;
+            return NULL;
+        }
+        subchar=buffer;
+        length=(int32_t)(p-buffer);
+    }
+    *pLength=length;
+    return subchar;
+}
 
 /*
  * @return if(U_FAILURE) return the code point for cnv->fromUChar32
@@ -1127,38 +1231,68 @@ _extFromU(UConverter *cnv, const UConverterSharedData *sharedData,
 
     /* GB 18030 */
     if((cnv->options&_MBCS_OPTION_GB18030)!=0) {
-        const uint32_t *range;
-        int32_t i;
-
-        range=gb18030Ranges[0];
-        for(i=0; i<UPRV_LENGTHOF(gb18030Ranges); range+=4, ++i) {
-            if(range[0]<=(uint32_t)cp && (uint32_t)cp<=range[1]) {
-                /* found the Unicode code point, output the four-byte sequence for it */
-                uint32_t linear;
-                char bytes[4];
-
-                /* get the linear value of the first GB 18030 code in this range */
-                linear=range[2]-LINEAR_18030_BASE;
-
-                /* add the offset from the beginning of the range */
-                linear+=((uint32_t)cp-range[0]);
-
-                /* turn this into a four-byte sequence */
-                bytes[3]=(char)(0x30+linear%10); linear/=10;
-                bytes[2]=(char)(0x81+linear%126); linear/=126;
-                bytes[1]=(char)(0x30+linear%10); linear/=10;
-                bytes[0]=(char)(0x81+linear);
-
-                /* output this sequence */
-                ucnv_fromUWriteBytes(cnv,
-                                     bytes, 4, (char **)target, (char *)targetLimit,
-                                     offsets, sourceIndex, pErrorCode);
-                return 0;
+        const uint32_t *range=findGB18030Range((uint32_t)cp, GB18030_RANGE_UNICODE);
+        if(range!=NULL) {
+            /* found the Unicode code point, output the four-byte sequence for it */
+            uint32_t linear;
+            char bytes[4];
+
+            /* get the linear value of the first GB 18030 code in this range */
+            linear=range[2]-LINEAR_18030_BASE;
+
+            /* add the offset from the beginning of the range */
+            linear+=((uint32_t)cp-range[0]);
+
+            /* turn this into a four-byte sequence */
+            bytes[3]=(char)(0x30+linear%10); linear/=10;
+            bytes[2]=(char)(0x81+linear%126); linear/=126;
+            bytes[1]=(char)(0x30+linear%10); linear/=10;
+            bytes[0]=(char)(0x81+linear);
+
+            /* output this sequence */
+            ucnv_fromUWriteBytes(cnv,
+                                 bytes, 4, (char **)target, (char *)targetLimit,
+                                 offsets, sourceIndex, pErrorCode);
+            return 0;
+        }
+    }
+
+    /*
+     * No mapping: skip or substitute here if the callback would do just that.
+     * Not for EBCDIC_STATEFUL, where the framework's handling determines the
+     * offset of a final SI.
+     */
+    if(sharedData->mbcs.outputType!=MBCS_OUTPUT_2_SISO) {
+        int32_t action=ucnv_getFromUUnassignedAction(cnv, cp);
+        if(action!=UCNV_UNASSIGNED_CALLBACK) {
+            /* for ucnv_getInvalidUChars(), as in the framework */
+            int32_t i=0;
+            U16_APPEND_UNSAFE(cnv->invalidUCharBuffer, i, cp);
+            cnv->invalidUCharLength=(int8_t)i;
+        }
+        switch(action) {
+        case UCNV_UNASSIGNED_SKIP:
+            cnv->useSubChar1=FALSE;
+            *pErrorCode=U_ZERO_ERROR;  /* like the callback */
+            return 0;
+        case UCNV_UNASSIGNED_SUBSTITUTE: {
+            char buffer[4];
+            int32_t length;
+            const char *subchar=getSubBytes(cnv, sharedData, (UBool)(cp<=0xff), buffer, &length);
+            if(subchar==NULL) {
+                break;  /* let the framework report the error via ucnv_MBCSWriteSub() */
             }
+            *pErrorCode=U_ZERO_ERROR;
+            ucnv_fromUWriteBytes(cnv,
+                                 subchar, length, (char **)target, (char *)targetLimit,
+                                 offsets, sourceIndex, pErrorCode);
+            return 0;
+        }
+        default:
+            break;
         }
     }
 
-    /* no mapping */
     *pErrorCode=U_INVALID_CHAR_FOUND;
     return cp;
 }
@@ -1194,27 +1328,45 @@ _extToU(UConverter *cnv, const UConverterSharedData *sharedData,
     if(length==4 && (cnv->options&_MBCS_OPTION_GB18030)!=0) {
         const uint32_t *range;
         uint32_t linear;
-        int32_t i;
 
         linear=LINEAR_18030(cnv->toUBytes[0], cnv->toUBytes[1], cnv->toUBytes[2], cnv->toUBytes[3]);
-        range=gb18030Ranges[0];
-        for(i=0; i<UPRV_LENGTHOF(gb18030Ranges); range+=4, ++i) {
-            if(range[2]<=linear && linear<=range[3]) {
-                /* found the sequence, output the Unicode code point for it */
-                *pErrorCode=U_ZERO_ERROR;
+        range=findGB18030Range(linear, GB18030_RANGE_LINEAR);
+        if(range!=NULL) {
+            /* found the sequence, output the Unicode code point for it */
+            *pErrorCode=U_ZERO_ERROR;
 
-                /* add the linear difference between the input and start sequences to the start code point */
-                linear=range[0]+(linear-range[2]);
+            /* add the linear difference between the input and start sequences to the start code point */
+            linear=range[0]+(linear-range[2]);
 
-                /* output this code point */
-                ucnv_toUWriteCodePoint(cnv, linear, target, targetLimit, offsets, sourceIndex, pErrorCode);
+            /* output this code point */
+            ucnv_toUWriteCodePoint(cnv, linear, target, targetLimit, offsets, sourceIndex, pErrorCode);
 
-                return 0;
-            }
+            return 0;
         }
     }
 
-    /* no mapping */
+    /* no mapping: skip or substitute here if the callback would do just that */
+    int32_t action=ucnv_getToUUnassignedAction(cnv);
+    if(action!=UCNV_UNASSIGNED_CALLBACK) {
+        /* for ucnv_getInvalidChars(), as in the framework */
+        uprv_memcpy(cnv->invalidCharBuffer, cnv->toUBytes, length);
+        cnv->invalidCharLength=length;
+    }
+    switch(action) {
+    case UCNV_UNASSIGNED_SKIP:
+        *pErrorCode=U_ZERO_ERROR;  /* like the callback */
+        return 0;
+    case UCNV_UNASSIGNED_SUBSTITUTE: {
+        /* same as ucnv_cbToUWriteSub() */
+        UChar sub=(length==1 && cnv->subChar1!=0) ? 0x1a : 0xfffd;
+        *pErrorCode=U_ZERO_ERROR;  /* like the callback */
+        ucnv_toUWriteUChars(cnv, &sub, 1, target, targetLimit, offsets, sourceIndex, pErrorCode);
+        return 0;
+    }
+    default:
+        break;
+    }
+
     *pErrorCode=U_INVALID_CHAR_FOUND;
     return length;
 }
@@ -1667,6 +1819,9 @@ ucnv_MBCSLoad(UConverterSharedData *sharedData,
          */
         mbcsTable->reconstitutedData=NULL;
 
+        /* The extToUIndex is built below for this converter's own extension data. */
+        mbcsTable->extToUIndex=NULL;
+
         /*
          * Set a special, runtime-only outputType if the extension converter
          * is a DBCS version of a base converter that also maps single bytes.
@@ -1874,6 +2029,11 @@ ucnv_MBCSLoad(UConverterSharedData *sharedData,
          */
         mbcsTable->asciiRoundtrips=0;
     }
+
+    /* Index the two-byte toUnicode extension mappings for faster lookup. */
+    if(mbcsTable->extIndexes!=NULL && U_SUCCESS(*pErrorCode)) {
+        mbcsTable->extToUIndex=ucnv_extBuildToUIndex(mbcsTable->extIndexes, pErrorCode);
+    }
 }
 
 static void U_CALLCONV
@@ -1892,6 +2052,9 @@ ucnv_MBCSUnload(UConverterSharedData *sharedData) {
     if(mbcsTable->reconstitutedData!=NULL) {
         uprv_free(mbcsTable->reconstitutedData);
     }
+    if(mbcsTable->extToUIndex!=NULL) {
+        uprv_free(mbcsTable->extToUIndex);
+    }
 }
 
 static void U_CALLCONV
@@ -1998,6 +2161,74 @@ ucnv_MBCSGetName(const UConverter *cnv) {
 U_CDECL_END
 
 
+/* ASCII runs --------------------------------------------------------------- */
+
+/*
+ * When all of 00..7F round-trip (asciiRoundtrips==MBCS_ASCII_ALL_ROUNDTRIP),
+ * runs of ASCII characters are copied instead of looking up each one
+ * in the state table or the fromUnicode table.
+ * Most of a long run is copied in fixed-size blocks, each tested by
+ * OR-ing all of its units together; these simple loops are easy for
+ * compilers to vectorize. The end of the run is copied one unit at a time.
+ */
+#define MBCS_ASCII_BLOCK_LENGTH 16
+
+/*
+ * Copies the ASCII bytes at the start of the source.
+ * @return the number of bytes copied, at most length
+ */
+static inline int32_t
+copyASCIIToUChars(const uint8_t *source, UChar *target, int32_t length) {
+    int32_t i, j;
+    uint8_t oredBytes;
+
+    for(i=0; (length-i)>=MBCS_ASCII_BLOCK_LENGTH; i+=MBCS_ASCII_BLOCK_LENGTH) {
+        oredBytes=0;
+        for(j=0; j<MBCS_ASCII_BLOCK_LENGTH; ++j) {
+            oredBytes|=source[i+j];
+        }
+        if(oredBytes>=0x80) {
+            break;
+        }
+        for(j=0; j<MBCS_ASCII_BLOCK_LENGTH; ++j) {
+            target[i+j]=source[i+j];
+        }
+    }
+    while(i<length && source[i]<=0x7f) {
+        target[i]=source[i];
+        ++i;
+    }
+    return i;
+}
+
+/*
+ * Copies the ASCII UChars at the start of the source.
+ * @return the number of UChars copied, at most length
+ */
+static inline int32_t
+copyASCIIFromUChars(const UChar *source, uint8_t *target, int32_t length) {
+    int32_t i, j;
+    UChar oredUnits;
+
+    for(i=0; (length-i)>=MBCS_ASCII_BLOCK_LENGTH; i+=MBCS_ASCII_BLOCK_LENGTH) {
+        oredUnits=0;
+        for(j=0; j<MBCS_ASCII_BLOCK_LENGTH; ++j) {
+            oredUnits|=source[i+j];
+        }
+        if(oredUnits>=0x80) {
+            break;
+        }
+        for(j=0; j<MBCS_ASCII_BLOCK_LENGTH; ++j) {
+            target[i+j]=(uint8_t)source[i+j];
+        }
+    }
+    while(i<length && source[i]<=0x7f) {
+        target[i]=(uint8_t)source[i];
+        ++i;
+    }
+    return i;
+}
+
 /* MBCS-to-Unicode conversion functions ------------------------------------- */
 
 static UChar32 U_CALLCONV
@@ -2196,6 +2427,7 @@ ucnv_MBCSSingleToBMPWithOffsets(UConverterToUnicodeArgs *pArgs,
 
     int32_t entry;
     uint8_t action;
+    UBool copyASCII;
 
     /* set up the local pointers */
     cnv=pArgs->converter;
@@ -2210,6 +2442,7 @@ ucnv_MBCSSingleToBMPWithOffsets(UConverterToUnicodeArgs *pArgs,
     } else {
         stateTable=cnv->sharedData->mbcs.stateTable;
     }
+    copyASCII=(UBool)(cnv->sharedData->mbcs.asciiRoundtrips==MBCS_ASCII_ALL_ROUNDTRIP);
 
     /* sourceIndex=-1 if the current character began in the previous buffer */
     sourceIndex=0;
@@ -2233,6 +2466,12 @@ unrolled:
 
         loops=count=targetCapacity>>4;
         do {
+            /* copy 16 ASCII bytes without state table lookups */
+            if(copyASCII && copyASCIIToUChars(source, target, 16)==16) {
+                source+=16;
+                target+=16;
+                continue;
+            }
             oredEntries=entry=stateTable[0][*source++];
             *target++=(UChar)MBCS_ENTRY_FINAL_VALUE_16(entry);
             oredEntries|=entry=stateTable[0][*source++];
@@ -2483,6 +2722,7 @@ ucnv_MBCSToUnicodeWithOffsets(UConverterToUnicodeArgs *pArgs,
     int32_t entry;
     UChar c;
     uint8_t action;
+    uint32_t asciiRoundtrips;
 
     /* use optimized function if possible */
     cnv=pArgs->converter;
@@ -2521,6 +2761,7 @@ ucnv_MBCSToUnicodeWithOffsets(UConverterToUnicodeArgs *pArgs,
         stateTable=cnv->sharedData->mbcs.stateTable;
     }
     unicodeCodeUnits=cnv->sharedData->mbcs.unicodeCodeUnits;
+    asciiRoundtrips=cnv->sharedData->mbcs.asciiRoundtrips;
 
     /* get the converter state from UConverter */
     offset=cnv->toUnicodeStatus;
@@ -2557,6 +2798,25 @@ ucnv_MBCSToUnicodeWithOffsets(UConverterToUnicodeArgs *pArgs,
         }
 
         if(byteIndex==0) {
+            /* copy a run of ASCII bytes if they all map to themselves */
+            if(state==0 && asciiRoundtrips==MBCS_ASCII_ALL_ROUNDTRIP && *source<=0x7f) {
+                int32_t count=(int32_t)(sourceLimit-source);
+                if(count>(int32_t)(targetLimit-target)) {
+                    count=(int32_t)(targetLimit-target);
+                }
+                count=copyASCIIToUChars(source, target, count);
+                source+=count;
+                target+=count;
+                if(offsets!=NULL) {
+                    while(count>0) {
+                        *offsets++=sourceIndex;
+                        sourceIndex=++nextSourceIndex;
+                        --count;
+                    }
+                }
+                continue;
+            }
+
             /* optimized loop for 1/2-byte input and BMP output */
             if(offsets==NULL) {
                 do {
@@ -3466,6 +3726,25 @@ ucnv_MBCSDoubleFromUnicodeWithOffsets(UConverterFromUnicodeArgs *pArgs,
          * then break the loop, too.
          */
         if(targetCapacity>0) {
+            /* copy a run of ASCII characters if they all map to themselves */
+            if(asciiRoundtrips==MBCS_ASCII_ALL_ROUNDTRIP && *source<=0x7f) {
+                int32_t count=(int32_t)(sourceLimit-source);
+                if(count>targetCapacity) {
+                    count=targetCapacity;
+                }
+                count=copyASCIIFromUChars(source, target, count);
+                source+=count;
+                target+=count;
+                targetCapacity-=count;
+                nextSourceIndex+=count;
+                if(offsets!=NULL) {
+                    while(sourceIndex<nextSourceIndex) {
+                        *offsets++=sourceIndex++;
+                    }
+                }
+                continue;
+            }
+
             /*
              * Get a correct Unicode code point:
              * a single UChar for a BMP code point or
@@ -3924,6 +4203,15 @@ unrolled:
 #endif
 
     while(targetCapacity>0) {
+        /* copy a run of ASCII characters if they all map to themselves */
+        if(asciiRoundtrips==MBCS_ASCII_ALL_ROUNDTRIP && *source<=0x7f) {
+            length=copyASCIIFromUChars(source, target, targetCapacity);
+            source+=length;
+            target+=length;
+            targetCapacity-=length;
+            continue;
+        }
+
         /*
          * Get a correct Unicode code point:
          * a single UChar for a BMP code point or
@@ -4195,6 +4483,26 @@ ucnv_MBCSFromUnicodeWithOffsets(UConverterFromUnicodeArgs *pArgs,
          * then break the loop, too.
          */
         if(targetCapacity>0) {
+            /* copy a run of ASCII characters if they all map to themselves */
+            if(asciiRoundtrips==MBCS_ASCII_ALL_ROUNDTRIP && *source<=0x7f) {
+                int32_t count=(int32_t)(sourceLimit-source);
+                if(count>targetCapacity) {
+                    count=targetCapacity;
+                }
+                count=copyASCIIFromUChars(source, target, count);
+                source+=count;
+                target+=count;
+                targetCapacity-=count;
+                nextSourceIndex+=count;
+                if(offsets!=NULL) {
+                    while(sourceIndex<nextSourceIndex) {
+                        prevSourceIndex=sourceIndex;
+                        *offsets++=sourceIndex++;
+                    }
+                }
+                continue;
+            }
+
             /*
              * Get a correct Unicode code point:
              * a single UChar for a BMP code point or
@@ -5652,58 +5960,15 @@ ucnv_MBCSWriteSub(UConverterFromUnicodeArgs *pArgs,
               int32_t offsetIndex,
               UErrorCode *pErrorCode) {
     UConverter *cnv=pArgs->converter;
-    char *p, *subchar;
+    const char *subchar;
     char buffer[4];
     int32_t length;
 
-    /* first, select between subChar and subChar1 */
-    if( cnv->subChar1!=0 &&
-        (cnv->sharedData->mbcs.extIndexes!=NULL ?
-            cnv->useSubChar1 :
-            (cnv->invalidUCharBuffer[0]<=0xff))
-    ) {
-        /* select subChar1 if it is set (not 0) and the unmappable Unicode code point is up to U+00ff (IBM MBCS behavior) */
-        subchar=(char *)&cnv->subChar1;
-        length=1;
-    } else {
-        /* select subChar in all other cases */
-        subchar=(char *)cnv->subChars;
-        length=cnv->subCharLen;
-    }
-
-    /* reset the selector for the next code point */
-    cnv->useSubChar1=FALSE;
-
-    if (cnv->sharedData->mbcs.outputType == MBCS_OUTPUT_2_SISO) {
-        p=buffer;
-
-        /* fromUnicodeStatus contains prevLength */
-        switch(length) {
-        case 1:
-            if(cnv->fromUnicodeStatus==2) {
-                /* DBCS mode and SBCS sub char: change to SBCS */
-                cnv->fromUnicodeStatus=1;
-                *p++=UCNV_SI;
-            }
-            *p++=subchar[0];
-            break;
-        case 2:
-            if(cnv->fromUnicodeStatus<=1) {
-                /* SBCS mode and DBCS sub char: change to DBCS */
-                cnv->fromUnicodeStatus=2;
-                *p++=UCNV_SO;
-            }
-            *p++=subchar[0];
-            *p++=subchar[1];
-            break;
-        default:
-            *pErrorCode=U_ILLEGAL_ARGUMENT_ERROR;
-            return;
-        }
-        subchar=buffer;
-        length=(int32_t)(p-buffer);
+    subchar=getSubBytes(cnv, cnv->sharedData, (UBool)(cnv->invalidUCharBuffer[0]<=0xff), buffer, &length);
+    if(subchar==NULL) {
+        *pErrorCode=U_ILLEGAL_ARGUMENT_ERROR;
+        return;
     }
-
     ucnv_cbFromUWriteBytes(pArgs, subchar, length, offsetIndex, pErrorCode);
 }
 
@@ -295,6 +295,9 @@ enum {
 
 #define IS_ASCII_ROUNDTRIP(b, asciiRoundtrips) (((asciiRoundtrips) & (1<<((b)>>2)))!=0)
 
+/* asciiRoundtrips value when all of 00..7F round-trip with U+0000..U+007F */
+#define MBCS_ASCII_ALL_ROUNDTRIP 0xffffffff
+
 /* single-byte fromUnicode: get the 16-bit result word */
 #define MBCS_SINGLE_RESULT_FROM_U(table, results, c) (results)[ (table)[ (table)[(c)>>10] +(((c)>>4)&0x3f) ] +((c)&0xf) ]
 
@@ -400,6 +403,7 @@ typedef struct UConverterMBCSTable {
     /* extension data */
     struct UConverterSharedData *baseSharedData;
     const int32_t *extIndexes;
+    uint32_t *extToUIndex;                  /* runtime hash of two-byte toUnicode extension mappings */
 } UConverterMBCSTable;
 
 #define UCNV_MBCS_TABLE_INITIALIZER { \
@@ -434,6 +438,7 @@ typedef struct UConverterMBCSTable {
      \
     /* extension data */ \
     NULL, \
+    NULL, \
     NULL \
 }
 
@@ -515,6 +520,38 @@ ucnv_MBCSSingleSimpleGetNextUChar(UConverterSharedData *sharedData,
 #define _MBCS_SINGLE_SIMPLE_GET_NEXT_BMP(sharedData, b) \
     (UChar)MBCS_ENTRY_FINAL_VALUE_16((sharedData)->mbcs.stateTable[0][(uint8_t)(b)])
 
+/**
+ * This version of _MBCSSimpleGetNextUChar() gets a code point from a byte pair
+ * with direct access to the state table, for run-based conversion loops
+ * in other converter implementations.
+ * It starts in the given state with the given offset; these are normally
+ * mbcsTable->dbcsOnlyState and 0, or the result of a prefix byte transition.
+ *
+ * It only returns round-trip BMP code points.
+ * For anything else (unassigned, fallback, supplementary code point,
+ * conversion extension, illegal) it returns a value >=0xfffe,
+ * and the caller needs to use ucnv_MBCSSimpleGetNextUChar() instead.
+ */
+static inline UChar
+ucnv_MBCSSimpleGetNextDBCS(const UConverterMBCSTable *mbcsTable,
+                           uint8_t state, uint32_t offset,
+                           uint8_t lead, uint8_t trail) {
+    int32_t entry=mbcsTable->stateTable[state][lead];
+    if(!MBCS_ENTRY_IS_TRANSITION(entry)) {
+        return 0xffff;
+    }
+    offset+=MBCS_ENTRY_TRANSITION_OFFSET(entry);
+    entry=mbcsTable->stateTable[MBCS_ENTRY_TRANSITION_STATE(entry)][trail];
+    if(MBCS_ENTRY_FINAL_IS_VALID_DIRECT_16(entry)) {
+        return (UChar)MBCS_ENTRY_FINAL_VALUE_16(entry);
+    } else if(MBCS_ENTRY_IS_FINAL(entry) && MBCS_ENTRY_FINAL_ACTION(entry)==MBCS_STATE_VALID_16) {
+        /* 0xfffe for unassigned and fallbacks */
+        return mbcsTable->unicodeCodeUnits[offset+MBCS_ENTRY_FINAL_VALUE_16(entry)];
+    } else {
+        return 0xffff;
+    }
+}
+
 /**
  * This is an internal function that allows other converter implementations
  * to check whether a byte is a lead byte.
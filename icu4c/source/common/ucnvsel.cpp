@@ -56,6 +56,8 @@ struct UConverterSelector {
   int32_t encodingStrLength;
   uint8_t* swapped;
   UBool ownPv, ownEncodingStrings;
+  int32_t asciiPvIndex;      // pv index shared by all of U+0000..U+007F, or -1
+  uint32_t* floorMask;       // intersection of all pv rows; results never go below it
 };
 
 static void generateSelectorData(UConverterSelector* result,
@@ -144,6 +146,34 @@ static void generateSelectorData(UConverterSelector* result,
   result->ownPv = TRUE;
 }
 
+// precompute the data for the fast paths in the select functions:
+// the common row for ASCII, and the mask below which no intersection can go
+static void initSelectorFastPaths(UConverterSelector* sel, UErrorCode* status) {
+  if (U_FAILURE(*status)) {
+    return;
+  }
+  int32_t columns = (sel->encodingsCount+31)/32;
+  sel->floorMask = (uint32_t*) uprv_malloc(columns * 4);
+  if (sel->floorMask == NULL) {
+    *status = U_MEMORY_ALLOCATION_ERROR;
+    return;
+  }
+  uprv_memset(sel->floorMask, ~0, columns * 4);
+  for (int32_t row = 0; row < sel->pvCount; row += columns) {
+    for (int32_t col = 0; col < columns; ++col) {
+      sel->floorMask[col] &= sel->pv[row + col];
+    }
+  }
+
+  sel->asciiPvIndex = UTRIE2_GET16(sel->trie, 0);
+  for (UChar32 c = 1; c <= 0x7f; ++c) {
+    if (UTRIE2_GET16(sel->trie, c) != sel->asciiPvIndex) {
+      sel->asciiPvIndex = -1;
+      break;
+    }
+  }
+}
+
 /* open a selector. If converterListSize is 0, build for all converters.
    If excludedCodePoints is NULL, don't exclude any codepoints */
 U_CAPI UConverterSelector* U_EXPORT2
@@ -216,6 +246,7 @@ ucnvsel_open(const char* const*  converterList, int32_t converterListSize,
   UPropsVectors *upvec = upvec_open((converterListSize+31)/32, status);
   generateSelectorData(newSelector.getAlias(), upvec, excludedCodePoints, whichSet, status);
   upvec_close(upvec);
+  initSelectorFastPaths(newSelector.getAlias(), status);
 
   if (U_FAILURE(*status)) {
     return NULL;
@@ -239,6 +270,7 @@ ucnvsel_close(UConverterSelector *sel) {
   }
   utrie2_close(sel->trie);
   uprv_free(sel->swapped);
+  uprv_free(sel->floorMask);
   uprv_free(sel);
 }
 
@@ -584,6 +616,11 @@ ucnvsel_openFromSerialized(const void* buffer, int32_t length, UErrorCode* statu
   }
   p += sel->encodingStrLength;
 
+  initSelectorFastPaths(sel, status);
+  if (U_FAILURE(*status)) {
+    ucnvsel_close(sel);
+    return NULL;
+  }
   return sel;
 }
 
@@ -663,14 +700,20 @@ static const UEnumeration defaultEncodings = {
 
 
 // internal fn to intersect two sets of masks
-// returns whether the mask has reduced to all zeros
-static UBool intersectMasks(uint32_t* dest, const uint32_t* source1, int32_t len) {
+// returns whether the mask has reduced to the floor mask (usually all zeros),
+// so that no further intersection can change it
+// (written as simple loops over the columns which compilers vectorize)
+static inline UBool intersectMasks(uint32_t* dest, const uint32_t* source1,
+                                   const uint32_t* floor, int32_t len) {
+  if (len == 1) {
+    return (*dest &= *source1) == *floor;
+  }
   int32_t i;
-  uint32_t oredDest = 0;
+  uint32_t diff = 0;
   for (i = 0 ; i < len ; ++i) {
-    oredDest |= (dest[i] &= source1[i]);
+    diff |= (dest[i] &= source1[i]) ^ floor[i];
   }
-  return oredDest == 0;
+  return diff == 0;
 }
 
 // internal fn to count how many 1's are there in a mask
@@ -737,6 +780,89 @@ static UEnumeration *selectForMask(const UConverterSelector* sel,
   return en;
 }
 
+// internal fns to intersect the mask with the rows for all code points of a string
+// return whether the mask cannot change any more
+// Intersecting with the same row again is a no-op, so consecutive code points
+// with the same row (e.g., runs of ASCII) only cost one intersection.
+static UBool intersectUTF16(const UConverterSelector* sel, uint32_t* mask, int32_t columns,
+                            const UChar *s, int32_t length) {
+  const UChar *limit;
+  if (length >= 0) {
+    limit = s + length;
+  } else {
+    limit = NULL;
+  }
+  int32_t asciiPvIndex = sel->asciiPvIndex;
+  int32_t prevPvIndex = -1;
+
+  while (limit == NULL ? *s != 0 : s != limit) {
+    int32_t pvIndex;
+    if (asciiPvIndex >= 0 && *s <= 0x7f) {
+      // skip the whole ASCII run
+      do {
+        ++s;
+      } while ((limit == NULL ? *s != 0 : s != limit) && *s <= 0x7f);
+      pvIndex = asciiPvIndex;
+    } else {
+      UChar32 c;
+      uint16_t pvIndex16;
+      UTRIE2_U16_NEXT16(sel->trie, s, limit, c, pvIndex16);
+      pvIndex = pvIndex16;
+    }
+    if (pvIndex != prevPvIndex) {
+      if (intersectMasks(mask, sel->pv+pvIndex, sel->floorMask, columns)) {
+        return TRUE;
+      }
+      prevPvIndex = pvIndex;
+    }
+  }
+  return FALSE;
+}
+
+static UBool intersectUTF8(const UConverterSelector* sel, uint32_t* mask, int32_t columns,
+                           const char *s, int32_t length) {
+  if (length < 0) {
+    length = (int32_t)uprv_strlen(s);
+  }
+  const char *limit = s + length;
+  int32_t asciiPvIndex = sel->asciiPvIndex;
+  int32_t prevPvIndex = -1;
+
+  while (s != limit) {
+    int32_t pvIndex;
+    if (asciiPvIndex >= 0 && (uint8_t)*s <= 0x7f) {
+      // skip the whole ASCII run
+      do {
+        ++s;
+      } while (s != limit && (uint8_t)*s <= 0x7f);
+      pvIndex = asciiPvIndex;
+    } else {
+      uint16_t pvIndex16;
+      UTRIE2_U8_NEXT16(sel->trie, s, limit, pvIndex16);
+      pvIndex = pvIndex16;
+    }
+    if (pvIndex != prevPvIndex) {
+      if (intersectMasks(mask, sel->pv+pvIndex, sel->floorMask, columns)) {
+        return TRUE;
+      }
+      prevPvIndex = pvIndex;
+    }
+  }
+  return FALSE;
+}
+
+// internal fn to allocate a mask that allows all encodings
+static uint32_t *openMask(const UConverterSelector* sel, UErrorCode *status) {
+  int32_t columns = (sel->encodingsCount+31)/32;
+  uint32_t* mask = (uint32_t*) uprv_malloc(columns * 4);
+  if (mask == NULL) {
+    *status = U_MEMORY_ALLOCATION_ERROR;
+    return NULL;
+  }
+  uprv_memset(mask, ~0, columns *4);
+  return mask;
+}
+
 /* check a string against the selector - UTF16 version */
 U_CAPI UEnumeration * U_EXPORT2
 ucnvsel_selectForString(const UConverterSelector* sel,
@@ -751,30 +877,13 @@ ucnvsel_selectForString(const UConverterSelector* sel,
     return NULL;
   }
 
-  int32_t columns = (sel->encodingsCount+31)/32;
-  uint32_t* mask = (uint32_t*) uprv_malloc(columns * 4);
+  uint32_t* mask = openMask(sel, status);
   if (mask == NULL) {
-    *status = U_MEMORY_ALLOCATION_ERROR;
     return NULL;
   }
-  uprv_memset(mask, ~0, columns *4);
 
   if(s!=NULL) {
-    const UChar *limit;
-    if (length >= 0) {
-      limit = s + length;
-    } else {
-      limit = NULL;
-    }
-    
-    while (limit == NULL ? *s != 0 : s != limit) {
-      UChar32 c;
-      uint16_t pvIndex;
-      UTRIE2_U16_NEXT16(sel->trie, s, limit, c, pvIndex);
-      if (intersectMasks(mask, sel->pv+pvIndex, columns)) {
-        break;
-      }
-    }
+    intersectUTF16(sel, mask, (sel->encodingsCount+31)/32, s, length);
   }
   return selectForMask(sel, mask, status);
 }
@@ -793,27 +902,86 @@ ucnvsel_selectForUTF8(const UConverterSelector* sel,
     return NULL;
   }
 
-  int32_t columns = (sel->encodingsCount+31)/32;
-  uint32_t* mask = (uint32_t*) uprv_malloc(columns * 4);
+  uint32_t* mask = openMask(sel, status);
   if (mask == NULL) {
-    *status = U_MEMORY_ALLOCATION_ERROR;
     return NULL;
   }
-  uprv_memset(mask, ~0, columns *4);
 
-  if (length < 0) {
-    length = (int32_t)uprv_strlen(s);
+  if(s!=NULL) {
+    intersectUTF8(sel, mask, (sel->encodingsCount+31)/32, s, length);
   }
+  return selectForMask(sel, mask, status);
+}
 
-  if(s!=NULL) {
-    const char *limit = s + length;
-    
-    while (s != limit) {
-      uint16_t pvIndex;
-      UTRIE2_U8_NEXT16(sel->trie, s, limit, pvIndex);
-      if (intersectMasks(mask, sel->pv+pvIndex, columns)) {
-        break;
-      }
+/* check several strings against the selector - UTF16 version */
+U_CAPI UEnumeration * U_EXPORT2
+ucnvsel_selectForStrings(const UConverterSelector* sel,
+                         const UChar *const *strings, const int32_t *lengths,
+                         int32_t count, UErrorCode *status) {
+  // check if already failed
+  if (U_FAILURE(*status)) {
+    return NULL;
+  }
+  // ensure args make sense!
+  if (sel == NULL || count < 0 || (strings == NULL && count != 0)) {
+    *status = U_ILLEGAL_ARGUMENT_ERROR;
+    return NULL;
+  }
+  int32_t i;
+  for (i = 0; i < count; ++i) {
+    if (strings[i] == NULL && (lengths == NULL || lengths[i] != 0)) {
+      *status = U_ILLEGAL_ARGUMENT_ERROR;
+      return NULL;
+    }
+  }
+
+  uint32_t* mask = openMask(sel, status);
+  if (mask == NULL) {
+    return NULL;
+  }
+
+  int32_t columns = (sel->encodingsCount+31)/32;
+  for (i = 0; i < count; ++i) {
+    if (strings[i] != NULL &&
+        intersectUTF16(sel, mask, columns, strings[i], lengths != NULL ? lengths[i] : -1)) {
+      break;
+    }
+  }
+  return selectForMask(sel, mask, status);
+}
+
+/* check several strings against the selector - UTF8 version */
+U_CAPI UEnumeration * U_EXPORT2
+ucnvsel_selectForUTF8Strings(const UConverterSelector* sel,
+                             const char *const *strings, const int32_t *lengths,
+                             int32_t count, UErrorCode *status) {
+  // check if already failed
+  if (U_FAILURE(*status)) {
+    return NULL;
+  }
+  // ensure args make sense!
+  if (sel == NULL || count < 0 || (strings == NULL && count != 0)) {
+    *status = U_ILLEGAL_ARGUMENT_ERROR;
+    return NULL;
+  }
+  int32_t i;
+  for (i = 0; i < count; ++i) {
+    if (strings[i] == NULL && (lengths == NULL || lengths[i] != 0)) {
+      *status = U_ILLEGAL_ARGUMENT_ERROR;
+      return NULL;
+    }
+  }
+
+  uint32_t* mask = openMask(sel, status);
+  if (mask == NULL) {
+    return NULL;
+  }
+
+  int32_t columns = (sel->encodingsCount+31)/32;
+  for (i = 0; i < count; ++i) {
+    if (strings[i] != NULL &&
+        intersectUTF8(sel, mask, columns, strings[i], lengths != NULL ? lengths[i] : -1)) {
+      break;
     }
   }
   return selectForMask(sel, mask, status);
@@ -342,6 +342,32 @@ public:
     */
     virtual int32_t getRuleStatusVec(int32_t *fillInVec, int32_t capacity, UErrorCode &status);
 
+    /* Cannot use #ifndef U_HIDE_DRAFT_API for the following draft method since it is virtual. */
+   /**
+    * Finds all of the boundaries in the text, in one call.
+    * The result is the same as iterating with first() and next(),
+    * but some break iterators implement it more efficiently, for example
+    * sentence break iterators which suppress breaks after abbreviations.
+    * Afterwards, the iteration position is at the end of the text.
+    * <p>
+    * The boundaries are stored in ascending order, beginning with 0.
+    * If the capacity of the output array is insufficient to hold them all,
+    *  the output will be truncated to the available length, and a
+    *  U_BUFFER_OVERFLOW_ERROR will be signaled.
+    *
+    * @param fillInVec an array to be filled in with the boundaries.
+    * @param capacity  the length of the supplied vector.  A length of zero causes
+    *                  the function to return the number of boundaries, in the
+    *                  normal way, without attempting to store any values.
+    * @param status    receives error codes.
+    * @return          The number of boundaries in the text.
+    *                  In the event of a U_BUFFER_OVERFLOW_ERROR, the return value
+    *                  is the total number of boundaries,
+    *                  not the reduced number that were actually returned.
+    * @draft ICU 63
+    */
+    virtual int32_t getBoundaries(int32_t *fillInVec, int32_t capacity, UErrorCode &status);
+
     /**
      * Create BreakIterator for word-breaks using the given locale.
      * Returns an instance of a BreakIterator implementing word breaks.
@@ -618,9 +644,11 @@ public:
     static BreakIterator* buildInstance(const Locale& loc, const char *type, UErrorCode& status);
     static BreakIterator* createInstance(const Locale& loc, int32_t kind, UErrorCode& status);
     static BreakIterator* makeInstance(const Locale& loc, int32_t kind, UErrorCode& status);
+    static BreakIterator* makePrototype(const Locale& loc, int32_t kind, UErrorCode& status);
 
     friend class ICUBreakIteratorFactory;
     friend class ICUBreakIteratorService;
+    friend class BreakIteratorCacheKey;
 
 protected:
     // Do not enclose protected default/copy constructors with #ifndef U_HIDE_INTERNAL_API
@@ -29,6 +29,7 @@
 #include "unicode/udata.h"
 #include "unicode/parseerr.h"
 #include "unicode/schriter.h"
+#include "unicode/uscript.h"
 
 U_NAMESPACE_BEGIN
 
@@ -38,6 +39,7 @@ struct RBBIDataHeader;
 class  RBBIDataWrapper;
 class  UnhandledEngine;
 class  UStack;
+class  UVector;
 
 /**
  *
@@ -83,6 +85,7 @@ private:
 
     /**
      *   Cache of previously determined boundary positions.
+     *   NULL until first used, see ensureBreakCache().
      */
     class BreakCache;
     BreakCache         *fBreakCache;
@@ -90,6 +93,7 @@ private:
     /**
      *  Cache of boundary positions within a region of text that has been
      *  sub-divided by dictionary based breaking.
+     *  NULL until first used, see ensureDictionaryCache().
      */
     class DictionaryCache;
     DictionaryCache *fDictionaryCache;
@@ -112,6 +116,15 @@ private:
      */
     UnhandledEngine     *fUnhandledBreakEngine;
 
+    /**
+     *
+     * If present, UVector of SharedBreakEngine objects for custom dictionaries
+     * added with addCustomDictionary(), shared with clones of this iterator.
+     * They are searched before fLanguageBreakEngines, last added first.
+     * @internal
+     */
+    UVector             *fCustomBreakEngines;
+
     /**
      * Counter for the number of characters encountered with the "dictionary"
      *   flag set.
@@ -613,6 +626,43 @@ public:
      */
     virtual RuleBasedBreakIterator &refreshInputText(UText *input, UErrorCode &status);
 
+#ifndef U_HIDE_DRAFT_API
+    /**
+     * Adds a custom word dictionary for the dictionary-based segmentation of a script,
+     * for example to recognize domain-specific terms.
+     * A word is found if it is in either the custom or the built-in dictionary for the script.
+     *
+     * The dictionary is in the ICU .dict format, including the standard ICU data header,
+     * as written by the gendict tool; it contains a UCharsTrie or a BytesTrie.
+     * The data is not copied: It can be in a memory-mapped file, and it can be
+     * shared by any number of break iterators. It must remain valid and unchanged
+     * as long as this break iterator or any clone of it is in use.
+     *
+     * For Chinese and Japanese, the dictionary values are word costs,
+     * like in the built-in dictionary: Lower values make words more likely,
+     * with 255 for rare words. For a word in both dictionaries the custom cost is used.
+     * Other scripts ignore the values.
+     *
+     * The dictionary applies to this break iterator and to clones made after this call.
+     * Adding a dictionary for a script replaces one added earlier for the same script.
+     * Lookups use the dictionary directly, without any global lock.
+     * The iterator is reset to the start of the text.
+     *
+     * @param script The script of the dictionary words: USCRIPT_HAN for Chinese and Japanese
+     *               (USCRIPT_HIRAGANA and USCRIPT_KATAKANA are the same), USCRIPT_THAI,
+     *               USCRIPT_LAO, USCRIPT_KHMER, USCRIPT_MYANMAR, or USCRIPT_HANGUL.
+     * @param data   Pointer to the 4-aligned dictionary data, in the platform endianness.
+     * @param length Length of the data in bytes.
+     * @param status Receives errors detected by this function.
+     *               Set to U_UNSUPPORTED_ERROR if the script does not have
+     *               dictionary-based segmentation, or to U_INVALID_FORMAT_ERROR
+     *               if the data is not a valid dictionary.
+     * @draft ICU 63
+     */
+    void addCustomDictionary(UScriptCode script, const void *data, int32_t length,
+                             UErrorCode &status);
+#endif  /* U_HIDE_DRAFT_API */
+
 
 private:
     //=======================================================================
@@ -631,6 +681,23 @@ private:
       */
     void init(UErrorCode &status);
 
+    /**
+     * Allocates the break cache on first use, holding the current iteration position.
+     * The caches are not allocated by the constructors, so that clones and
+     * iterators which are never used are cheap.
+     * @return FALSE if memory allocation failed
+     * @internal (private)
+     */
+    UBool ensureBreakCache();
+
+    /**
+     * Allocates the dictionary cache on first use, when the text contains
+     * dictionary characters.
+     * @return FALSE if memory allocation failed
+     * @internal (private)
+     */
+    UBool ensureDictionaryCache();
+
     /**
      * Iterate backwards from an arbitrary position in the input text using the
      * synthesized Safe Reverse rules.
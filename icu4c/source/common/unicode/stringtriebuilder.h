@@ -54,6 +54,8 @@ enum UStringTrieBuildOption {
 
 U_NAMESPACE_BEGIN
 
+class StringTrieNodeArena;
+
 /**
  * Base class for string trie builder classes.
  *
@@ -64,7 +66,7 @@ class U_COMMON_API StringTrieBuilder : public UObject {
 public:
 #ifndef U_HIDE_INTERNAL_API
     /** @internal */
-    static UBool hashNode(const void *node);
+    static int32_t hashNode(const void *node);
     /** @internal */
     static UBool equalNodes(const void *left, const void *right);
 #endif  /* U_HIDE_INTERNAL_API */
@@ -164,13 +166,32 @@ protected:
      * @internal
      */
     Node *registerFinalValue(int32_t value, UErrorCode &errorCode);
+    /**
+     * Allocates memory for a new Node from the builder's node arena.
+     * Nodes are created with placement new on this memory;
+     * they are released all at once by deleteCompactBuilder()
+     * and must not be deleted individually.
+     * @param size the node object size
+     * @return the memory, or NULL if the allocation failed
+     * @internal
+     */
+    void *allocateNode(size_t size) const;
+    /**
+     * Releases a node that was not registered, for example a duplicate.
+     * Its memory is reused if it was the most recently allocated node.
+     * @internal
+     */
+    void releaseNode(Node *node);
 #endif  /* U_HIDE_INTERNAL_API */
 
     /*
      * C++ note:
+     * Nodes are allocated with new(allocateNode(sizeof(NodeClass))) NodeClass(...)
+     * from an arena that is released in one go after building,
+     * rather than allocating and deleting each node on the heap.
      * registerNode() and registerFinalValue() take ownership of their input nodes,
      * and only return owned nodes.
-     * If they see a failure UErrorCode, they will delete the input node.
+     * If they see a failure UErrorCode, they will release the input node.
      * If they get a NULL pointer, they will record a U_MEMORY_ALLOCATION_ERROR.
      * If there is a failure, they return NULL.
      *
@@ -186,6 +207,11 @@ protected:
     /** @internal */
     UHashtable *nodes;
 
+    // Memory for the nodes; they do not need individual heap blocks
+    // because they all live until deleteCompactBuilder().
+    /** @internal */
+    StringTrieNodeArena *nodeArena;
+
     // Do not conditionalize the following with #ifndef U_HIDE_INTERNAL_API,
     // it is needed for layout of other objects.
     /** @internal */
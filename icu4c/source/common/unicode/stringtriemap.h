@@ -0,0 +1,275 @@
+// © 2018 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+/*
+*******************************************************************************
+*   file name:  stringtriemap.h
+*   encoding:   UTF-8
+*   tab size:   8 (not used)
+*   indentation:4
+*/
+
+#ifndef __STRINGTRIEMAP_H__
+#define __STRINGTRIEMAP_H__
+
+/**
+ * \file
+ * \brief C++ API: Immutable string-to-bytes dictionary based on a UCharsTrie
+ */
+
+#include "unicode/utypes.h"
+#include "unicode/stringpiece.h"
+#include "unicode/stringtriebuilder.h"
+#include "unicode/uobject.h"
+#include "unicode/unistr.h"
+
+#ifndef U_HIDE_DRAFT_API
+
+U_NAMESPACE_BEGIN
+
+class CharString;
+class UCharsTrieBuilder;
+class UVector32;
+
+/**
+ * Immutable map from strings to variable-length byte-sequence values.
+ *
+ * The keys are stored in a UCharsTrie whose values are indexes into a side array
+ * of value byte sequences. The whole map is one contiguous, position-independent
+ * block of memory which can be written to a file with getBinary() and later
+ * used directly from a memory-mapped file with openFromMemory(), without copying.
+ * The serialized form is in the platform endianness and requires 4-byte alignment.
+ *
+ * Lookups work on UTF-16 and on UTF-8 text. Besides exact lookup, the map finds
+ * the longest key that is a prefix of a text, or all keys that are prefixes of a text,
+ * which is the core of dictionary-based segmentation and gazetteer matching.
+ *
+ * Lookups return a value index (0..size()-1), or -1 if there is no match;
+ * getValue() returns the bytes for a value index.
+ * All lookup functions are const and thread-safe.
+ *
+ * This class is not intended for public subclassing.
+ * @draft ICU 63
+ */
+class U_COMMON_API StringTrieMap : public UMemory {
+public:
+    /**
+     * Wraps serialized map data, as returned by getBinary().
+     * The data is not copied; it must remain valid and unchanged
+     * as long as the returned map is in use.
+     * @param data pointer to 4-aligned serialized data
+     * @param length length of the data in bytes; can be longer than the serialized map
+     * @param errorCode Standard ICU error code. Set to U_INVALID_FORMAT_ERROR
+     *                  if the data is not a valid serialized map.
+     * @return a new map which aliases the data, or NULL if an error occurred
+     * @draft ICU 63
+     */
+    static StringTrieMap *openFromMemory(const void *data, int32_t length, UErrorCode &errorCode);
+
+    /**
+     * Destructor.
+     * @draft ICU 63
+     */
+    ~StringTrieMap();
+
+    /**
+     * @return the number of (key, value) entries
+     * @draft ICU 63
+     */
+    int32_t size() const { return valueCount; }
+
+    /**
+     * Returns the serialized form of this map, for writing to a file
+     * and later use with openFromMemory().
+     * @param length receives the length of the serialized data in bytes
+     * @return the serialized data, owned or aliased by this map
+     * @draft ICU 63
+     */
+    const void *getBinary(int32_t &length) const {
+        length = totalSize;
+        return memory;
+    }
+
+    /**
+     * Returns the value bytes for a value index.
+     * @param valueIndex 0..size()-1, as returned by a lookup function
+     * @return the value bytes (aliases the map data), or an empty StringPiece
+     *         for an out-of-range index
+     * @draft ICU 63
+     */
+    StringPiece getValue(int32_t valueIndex) const;
+
+    /**
+     * Exact lookup.
+     * @param key the key string
+     * @return the value index for the key, or -1 if the key is not in the map
+     * @draft ICU 63
+     */
+    int32_t find(const UnicodeString &key) const;
+
+    /**
+     * Exact lookup with a UTF-8 key. Ill-formed UTF-8 never matches.
+     * @param key the UTF-8 key string
+     * @return the value index for the key, or -1 if the key is not in the map
+     * @draft ICU 63
+     */
+    int32_t findUTF8(StringPiece key) const;
+
+    /**
+     * Bulk exact lookup.
+     * @param keys array of keys
+     * @param count number of keys
+     * @param valueIndexes receives count value indexes, -1 for keys that are not in the map
+     * @draft ICU 63
+     */
+    void findAll(const UnicodeString keys[], int32_t count, int32_t valueIndexes[]) const;
+
+    /**
+     * Bulk exact lookup with UTF-8 keys.
+     * @param keys array of UTF-8 keys
+     * @param count number of keys
+     * @param valueIndexes receives count value indexes, -1 for keys that are not in the map
+     * @draft ICU 63
+     */
+    void findAllUTF8(const StringPiece keys[], int32_t count, int32_t valueIndexes[]) const;
+
+    /**
+     * Finds the longest key which is a prefix of the text.
+     * @param s UTF-16 text
+     * @param length length of the text, or -1 if NUL-terminated
+     * @param matchLength receives the length of the matching key in UTF-16 code units,
+     *                    or 0 if there is no match
+     * @return the value index of the longest matching key, or -1 if no key matches
+     * @draft ICU 63
+     */
+    int32_t matchLongest(const UChar *s, int32_t length, int32_t &matchLength) const;
+
+    /**
+     * Finds the longest key which is a prefix of the UTF-8 text.
+     * Matching stops at ill-formed UTF-8.
+     * @param s UTF-8 text
+     * @param matchLength receives the length of the matching key in bytes,
+     *                    or 0 if there is no match
+     * @return the value index of the longest matching key, or -1 if no key matches
+     * @draft ICU 63
+     */
+    int32_t matchLongestUTF8(StringPiece s, int32_t &matchLength) const;
+
+    /**
+     * Finds all keys which are prefixes of the text, shortest first.
+     * @param s UTF-16 text
+     * @param length length of the text, or -1 if NUL-terminated
+     * @param matchLengths receives the lengths of the matching keys in UTF-16 code units;
+     *                     can be NULL if capacity is 0
+     * @param valueIndexes receives the value indexes of the matching keys;
+     *                     can be NULL if capacity is 0
+     * @param capacity number of elements available in matchLengths and valueIndexes
+     * @return the number of matching keys; if larger than capacity,
+     *         then only the first capacity matches were written
+     * @draft ICU 63
+     */
+    int32_t matchAll(const UChar *s, int32_t length,
+                     int32_t *matchLengths, int32_t *valueIndexes, int32_t capacity) const;
+
+    /**
+     * Finds all keys which are prefixes of the UTF-8 text, shortest first.
+     * Matching stops at ill-formed UTF-8.
+     * @param s UTF-8 text
+     * @param matchLengths receives the lengths of the matching keys in bytes;
+     *                     can be NULL if capacity is 0
+     * @param valueIndexes receives the value indexes of the matching keys;
+     *                     can be NULL if capacity is 0
+     * @param capacity number of elements available in matchLengths and valueIndexes
+     * @return the number of matching keys; if larger than capacity,
+     *         then only the first capacity matches were written
+     * @draft ICU 63
+     */
+    int32_t matchAllUTF8(StringPiece s,
+                         int32_t *matchLengths, int32_t *valueIndexes, int32_t capacity) const;
+
+private:
+    friend class StringTrieMapBuilder;
+
+    StringTrieMap(const uint8_t *data, uint8_t *ownedData);
+    StringTrieMap(const StringTrieMap &other);  // no copy constructor
+    StringTrieMap &operator=(const StringTrieMap &other);  // no assignment operator
+
+    static UBool isValid(const uint8_t *data, int32_t length);
+
+    const uint8_t *memory;
+    uint8_t *ownedMemory;
+    const UChar *trieUChars;  // NULL for an empty map
+    const int32_t *valueOffsets;
+    const char *values;
+    int32_t valueCount;
+    int32_t totalSize;
+};
+
+/**
+ * Builder class for StringTrieMap.
+ *
+ * This class is not intended for public subclassing.
+ * @draft ICU 63
+ */
+class U_COMMON_API StringTrieMapBuilder : public UMemory {
+public:
+    /**
+     * Constructs an empty builder.
+     * @param errorCode Standard ICU error code.
+     * @draft ICU 63
+     */
+    StringTrieMapBuilder(UErrorCode &errorCode);
+
+    /**
+     * Destructor.
+     * @draft ICU 63
+     */
+    ~StringTrieMapBuilder();
+
+    /**
+     * Adds a (key, value) pair.
+     * The key must be unique; duplicates are detected by build().
+     * The key and value contents are copied.
+     * @param key the key string
+     * @param value the value bytes; can be empty
+     * @param errorCode Standard ICU error code. Its input value must
+     *                  pass the U_SUCCESS() test, or else the function returns
+     *                  immediately. Check for U_FAILURE() on output or use with
+     *                  function chaining. (See User Guide for details.)
+     * @return *this
+     * @draft ICU 63
+     */
+    StringTrieMapBuilder &add(const UnicodeString &key, StringPiece value, UErrorCode &errorCode);
+
+    /**
+     * Builds a StringTrieMap for the add()ed data.
+     * The builder can be reused after clear().
+     * The map can be empty.
+     * @param buildOption Build option for the key trie, see UStringTrieBuildOption.
+     * @param errorCode Standard ICU error code.
+     *                  Set to U_ILLEGAL_ARGUMENT_ERROR for duplicate keys.
+     * @return A new StringTrieMap for the add()ed data, or NULL if an error occurred.
+     * @draft ICU 63
+     */
+    StringTrieMap *build(UStringTrieBuildOption buildOption, UErrorCode &errorCode);
+
+    /**
+     * Removes all (key, value) pairs.
+     * @return *this
+     * @draft ICU 63
+     */
+    StringTrieMapBuilder &clear();
+
+private:
+    StringTrieMapBuilder(const StringTrieMapBuilder &other);  // no copy constructor
+    StringTrieMapBuilder &operator=(const StringTrieMapBuilder &other);  // no assignment operator
+
+    UCharsTrieBuilder *trieBuilder;
+    CharString *values;
+    UVector32 *valueOffsets;
+};
+
+U_NAMESPACE_END
+
+#endif  // U_HIDE_DRAFT_API
+
+#endif  // __STRINGTRIEMAP_H__
@@ -550,6 +550,26 @@ ubrk_getRuleStatus(UBreakIterator *bi);
 U_STABLE  int32_t U_EXPORT2
 ubrk_getRuleStatusVec(UBreakIterator *bi, int32_t *fillInVec, int32_t capacity, UErrorCode *status);
 
+#ifndef U_HIDE_DRAFT_API
+/**
+ * Finds all of the boundaries in the text, in one call.
+ * The result is the same as iterating with ubrk_first() and ubrk_next(),
+ * but some break iterators implement it more efficiently, for example
+ * sentence break iterators which suppress breaks after abbreviations.
+ * Afterwards, the iteration position is at the end of the text.
+ * @param bi        The break iterator to use
+ * @param fillInVec an array to be filled in with the boundaries, in ascending order.
+ * @param capacity  the length of the supplied vector.  A length of zero causes
+ *                  the function to return the number of boundaries, in the
+ *                  normal way, without attempting to store any values.
+ * @param status    receives error codes.
+ * @return          The number of boundaries in the text.
+ * @draft ICU 63
+ */
+U_DRAFT int32_t U_EXPORT2
+ubrk_getBoundaries(UBreakIterator *bi, int32_t *fillInVec, int32_t capacity, UErrorCode *status);
+#endif  /* U_HIDE_DRAFT_API */
+
 /**
  * Return the locale of the break iterator. You can choose between the valid and
  * the actual locale.
@@ -1571,6 +1571,64 @@ ucnv_convert(const char *toConverterName,
              int32_t sourceLength,
              UErrorCode *pErrorCode);
 
+#ifndef U_HIDE_DRAFT_API
+/**
+ * Convert a codepage buffer into Unicode with a converter that is
+ * looked up by name just for this call.
+ * This works like ucnv_toUChars() on a newly opened converter,
+ * but the converter is set up on the stack and shares the cached
+ * converter data, so that converting a short string does not allocate memory
+ * (except for the first use of a charset, and for some stateful converters).
+ * Names are cached after the first lookup.
+ *
+ * @param converterName The name of the converter, as for ucnv_open().
+ * @param dest          The output (Unicode) buffer.
+ * @param destCapacity  The number of UChars in the output buffer.
+ * @param src           The input (codepage) buffer.
+ * @param srcLength     The number of bytes in the input buffer, or -1 if NUL-terminated.
+ * @param pErrorCode    ICU error code in/out parameter.
+ *                      Must fulfill U_SUCCESS before the function call.
+ * @return Length of the complete output text in UChars, even if it exceeds the destCapacity
+ *         and a U_BUFFER_OVERFLOW_ERROR is set.
+ * @see ucnv_toUChars
+ * @see ucnv_convert
+ * @draft ICU 63
+ */
+U_DRAFT int32_t U_EXPORT2
+ucnv_convertToUChars(const char *converterName,
+                     UChar *dest, int32_t destCapacity,
+                     const char *src, int32_t srcLength,
+                     UErrorCode *pErrorCode);
+
+/**
+ * Convert a Unicode string into a codepage string with a converter that is
+ * looked up by name just for this call.
+ * This works like ucnv_fromUChars() on a newly opened converter,
+ * but the converter is set up on the stack and shares the cached
+ * converter data, so that converting a short string does not allocate memory
+ * (except for the first use of a charset, and for some stateful converters).
+ * Names are cached after the first lookup.
+ *
+ * @param converterName The name of the converter, as for ucnv_open().
+ * @param dest          The output (codepage) buffer.
+ * @param destCapacity  The number of bytes in the output buffer.
+ * @param src           The input (Unicode) buffer.
+ * @param srcLength     The number of UChars in the input buffer, or -1 if NUL-terminated.
+ * @param pErrorCode    ICU error code in/out parameter.
+ *                      Must fulfill U_SUCCESS before the function call.
+ * @return Length of the complete output text in bytes, even if it exceeds the destCapacity
+ *         and a U_BUFFER_OVERFLOW_ERROR is set.
+ * @see ucnv_fromUChars
+ * @see ucnv_convert
+ * @draft ICU 63
+ */
+U_DRAFT int32_t U_EXPORT2
+ucnv_convertFromUChars(const char *converterName,
+                       char *dest, int32_t destCapacity,
+                       const UChar *src, int32_t srcLength,
+                       UErrorCode *pErrorCode);
+#endif  /* U_HIDE_DRAFT_API */
+
 /**
  * Convert from one external charset to another.
  * Internally, the text is converted to and from the 16-bit Unicode "pivot"
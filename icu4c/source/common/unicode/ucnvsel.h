@@ -184,6 +184,54 @@ U_STABLE UEnumeration * U_EXPORT2
 ucnvsel_selectForUTF8(const UConverterSelector* sel,
                       const char *s, int32_t length, UErrorCode *status);
 
+#ifndef U_HIDE_DRAFT_API
+/**
+ * Select converters that can map all characters in all of several UTF-16 strings,
+ * ignoring the excluded code points.
+ * This is equivalent to intersecting the results of ucnvsel_selectForString()
+ * for each of the strings, but stops as soon as the result cannot change any more.
+ *
+ * @param sel a selector
+ * @param strings array of count UTF-16 strings
+ * @param lengths array of count string lengths, each -1 if NUL-terminated;
+ *                can be NULL if all strings are NUL-terminated
+ * @param count number of strings
+ * @param status an in/out ICU UErrorCode
+ * @return an enumeration containing encoding names.
+ *         The returned encoding names and their order will be the same as
+ *         supplied when building the selector.
+ *
+ * @draft ICU 63
+ */
+U_DRAFT UEnumeration * U_EXPORT2
+ucnvsel_selectForStrings(const UConverterSelector* sel,
+                         const UChar *const *strings, const int32_t *lengths,
+                         int32_t count, UErrorCode *status);
+
+/**
+ * Select converters that can map all characters in all of several UTF-8 strings,
+ * ignoring the excluded code points.
+ * This is equivalent to intersecting the results of ucnvsel_selectForUTF8()
+ * for each of the strings, but stops as soon as the result cannot change any more.
+ *
+ * @param sel a selector
+ * @param strings array of count UTF-8 strings
+ * @param lengths array of count string lengths, each -1 if NUL-terminated;
+ *                can be NULL if all strings are NUL-terminated
+ * @param count number of strings
+ * @param status an in/out ICU UErrorCode
+ * @return an enumeration containing encoding names.
+ *         The returned encoding names and their order will be the same as
+ *         supplied when building the selector.
+ *
+ * @draft ICU 63
+ */
+U_DRAFT UEnumeration * U_EXPORT2
+ucnvsel_selectForUTF8Strings(const UConverterSelector* sel,
+                             const char *const *strings, const int32_t *lengths,
+                             int32_t count, UErrorCode *status);
+#endif  /* U_HIDE_DRAFT_API */
+
 #endif  /* !UCONFIG_NO_CONVERSION */
 
 #endif  /* __ICU_UCNV_SEL_H__ */
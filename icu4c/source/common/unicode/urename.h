@@ -483,6 +483,7 @@
 #define ubrk_following U_ICU_ENTRY_POINT_RENAME(ubrk_following)
 #define ubrk_getAvailable U_ICU_ENTRY_POINT_RENAME(ubrk_getAvailable)
 #define ubrk_getBinaryRules U_ICU_ENTRY_POINT_RENAME(ubrk_getBinaryRules)
+#define ubrk_getBoundaries U_ICU_ENTRY_POINT_RENAME(ubrk_getBoundaries)
 #define ubrk_getLocaleByType U_ICU_ENTRY_POINT_RENAME(ubrk_getLocaleByType)
 #define ubrk_getRuleStatus U_ICU_ENTRY_POINT_RENAME(ubrk_getRuleStatus)
 #define ubrk_getRuleStatusVec U_ICU_ENTRY_POINT_RENAME(ubrk_getRuleStatusVec)
@@ -608,6 +609,8 @@
 #define ucnv_compareNames U_ICU_ENTRY_POINT_RENAME(ucnv_compareNames)
 #define ucnv_convert U_ICU_ENTRY_POINT_RENAME(ucnv_convert)
 #define ucnv_convertEx U_ICU_ENTRY_POINT_RENAME(ucnv_convertEx)
+#define ucnv_convertFromUChars U_ICU_ENTRY_POINT_RENAME(ucnv_convertFromUChars)
+#define ucnv_convertToUChars U_ICU_ENTRY_POINT_RENAME(ucnv_convertToUChars)
 #define ucnv_countAliases U_ICU_ENTRY_POINT_RENAME(ucnv_countAliases)
 #define ucnv_countAvailable U_ICU_ENTRY_POINT_RENAME(ucnv_countAvailable)
 #define ucnv_countStandards U_ICU_ENTRY_POINT_RENAME(ucnv_countStandards)
@@ -617,6 +620,7 @@
 #define ucnv_createConverterFromSharedData U_ICU_ENTRY_POINT_RENAME(ucnv_createConverterFromSharedData)
 #define ucnv_detectUnicodeSignature U_ICU_ENTRY_POINT_RENAME(ucnv_detectUnicodeSignature)
 #define ucnv_enableCleanup U_ICU_ENTRY_POINT_RENAME(ucnv_enableCleanup)
+#define ucnv_extBuildToUIndex U_ICU_ENTRY_POINT_RENAME(ucnv_extBuildToUIndex)
 #define ucnv_extContinueMatchFromU U_ICU_ENTRY_POINT_RENAME(ucnv_extContinueMatchFromU)
 #define ucnv_extContinueMatchToU U_ICU_ENTRY_POINT_RENAME(ucnv_extContinueMatchToU)
 #define ucnv_extGetUnicodeSet U_ICU_ENTRY_POINT_RENAME(ucnv_extGetUnicodeSet)
@@ -642,6 +646,7 @@
 #define ucnv_getDefaultName U_ICU_ENTRY_POINT_RENAME(ucnv_getDefaultName)
 #define ucnv_getDisplayName U_ICU_ENTRY_POINT_RENAME(ucnv_getDisplayName)
 #define ucnv_getFromUCallBack U_ICU_ENTRY_POINT_RENAME(ucnv_getFromUCallBack)
+#define ucnv_getFromUUnassignedAction U_ICU_ENTRY_POINT_RENAME(ucnv_getFromUUnassignedAction)
 #define ucnv_getInvalidChars U_ICU_ENTRY_POINT_RENAME(ucnv_getInvalidChars)
 #define ucnv_getInvalidUChars U_ICU_ENTRY_POINT_RENAME(ucnv_getInvalidUChars)
 #define ucnv_getMaxCharSize U_ICU_ENTRY_POINT_RENAME(ucnv_getMaxCharSize)
@@ -655,6 +660,7 @@
 #define ucnv_getStarters U_ICU_ENTRY_POINT_RENAME(ucnv_getStarters)
 #define ucnv_getSubstChars U_ICU_ENTRY_POINT_RENAME(ucnv_getSubstChars)
 #define ucnv_getToUCallBack U_ICU_ENTRY_POINT_RENAME(ucnv_getToUCallBack)
+#define ucnv_getToUUnassignedAction U_ICU_ENTRY_POINT_RENAME(ucnv_getToUUnassignedAction)
 #define ucnv_getType U_ICU_ENTRY_POINT_RENAME(ucnv_getType)
 #define ucnv_getUnicodeSet U_ICU_ENTRY_POINT_RENAME(ucnv_getUnicodeSet)
 #define ucnv_incrementRefCount U_ICU_ENTRY_POINT_RENAME(ucnv_incrementRefCount)
@@ -697,7 +703,9 @@
 #define ucnvsel_open U_ICU_ENTRY_POINT_RENAME(ucnvsel_open)
 #define ucnvsel_openFromSerialized U_ICU_ENTRY_POINT_RENAME(ucnvsel_openFromSerialized)
 #define ucnvsel_selectForString U_ICU_ENTRY_POINT_RENAME(ucnvsel_selectForString)
+#define ucnvsel_selectForStrings U_ICU_ENTRY_POINT_RENAME(ucnvsel_selectForStrings)
 #define ucnvsel_selectForUTF8 U_ICU_ENTRY_POINT_RENAME(ucnvsel_selectForUTF8)
+#define ucnvsel_selectForUTF8Strings U_ICU_ENTRY_POINT_RENAME(ucnvsel_selectForUTF8Strings)
 #define ucnvsel_serialize U_ICU_ENTRY_POINT_RENAME(ucnvsel_serialize)
 #define ucol_cloneBinary U_ICU_ENTRY_POINT_RENAME(ucol_cloneBinary)
 #define ucol_close U_ICU_ENTRY_POINT_RENAME(ucol_close)
@@ -708,6 +716,7 @@
 #define ucol_getAttribute U_ICU_ENTRY_POINT_RENAME(ucol_getAttribute)
 #define ucol_getAvailable U_ICU_ENTRY_POINT_RENAME(ucol_getAvailable)
 #define ucol_getBound U_ICU_ENTRY_POINT_RENAME(ucol_getBound)
+#define ucol_getCompactSortKey U_ICU_ENTRY_POINT_RENAME(ucol_getCompactSortKey)
 #define ucol_getContractions U_ICU_ENTRY_POINT_RENAME(ucol_getContractions)
 #define ucol_getContractionsAndExpansions U_ICU_ENTRY_POINT_RENAME(ucol_getContractionsAndExpansions)
 #define ucol_getDisplayName U_ICU_ENTRY_POINT_RENAME(ucol_getDisplayName)
@@ -1688,6 +1697,7 @@
 #define utext_freeze U_ICU_ENTRY_POINT_RENAME(utext_freeze)
 #define utext_getNativeIndex U_ICU_ENTRY_POINT_RENAME(utext_getNativeIndex)
 #define utext_getPreviousNativeIndex U_ICU_ENTRY_POINT_RENAME(utext_getPreviousNativeIndex)
+#define utext_getUTF8String U_ICU_ENTRY_POINT_RENAME(utext_getUTF8String)
 #define utext_hasMetaData U_ICU_ENTRY_POINT_RENAME(utext_hasMetaData)
 #define utext_isLengthExpensive U_ICU_ENTRY_POINT_RENAME(utext_isLengthExpensive)
 #define utext_isWritable U_ICU_ENTRY_POINT_RENAME(utext_isWritable)
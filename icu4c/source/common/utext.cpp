@@ -1658,6 +1658,17 @@ utext_openUTF8(UText *ut, const char *s, int64_t length, UErrorCode *status) {
 
 }
 
+U_CFUNC const char *
+utext_getUTF8String(UText *ut, int32_t *pLength) {
+    if (ut == NULL || ut->pFuncs != &utf8Funcs) {
+        return NULL;
+    }
+    if (pLength != NULL) {
+        *pLength = (int32_t)utext_nativeLength(ut);
+    }
+    return (const char *)ut->context;
+}
+
 
 
 
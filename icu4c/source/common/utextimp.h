@@ -0,0 +1,27 @@
+// © 2018 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+
+// utextimp.h
+// Internal UText functions.
+
+#ifndef __UTEXTIMP_H__
+#define __UTEXTIMP_H__
+
+#include "unicode/utypes.h"
+#include "unicode/utext.h"
+
+/**
+ * If the UText was opened with utext_openUTF8() (or is a clone of such a UText),
+ * returns a pointer to its UTF-8 string, for direct access with the U8_ macros.
+ * Native indexes of the UText are byte offsets into this string.
+ * Otherwise returns NULL.
+ *
+ * @param ut the UText
+ * @param pLength receives the length of the string in bytes, if not NULL
+ * @return the UTF-8 string, or NULL
+ * @internal
+ */
+U_CFUNC const char *
+utext_getUTF8String(UText *ut, int32_t *pLength);
+
+#endif
@@ -118,6 +118,27 @@ int32_t binarySearch(const UVector &list, const UnicodeString &s, const Collator
     }
 }
 
+UBool hasMultiplePrimaryWeights(
+        const RuleBasedCollator &coll, uint32_t variableTop,
+        const UnicodeString &s, UVector64 &ces, UErrorCode &errorCode) {
+    ces.removeAllElements();
+    coll.internalGetCEs(s, ces, errorCode);
+    if (U_FAILURE(errorCode)) { return FALSE; }
+    UBool seenPrimary = FALSE;
+    for (int32_t i = 0; i < ces.size(); ++i) {
+        int64_t ce = ces.elementAti(i);
+        uint32_t p = (uint32_t)(ce >> 32);
+        if (p > variableTop) {
+            // not primary ignorable
+            if (seenPrimary) {
+                return TRUE;
+            }
+            seenPrimary = TRUE;
+        }
+    }
+    return FALSE;
+}
+
 }  // namespace
 
 // The BucketList is not in the anonymous namespace because only Clang
@@ -125,12 +146,14 @@ int32_t binarySearch(const UVector &list, const UnicodeString &s, const Collator
 // However, we also don't need U_I18N_API because it is not used from outside the i18n library.
 class BucketList : public UObject {
 public:
-    BucketList(UVector *bucketList, UVector *publicBucketList)
+    BucketList(UVector *bucketList, UVector *publicBucketList,
+               const RuleBasedCollator &collatorPrimaryOnly, UErrorCode &errorCode)
             : bucketList_(bucketList), immutableVisibleList_(publicBucketList) {
         int32_t displayIndex = 0;
         for (int32_t i = 0; i < publicBucketList->size(); ++i) {
             getBucket(*publicBucketList, i)->displayIndex_ = displayIndex++;
         }
+        initBoundaryPrimaries(collatorPrimaryOnly, errorCode);
     }
 
     // The virtual destructor must not be inline.
@@ -141,17 +164,30 @@ public:
         return immutableVisibleList_->size();
     }
 
-    int32_t getBucketIndex(const UnicodeString &name, const Collator &collatorPrimaryOnly,
-                           UErrorCode &errorCode) {
+    int32_t getBucketIndex(const UnicodeString &name, const RuleBasedCollator &collatorPrimaryOnly,
+                           UErrorCode &errorCode) const {
+        // Most bucket boundaries are single characters with one primary weight,
+        // so the name's first primary weight usually decides the bucket
+        // without a full string comparison.
+        uint32_t namePrimary = collatorPrimaryOnly.internalGetFirstPrimary(name, errorCode);
+        if (U_FAILURE(errorCode)) { return 0; }
         // binary search
         int32_t start = 0;
         int32_t limit = bucketList_->size();
         while ((start + 1) < limit) {
             int32_t i = (start + limit) / 2;
-            const AlphabeticIndex::Bucket *bucket = getBucket(*bucketList_, i);
-            UCollationResult nameVsBucket =
-                collatorPrimaryOnly.compare(name, bucket->lowerBoundary_, errorCode);
-            if (nameVsBucket < 0) {
+            const BoundaryPrimary &boundary = boundaryPrimaries_[i];
+            UBool nameIsLess;
+            if (namePrimary != boundary.primary) {
+                nameIsLess = namePrimary < boundary.primary;
+            } else if (boundary.isSingle) {
+                nameIsLess = FALSE;
+            } else {
+                const AlphabeticIndex::Bucket *bucket = getBucket(*bucketList_, i);
+                nameIsLess = collatorPrimaryOnly.compare(
+                    name, bucket->lowerBoundary_, errorCode) < 0;
+            }
+            if (nameIsLess) {
                 limit = i;
             } else {
                 start = i;
@@ -168,8 +204,70 @@ public:
     UVector *bucketList_;
     /** Just the visible buckets. */
     UVector *immutableVisibleList_;
+
+private:
+    struct BoundaryPrimary {
+        /** The first primary weight of the bucket's lower boundary, see internalGetFirstPrimary(). */
+        uint32_t primary;
+        /**
+         * TRUE if the lower boundary has only this one primary weight,
+         * so that any name with the same first primary weight sorts into this bucket or later.
+         */
+        UBool isSingle;
+    };
+
+    void initBoundaryPrimaries(const RuleBasedCollator &collatorPrimaryOnly, UErrorCode &errorCode) {
+        int32_t count = bucketList_->size();
+        if (U_FAILURE(errorCode) || count == 0) { return; }
+        if (boundaryPrimaries_.allocateInsteadAndReset(count) == NULL) {
+            errorCode = U_MEMORY_ALLOCATION_ERROR;
+            return;
+        }
+        uint32_t variableTop;
+        if (collatorPrimaryOnly.getAttribute(UCOL_ALTERNATE_HANDLING, errorCode) == UCOL_SHIFTED) {
+            variableTop = collatorPrimaryOnly.getVariableTop(errorCode);
+        } else {
+            variableTop = 0;
+        }
+        // With the case level, equal primary weights do not make strings equal.
+        UBool caseLevel =
+            collatorPrimaryOnly.getAttribute(UCOL_CASE_LEVEL, errorCode) == UCOL_ON;
+        UVector64 ces(errorCode);
+        for (int32_t i = 0; i < count && U_SUCCESS(errorCode); ++i) {
+            const AlphabeticIndex::Bucket *bucket = getBucket(*bucketList_, i);
+            BoundaryPrimary &boundary = boundaryPrimaries_[i];
+            boundary.primary =
+                collatorPrimaryOnly.internalGetFirstPrimary(bucket->lowerBoundary_, errorCode);
+            boundary.isSingle = !caseLevel && boundary.primary != 0 &&
+                !hasMultiplePrimaryWeights(collatorPrimaryOnly, variableTop,
+                                           bucket->lowerBoundary_, ces, errorCode);
+        }
+    }
+
+    /** The first primary weight of each bucket's lower boundary, parallel to bucketList_. */
+    LocalMemory<BoundaryPrimary> boundaryPrimaries_;
 };
 
+namespace {
+
+/**
+ * Buckets each of the names.
+ */
+void getBucketIndices(const BucketList &buckets, const RuleBasedCollator &collatorPrimaryOnly,
+                      const UnicodeString names[], int32_t length, int32_t *indices,
+                      UErrorCode &errorCode) {
+    if (U_FAILURE(errorCode)) { return; }
+    if (length < 0 || (length > 0 && (names == NULL || indices == NULL))) {
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    for (int32_t i = 0; i < length; ++i) {
+        indices[i] = buckets.getBucketIndex(names[i], collatorPrimaryOnly, errorCode);
+    }
+}
+
+}  // namespace
+
 BucketList::~BucketList() {
     delete bucketList_;
     if (immutableVisibleList_ != bucketList_) {
@@ -190,7 +288,16 @@ AlphabeticIndex::ImmutableIndex::getBucketCount() const {
 int32_t
 AlphabeticIndex::ImmutableIndex::getBucketIndex(
         const UnicodeString &name, UErrorCode &errorCode) const {
-    return buckets_->getBucketIndex(name, *collatorPrimaryOnly_, errorCode);
+    return buckets_->getBucketIndex(
+        name, *static_cast<const RuleBasedCollator *>(collatorPrimaryOnly_), errorCode);
+}
+
+void
+AlphabeticIndex::ImmutableIndex::getBucketIndices(
+        const UnicodeString names[], int32_t length, int32_t *indices,
+        UErrorCode &errorCode) const {
+    icu::getBucketIndices(*buckets_, *static_cast<const RuleBasedCollator *>(collatorPrimaryOnly_),
+                          names, length, indices, errorCode);
 }
 
 const AlphabeticIndex::Bucket *
@@ -393,27 +500,6 @@ const UnicodeString &fixLabel(const UnicodeString &current, UnicodeString &temp)
     return temp.setTo(current, BASE_LENGTH);
 }
 
-UBool hasMultiplePrimaryWeights(
-        const RuleBasedCollator &coll, uint32_t variableTop,
-        const UnicodeString &s, UVector64 &ces, UErrorCode &errorCode) {
-    ces.removeAllElements();
-    coll.internalGetCEs(s, ces, errorCode);
-    if (U_FAILURE(errorCode)) { return FALSE; }
-    UBool seenPrimary = FALSE;
-    for (int32_t i = 0; i < ces.size(); ++i) {
-        int64_t ce = ces.elementAti(i);
-        uint32_t p = (uint32_t)(ce >> 32);
-        if (p > variableTop) {
-            // not primary ignorable
-            if (seenPrimary) {
-                return TRUE;
-            }
-            seenPrimary = TRUE;
-        }
-    }
-    return FALSE;
-}
-
 }  // namespace
 
 BucketList *AlphabeticIndex::createBucketList(UErrorCode &errorCode) const {
@@ -544,12 +630,17 @@ BucketList *AlphabeticIndex::createBucketList(UErrorCode &errorCode) const {
     if (U_FAILURE(errorCode)) { return NULL; }
     if (bucketList->size() == 1) {
         // No real labels, show only the underflow label.
-        BucketList *bl = new BucketList(bucketList.getAlias(), bucketList.getAlias());
+        BucketList *bl = new BucketList(bucketList.getAlias(), bucketList.getAlias(),
+                                        *collatorPrimaryOnly_, errorCode);
         if (bl == NULL) {
             errorCode = U_MEMORY_ALLOCATION_ERROR;
             return NULL;
         }
         bucketList.orphan();
+        if (U_FAILURE(errorCode)) {
+            delete bl;
+            return NULL;
+        }
         return bl;
     }
     // overflow bucket
@@ -576,12 +667,17 @@ BucketList *AlphabeticIndex::createBucketList(UErrorCode &errorCode) const {
 
     if (U_FAILURE(errorCode)) { return NULL; }
     if (!hasInvisibleBuckets) {
-        BucketList *bl = new BucketList(bucketList.getAlias(), bucketList.getAlias());
+        BucketList *bl = new BucketList(bucketList.getAlias(), bucketList.getAlias(),
+                                        *collatorPrimaryOnly_, errorCode);
         if (bl == NULL) {
             errorCode = U_MEMORY_ALLOCATION_ERROR;
             return NULL;
         }
         bucketList.orphan();
+        if (U_FAILURE(errorCode)) {
+            delete bl;
+            return NULL;
+        }
         return bl;
     }
     // Merge inflow buckets that are visually adjacent.
@@ -615,13 +711,18 @@ BucketList *AlphabeticIndex::createBucketList(UErrorCode &errorCode) const {
         }
     }
     if (U_FAILURE(errorCode)) { return NULL; }
-    BucketList *bl = new BucketList(bucketList.getAlias(), publicBucketList.getAlias());
+    BucketList *bl = new BucketList(bucketList.getAlias(), publicBucketList.getAlias(),
+                                    *collatorPrimaryOnly_, errorCode);
     if (bl == NULL) {
         errorCode = U_MEMORY_ALLOCATION_ERROR;
         return NULL;
     }
     bucketList.orphan();
     publicBucketList.orphan();
+    if (U_FAILURE(errorCode)) {
+        delete bl;
+        return NULL;
+    }
     return bl;
 }
 
@@ -1106,6 +1207,16 @@ int32_t AlphabeticIndex::getBucketIndex(const UnicodeString &name, UErrorCode &s
 }
 
 
+void AlphabeticIndex::getBucketIndices(const UnicodeString names[], int32_t length,
+                                       int32_t *indices, UErrorCode &status) {
+    initBuckets(status);
+    if (U_FAILURE(status)) {
+        return;
+    }
+    icu::getBucketIndices(*buckets_, *collatorPrimaryOnly_, names, length, indices, status);
+}
+
+
 int32_t AlphabeticIndex::getBucketIndex() const {
     return labelsIterIndex_;
 }
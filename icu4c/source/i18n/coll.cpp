@@ -54,9 +54,11 @@
 #include "ucol_imp.h"
 #include "cstring.h"
 #include "cmemory.h"
+#include "mutex.h"
 #include "umutex.h"
 #include "servloc.h"
 #include "uassert.h"
+#include "uhash.h"
 #include "ustrenum.h"
 #include "uresimp.h"
 #include "ucln_in.h"
@@ -69,6 +71,14 @@ static icu::UInitOnce gServiceInitOnce = U_INITONCE_INITIALIZER;
 #endif
 static icu::UInitOnce gAvailableLocaleListInitOnce;
 
+// Prototype collators for createInstance(), keyed by full locale ID.
+// Values are CollatorPrototype objects.
+// This is not the UnifiedCache: Its values must not hold references to
+// other cached objects, but each collator holds on to its CollationCacheEntry.
+static UHashtable *gPrototypes = NULL;
+static icu::UInitOnce gPrototypesInitOnce = U_INITONCE_INITIALIZER;
+static UMutex gPrototypesMutex = U_MUTEX_INITIALIZER;
+
 /**
  * Release all static memory held by collator.
  */
@@ -87,6 +97,11 @@ static UBool U_CALLCONV collator_cleanup(void) {
     }
     availableLocaleListCount = 0;
     gAvailableLocaleListInitOnce.reset();
+    if (gPrototypes) {
+        uhash_close(gPrototypes);
+        gPrototypes = NULL;
+    }
+    gPrototypesInitOnce.reset();
     return TRUE;
 }
 
@@ -421,6 +436,97 @@ void setAttributesFromKeywords(const Locale &loc, Collator &coll, UErrorCode &er
     }
 }
 
+/**
+ * A collator for one locale ID with the keyword settings applied,
+ * together with the warning from its creation.
+ */
+struct CollatorPrototype : public UMemory {
+    CollatorPrototype(Collator *c, UErrorCode warning) : coll(c), status(warning) {}
+    ~CollatorPrototype() { delete coll; }
+
+    Collator *coll;
+    UErrorCode status;
+};
+
+/**
+ * Enough for the locales an application typically uses.
+ * When the table is full, it is cleared rather than growing without bounds
+ * for arbitrary combinations of keywords.
+ */
+const int32_t MAX_PROTOTYPES = 100;
+
+void U_CALLCONV deletePrototype(void *obj) {
+    delete static_cast<CollatorPrototype *>(obj);
+}
+
+void U_CALLCONV initPrototypes(UErrorCode &errorCode) {
+    U_ASSERT(gPrototypes == NULL);
+    ucln_i18n_registerCleanup(UCLN_I18N_COLLATOR, collator_cleanup);
+    gPrototypes = uhash_open(uhash_hashChars, uhash_compareChars, NULL, &errorCode);
+    if (U_FAILURE(errorCode)) {
+        gPrototypes = NULL;
+        return;
+    }
+    uhash_setKeyDeleter(gPrototypes, uprv_free);
+    uhash_setValueDeleter(gPrototypes, deletePrototype);
+}
+
+/**
+ * Returns a clone of the prototype for the locale ID, or NULL if there is none yet.
+ * Sets the creation warning of the prototype.
+ */
+Collator *clonePrototype(const Locale &loc, UErrorCode &errorCode) {
+    umtx_initOnce(gPrototypesInitOnce, &initPrototypes, errorCode);
+    if (U_FAILURE(errorCode)) {
+        return NULL;
+    }
+    Mutex lock(&gPrototypesMutex);
+    const CollatorPrototype *prototype =
+        static_cast<const CollatorPrototype *>(uhash_get(gPrototypes, loc.getName()));
+    if (prototype == NULL) {
+        return NULL;
+    }
+    // The clone shares the tailoring and the settings with the prototype.
+    Collator *result = prototype->coll->clone();
+    if (result == NULL) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+        return NULL;
+    }
+    if (prototype->status != U_ZERO_ERROR) {
+        errorCode = prototype->status;
+    }
+    return result;
+}
+
+/**
+ * Stores a clone of the newly created collator as the prototype for the locale ID.
+ * Failure to do so is not an error for the caller.
+ */
+void addPrototype(const Locale &loc, const Collator &coll, UErrorCode warning) {
+    if (gPrototypes == NULL) {
+        return;
+    }
+    LocalPointer<CollatorPrototype> prototype(new CollatorPrototype(coll.clone(), warning));
+    if (prototype.isNull() || prototype->coll == NULL) {
+        return;
+    }
+    char *key = uprv_strdup(loc.getName());
+    if (key == NULL) {
+        return;
+    }
+    UErrorCode errorCode = U_ZERO_ERROR;
+    Mutex lock(&gPrototypesMutex);
+    if (uhash_get(gPrototypes, key) != NULL) {
+        // Another thread was faster.
+        uprv_free(key);
+        return;
+    }
+    if (uhash_count(gPrototypes) >= MAX_PROTOTYPES) {
+        uhash_removeAll(gPrototypes);
+    }
+    uhash_put(gPrototypes, key, prototype.orphan(), &errorCode);
+}
+
 }  // namespace
 
 Collator* U_EXPORT2 Collator::createInstance(UErrorCode& success) 
@@ -444,12 +550,24 @@ Collator* U_EXPORT2 Collator::createInstance(const Locale& desiredLocale,
     if (hasService()) {
         Locale actualLoc;
         coll = (Collator*)gService->get(desiredLocale, &actualLoc, status);
+        setAttributesFromKeywords(desiredLocale, *coll, status);
     } else
 #endif
     {
-        coll = makeInstance(desiredLocale, status);
+        // Clone a cached collator for the same locale ID if there is one.
+        coll = clonePrototype(desiredLocale, status);
+        if (coll == NULL && U_SUCCESS(status)) {
+            UErrorCode creationStatus = U_ZERO_ERROR;
+            coll = makeInstance(desiredLocale, creationStatus);
+            setAttributesFromKeywords(desiredLocale, *coll, creationStatus);
+            if (U_SUCCESS(creationStatus)) {
+                addPrototype(desiredLocale, *coll, creationStatus);
+            }
+            if (creationStatus != U_ZERO_ERROR) {
+                status = creationStatus;
+            }
+        }
     }
-    setAttributesFromKeywords(desiredLocale, *coll, status);
     if (U_FAILURE(status)) {
         delete coll;
         return NULL;
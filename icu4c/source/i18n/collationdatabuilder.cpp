@@ -1489,8 +1489,10 @@ CollationDataBuilder::buildFastLatinTable(CollationData &data, UErrorCode &error
     if(fastLatinBuilder->forData(data, errorCode)) {
         const uint16_t *table = fastLatinBuilder->getTable();
         int32_t length = fastLatinBuilder->lengthOfTable();
+        // Ignore the version in the first header word:
+        // An older base table with the same contents is compatible.
         if(base != NULL && length == base->fastLatinTableLength &&
-                uprv_memcmp(table, base->fastLatinTable, length * 2) == 0) {
+                uprv_memcmp(table + 1, base->fastLatinTable + 1, (length - 1) * 2) == 0) {
             // Same fast Latin table as in the base, use that one instead.
             delete fastLatinBuilder;
             fastLatinBuilder = NULL;
@@ -340,14 +340,16 @@ CollationDataReader::read(const CollationTailoring *base, const uint8_t *inBytes
     if(data != NULL) {
         data->fastLatinTable = NULL;
         data->fastLatinTableLength = 0;
-        if(((inIndexes[IX_OPTIONS] >> 16) & 0xff) == CollationFastLatin::VERSION) {
+        int32_t fastLatinVersion = (inIndexes[IX_OPTIONS] >> 16) & 0xff;
+        if(CollationFastLatin::MIN_COMPATIBLE_VERSION <= fastLatinVersion &&
+                fastLatinVersion <= CollationFastLatin::VERSION) {
             index = IX_FAST_LATIN_TABLE_OFFSET;
             offset = getIndex(inIndexes, indexesLength, index);
             length = getIndex(inIndexes, indexesLength, index + 1) - offset;
             if(length >= 2) {
                 data->fastLatinTable = reinterpret_cast<const uint16_t *>(inBytes + offset);
                 data->fastLatinTableLength = length / 2;
-                if((*data->fastLatinTable >> 8) != CollationFastLatin::VERSION) {
+                if((*data->fastLatinTable >> 8) != fastLatinVersion) {
                     errorCode = U_INVALID_FORMAT_ERROR;  // header vs. table version mismatch
                     return;
                 }
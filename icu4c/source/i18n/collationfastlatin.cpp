@@ -114,7 +114,7 @@ CollationFastLatin::compareUTF16(const uint16_t *table, const uint16_t *primarie
     // Keep them in sync!
     // Keep compareUTF16() and compareUTF8() in sync very closely!
 
-    U_ASSERT((table[0] >> 8) == VERSION);
+    U_ASSERT(MIN_COMPATIBLE_VERSION <= (table[0] >> 8) && (table[0] >> 8) <= VERSION);
     table += (table[0] & 0xff);  // skip the header
     uint32_t variableTop = (uint32_t)options >> 16;  // see getOptions()
     options &= 0xffff;  // needed for CollationSettings::getStrength() to work
@@ -450,7 +450,7 @@ CollationFastLatin::compareUTF8(const uint16_t *table, const uint16_t *primaries
                                  const uint8_t *right, int32_t rightLength) {
     // Keep compareUTF16() and compareUTF8() in sync very closely!
 
-    U_ASSERT((table[0] >> 8) == VERSION);
+    U_ASSERT(MIN_COMPATIBLE_VERSION <= (table[0] >> 8) && (table[0] >> 8) <= VERSION);
     table += (table[0] & 0xff);  // skip the header
     uint32_t variableTop = (uint32_t)options >> 16;  // see RuleBasedCollator::getFastLatinOptions()
     options &= 0xffff;  // needed for CollationSettings::getStrength() to work
@@ -927,6 +927,11 @@ CollationFastLatin::nextPair(const uint16_t *table, UChar32 c, uint32_t ce,
             if(x == c2) {
                 index = i;
                 sIndex = nextIndex;
+                // A longer contraction might continue with a character
+                // that is not fast Latin.
+                if(sIndex != sLength && !isFastLatinAt(s16, s8, sIndex, sLength)) {
+                    return BAIL_OUT;
+                }
             }
         }
         // Return the CE or CEs for the default or contraction mapping.
@@ -943,6 +948,36 @@ CollationFastLatin::nextPair(const uint16_t *table, UChar32 c, uint32_t ce,
     }
 }
 
+UBool
+CollationFastLatin::isFastLatinAt(const UChar *s16, const uint8_t *s8,
+                                  int32_t sIndex, int32_t sLength) {
+    if(s16 != NULL) {
+        UChar c = s16[sIndex];
+        return c <= LATIN_MAX || (PUNCT_START <= c && c < PUNCT_LIMIT) ||
+            c == 0xfffe || c == 0xffff;
+    } else {
+        // Decode the same sequences as nextPair().
+        // Anything else, including ill-formed UTF-8, is handled by the normal code.
+        uint8_t b = s8[sIndex];
+        uint8_t t;
+        if(b <= 0x7f) {
+            return TRUE;
+        }
+        if(0xc2 <= b && b <= LATIN_MAX_UTF8_LEAD) {
+            return (sIndex + 1) != sLength && 0x80 <= (t = s8[sIndex + 1]) && t <= 0xbf;
+        }
+        // U+2000..U+203F and U+FFFE & U+FFFF are three-byte sequences.
+        if((sIndex + 2) < sLength || sLength < 0) {
+            if(b == 0xe2 && s8[sIndex + 1] == 0x80) {
+                return 0x80 <= (t = s8[sIndex + 2]) && t <= 0xbf;
+            } else if(b == 0xef && s8[sIndex + 1] == 0xbf) {
+                return (t = s8[sIndex + 2]) == 0xbe || t == 0xbf;
+            }
+        }
+        return FALSE;
+    }
+}
+
 uint32_t
 CollationFastLatin::getSecondaries(uint32_t variableTop, uint32_t pair) {
     if(pair <= 0xffff) {
@@ -33,7 +33,12 @@ public:
      * When the major version number of the main data format changes,
      * we can reset this fast Latin version to 1.
      */
-    static const uint16_t VERSION = 2;
+    static const uint16_t VERSION = 3;
+    /**
+     * Tables with this version or higher, up to VERSION, can be used.
+     * Version 2 tables are a subset of version 3 tables.
+     */
+    static const uint16_t MIN_COMPATIBLE_VERSION = 2;
 
     static const int32_t LATIN_MAX = 0x17f;
     static const int32_t LATIN_LIMIT = LATIN_MAX + 1;
@@ -96,6 +101,10 @@ public:
      * Also, U+0000 maps to a contraction entry, so that the fast path need not
      * check for NUL termination.
      * It usually maps to a contraction list with only the completely ignorable default value.
+     *
+     * When a suffix character matches, and the following character is not
+     * a fast Latin character, then the fast path bails out,
+     * because a longer contraction might continue with that character.
      */
     static const uint32_t CONTRACTION = 0x400;
     /**
@@ -227,6 +236,7 @@ private:
 
     static uint32_t nextPair(const uint16_t *table, UChar32 c, uint32_t ce,
                              const UChar *s16, const uint8_t *s8, int32_t &sIndex, int32_t &sLength);
+    static UBool isFastLatinAt(const UChar *s16, const uint8_t *s8, int32_t sIndex, int32_t sLength);
 
     static inline uint32_t getPrimaries(uint32_t variableTop, uint32_t pair) {
         uint32_t ce = pair & 0xffff;
@@ -254,7 +264,7 @@ private:
 
 /*
  * Format of the CollationFastLatin data table.
- * CollationFastLatin::VERSION = 2.
+ * CollationFastLatin::VERSION = 3.
  *
  * This table contains data for a Latin-text collation fastpath.
  * The data is stored as an array of uint16_t which contains the following parts.
@@ -311,6 +321,19 @@ private:
  * the maxVariable-supported special reorder groups.
  * Now the top 16 bits would need to be stored,
  * and it is simpler to store only the fast-Latin weights.
+ *
+ * -----------------
+ * Changes for version 3 (ICU 63)
+ *
+ * The data format is unchanged.
+ * A contraction list may have an entry for a suffix character x
+ * although there are longer contractions starting with x,
+ * as long as none of them continues with a fast Latin character.
+ * If there is no contraction for exactly x, then the entry maps to the
+ * default CE followed by the CE of x.
+ * The runtime code bails out when such a suffix is followed by a character
+ * that is not fast Latin.
+ * Version 2 tables do not have such entries and work unchanged.
  */
 
 U_NAMESPACE_END
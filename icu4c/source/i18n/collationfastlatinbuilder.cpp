@@ -298,6 +298,11 @@ CollationFastLatinBuilder::getCEsFromCE32(const CollationData &data, UChar32 c,
             return FALSE;
         }
     }
+    return canEncodeCEs();
+}
+
+UBool
+CollationFastLatinBuilder::canEncodeCEs() const {
     // A mapping can be completely ignorable.
     if(ce0 == 0) { return ce1 == 0; }
     // We do not support an ignorable ce0 unless it is completely ignorable.
@@ -348,43 +353,71 @@ CollationFastLatinBuilder::getCEsFromContractionCE32(const CollationData &data,
     // the default ce32 must not be another contraction.
     U_ASSERT(!Collation::isContractionCE32(ce32));
     int32_t contractionIndex = contractionCEs.size();
+    int64_t defaultCE0, defaultCE1;
     if(getCEsFromCE32(data, U_SENTINEL, ce32, errorCode)) {
-        addContractionEntry(CollationFastLatin::CONTR_CHAR_MASK, ce0, ce1, errorCode);
+        defaultCE0 = ce0;
+        defaultCE1 = ce1;
     } else {
         // Bail out for c-without-contraction.
-        addContractionEntry(CollationFastLatin::CONTR_CHAR_MASK, Collation::NO_CE, 0, errorCode);
-    }
-    // Handle an encodable contraction unless the next contraction is too long
-    // and starts with the same character.
+        defaultCE0 = Collation::NO_CE;
+        defaultCE1 = 0;
+    }
+    addContractionEntry(CollationFastLatin::CONTR_CHAR_MASK, defaultCE0, defaultCE1, errorCode);
+    // Handle each fast Latin suffix character x with the contraction for exactly x.
+    // Longer contractions starting with x are acceptable only if
+    // their next character is not fast Latin:
+    // The fast path bails out when a matching x is followed by such a character.
+    // If there are only such longer contractions,
+    // then x maps to the default CE followed by the CE of x itself.
     int32_t prevX = -1;
-    UBool addContraction = FALSE;
+    UChar prevChar = 0;
+    UBool hasSingle = FALSE;
+    UBool bailOut = FALSE;
+    int64_t suffixCE0 = 0, suffixCE1 = 0;
     UCharsTrie::Iterator suffixes(p + 2, 0, errorCode);
-    while(suffixes.next(errorCode)) {
-        const UnicodeString &suffix = suffixes.getString();
-        int32_t x = CollationFastLatin::getCharIndex(suffix.charAt(0));
-        if(x < 0) { continue; }  // ignore anything but fast Latin text
-        if(x == prevX) {
-            if(addContraction) {
-                // Bail out for all contractions starting with this character.
-                addContractionEntry(x, Collation::NO_CE, 0, errorCode);
-                addContraction = FALSE;
+    for(;;) {
+        UBool hasNext = suffixes.next(errorCode);
+        int32_t x = -1;
+        if(hasNext) {
+            x = CollationFastLatin::getCharIndex(suffixes.getString().charAt(0));
+            if(x < 0) { continue; }  // ignore anything but fast Latin text
+        }
+        if(x != prevX && prevX >= 0) {
+            if(!hasSingle && !bailOut) {
+                if(defaultCE1 == 0 &&
+                        getCEsFromDefaultAndChar(data, defaultCE0, prevChar, errorCode)) {
+                    suffixCE0 = ce0;
+                    suffixCE1 = ce1;
+                } else {
+                    bailOut = TRUE;
+                }
+            }
+            if(bailOut) {
+                addContractionEntry(prevX, Collation::NO_CE, 0, errorCode);
+            } else {
+                addContractionEntry(prevX, suffixCE0, suffixCE1, errorCode);
             }
-            continue;
         }
-        if(addContraction) {
-            addContractionEntry(prevX, ce0, ce1, errorCode);
+        if(!hasNext) { break; }
+        const UnicodeString &suffix = suffixes.getString();
+        if(x != prevX) {
+            prevX = x;
+            prevChar = suffix.charAt(0);
+            hasSingle = bailOut = FALSE;
         }
-        ce32 = (uint32_t)suffixes.getValue();
-        if(suffix.length() == 1 && getCEsFromCE32(data, U_SENTINEL, ce32, errorCode)) {
-            addContraction = TRUE;
-        } else {
-            addContractionEntry(x, Collation::NO_CE, 0, errorCode);
-            addContraction = FALSE;
+        if(bailOut) { continue; }
+        if(suffix.length() == 1) {
+            if(getCEsFromCE32(data, U_SENTINEL, (uint32_t)suffixes.getValue(), errorCode)) {
+                hasSingle = TRUE;
+                suffixCE0 = ce0;
+                suffixCE1 = ce1;
+            } else {
+                bailOut = TRUE;
+            }
+        } else if(CollationFastLatin::getCharIndex(suffix.charAt(1)) >= 0) {
+            // Bail out for all contractions starting with this character.
+            bailOut = TRUE;
         }
-        prevX = x;
-    }
-    if(addContraction) {
-        addContractionEntry(prevX, ce0, ce1, errorCode);
     }
     if(U_FAILURE(errorCode)) { return FALSE; }
     // Note: There might not be any fast Latin contractions, but
@@ -397,6 +430,37 @@ CollationFastLatinBuilder::getCEsFromContractionCE32(const CollationData &data,
     return TRUE;
 }
 
+UBool
+CollationFastLatinBuilder::getCEsFromDefaultAndChar(const CollationData &data, int64_t defaultCE,
+                                                    UChar c, UErrorCode &errorCode) {
+    if(U_FAILURE(errorCode) || defaultCE == Collation::NO_CE) { return FALSE; }
+    const CollationData *d = &data;
+    uint32_t ce32 = data.getCE32(c);
+    if(ce32 == Collation::FALLBACK_CE32) {
+        d = data.base;
+        ce32 = d->getCE32(c);
+    }
+    // c must map to a single CE, and c followed by fast Latin text must not
+    // yield different CEs.
+    // Contractions with other characters are handled by the fast path bailing out.
+    ce32 = d->getFinalCE32(ce32);
+    if(Collation::isPrefixCE32(ce32)) { return FALSE; }
+    if(Collation::isContractionCE32(ce32)) {
+        const UChar *p = d->contexts + Collation::indexFromCE32(ce32);
+        UCharsTrie::Iterator suffixes(p + 2, 0, errorCode);
+        while(suffixes.next(errorCode)) {
+            if(CollationFastLatin::getCharIndex(suffixes.getString().charAt(0)) >= 0) {
+                return FALSE;
+            }
+        }
+        ce32 = CollationData::readCE32(p);  // Default if no suffix match.
+    }
+    if(!getCEsFromCE32(*d, c, ce32, errorCode) || ce1 != 0) { return FALSE; }
+    ce1 = ce0;
+    ce0 = defaultCE;
+    return canEncodeCEs();
+}
+
 void
 CollationFastLatinBuilder::addContractionEntry(int32_t x, int64_t cce0, int64_t cce1,
                                                UErrorCode &errorCode) {
@@ -54,6 +54,9 @@ private:
                          UErrorCode &errorCode);
     UBool getCEsFromContractionCE32(const CollationData &data, uint32_t ce32,
                                     UErrorCode &errorCode);
+    UBool getCEsFromDefaultAndChar(const CollationData &data, int64_t defaultCE, UChar c,
+                                   UErrorCode &errorCode);
+    UBool canEncodeCEs() const;
     void addContractionEntry(int32_t x, int64_t cce0, int64_t cce1, UErrorCode &errorCode);
     void addUniqueCE(int64_t ce, UErrorCode &errorCode);
     uint32_t getMiniCE(int64_t ce) const;
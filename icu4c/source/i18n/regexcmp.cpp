@@ -318,6 +318,19 @@ void    RegexCompile::compile(
     //
     matchStartType();
 
+    //
+    // Limits on where a match can lie, for splitting up a find-all.
+    //
+    matchSpanInfo();
+
+    //
+    // Optimization pass 3: possessive loops
+    //   The linear-time engine doesn't backtrack, and has no use for this.
+    //
+    if ((fRXPat->fFlags & UREGEX_LINEAR) == 0) {
+        possessifyLoops();
+    }
+
     //
     // Set up fast latin-1 range sets
     //
@@ -334,6 +347,13 @@ void    RegexCompile::compile(
         fRXPat->fSets8[i].init(s);
     }
 
+    //
+    // Rewrite the compiled pattern for the linear-time match engine, if requested.
+    //   Done last, because the optimization passes above work on the normal form.
+    //
+    if (fRXPat->fFlags & UREGEX_LINEAR) {
+        linearize();
+    }
 }
 
 
@@ -773,7 +793,7 @@ UBool RegexCompile::doParseActions(int32_t action)
         //
         //  Or, if the item to be repeated is simple
         //     1.   Item to be repeated.
-        //     2.   LOOP_SR_I    set number  (assuming repeated item is a set ref)
+        //     2.   LOOP_SR_I    set number  (repeated item is a set ref or a single character)
         //     3.   LOOP_C       stack location
         {
             int32_t  topLoc = blockTopLoc(FALSE);        // location of item #1
@@ -782,10 +802,11 @@ UBool RegexCompile::doParseActions(int32_t action)
             // Check for simple constructs, which may get special optimized code.
             if (topLoc == fRXPat->fCompiledPat->size() - 1) {
                 int32_t repeatedOp = (int32_t)fRXPat->fCompiledPat->elementAti(topLoc);
+                int32_t setRefOp   = loopSetRef(repeatedOp);
 
-                if (URX_TYPE(repeatedOp) == URX_SETREF) {
-                    // Emit optimized code for [char set]+
-                    appendOp(URX_LOOP_SR_I, URX_VAL(repeatedOp));
+                if (setRefOp >= 0) {
+                    // Emit optimized code for [char set]+, or any other single character +
+                    appendOp(URX_LOOP_SR_I, URX_VAL(setRefOp));
                     frameLoc = allocateStackData(1);
                     appendOp(URX_LOOP_C, frameLoc);
                     break;
@@ -890,7 +911,7 @@ UBool RegexCompile::doParseActions(int32_t action)
         //       3.   JMP_SAV      2
         //       4.   ...
         //
-        // Or, if the body is a simple [Set],
+        // Or, if the body is a simple [Set] or a single character,
         //       1.   LOOP_SR_I    set number
         //       2.   LOOP_C       stack location
         //       ...
@@ -914,10 +935,11 @@ UBool RegexCompile::doParseActions(int32_t action)
             //   compiled to single opcode, and might be optimizable.
             if (topLoc == fRXPat->fCompiledPat->size() - 1) {
                 int32_t repeatedOp = (int32_t)fRXPat->fCompiledPat->elementAti(topLoc);
+                int32_t setRefOp   = loopSetRef(repeatedOp);
 
-                if (URX_TYPE(repeatedOp) == URX_SETREF) {
-                    // Emit optimized code for a [char set]*
-                    int32_t loopOpI = buildOp(URX_LOOP_SR_I, URX_VAL(repeatedOp));
+                if (setRefOp >= 0) {
+                    // Emit optimized code for a [char set]*, or any other single character *
+                    int32_t loopOpI = buildOp(URX_LOOP_SR_I, URX_VAL(setRefOp));
                     fRXPat->fCompiledPat->setElementAt(loopOpI, topLoc);
                     dataLoc = allocateStackData(1);
                     appendOp(URX_LOOP_C, dataLoc);
@@ -3883,6 +3905,690 @@ void RegexCompile::stripNOPs() {
 }
 
 
+//------------------------------------------------------------------------------
+//
+//   charSetForOp    For an op that matches exactly one character, get the set
+//                   of the characters that it can match.
+//                   Return FALSE, leaving the set unchanged, for any other op.
+//
+//------------------------------------------------------------------------------
+UBool RegexCompile::charSetForOp(int32_t op, UnicodeSet &set) {
+    int32_t opType  = URX_TYPE(op);
+    int32_t opValue = URX_VAL(op);
+    switch (opType) {
+    case URX_ONECHAR:
+        set.clear();
+        set.add(opValue);
+        return TRUE;
+
+    case URX_SETREF:
+        U_ASSERT(opValue > 0 && opValue < fRXPat->fSets->size());
+        set = *(UnicodeSet *)fRXPat->fSets->elementAt(opValue);
+        return TRUE;
+
+    case URX_STATIC_SETREF:
+    case URX_STAT_SETREF_N:
+        U_ASSERT(opValue > 0 && opValue < URX_LAST_SET);
+        set = *fRXPat->fStaticSets[opValue];
+        if (opType == URX_STAT_SETREF_N) {
+            set.complement();
+        }
+        return TRUE;
+
+    case URX_BACKSLASH_D:
+        set.applyIntPropertyValue(UCHAR_GENERAL_CATEGORY_MASK, U_GC_ND_MASK, *fStatus);
+        if (opValue != 0) {
+            set.complement();
+        }
+        return TRUE;
+
+    default:
+        return FALSE;
+    }
+}
+
+
+//------------------------------------------------------------------------------
+//
+//   loopSetRef      For the body of a * or + loop that matches exactly one
+//                   character, return a URX_SETREF op for the same characters,
+//                   adding a set to the pattern if the body isn't a SETREF already.
+//                   This lets the loop use the optimized LOOP_SR_I / LOOP_C code,
+//                   which saves state once for the whole loop rather than once
+//                   for each character matched.
+//                   Return -1 if the op does not match a single character.
+//
+//------------------------------------------------------------------------------
+int32_t RegexCompile::loopSetRef(int32_t op) {
+    if (URX_TYPE(op) == URX_SETREF) {
+        return op;
+    }
+    UnicodeSet set;
+    if (!charSetForOp(op, set)) {
+        return -1;
+    }
+    UnicodeSet *theSet = new UnicodeSet(set);
+    if (theSet == NULL) {
+        error(U_MEMORY_ALLOCATION_ERROR);
+        return -1;
+    }
+    int32_t setNumber = fRXPat->fSets->size();
+    fRXPat->fSets->addElement(theSet, *fStatus);
+    return buildOp(URX_SETREF, setNumber);
+}
+
+
+//------------------------------------------------------------------------------
+//
+//   possessifyLoops   Make the optimized [set]* and .* loops possessive when
+//                     giving back input could never help the rest of the pattern
+//                     to match, as with the \d+ in \d+x.
+//
+//                     This is the case when what follows the loop must begin with
+//                     a character that the loop can not match, or is the end of the
+//                     pattern. A possessive loop saves no state, so matching takes
+//                     less stack, and a failure after the loop doesn't back off
+//                     through the loop one character at a time.
+//
+//------------------------------------------------------------------------------
+void RegexCompile::possessifyLoops() {
+    if (U_FAILURE(*fStatus)) {
+        return;
+    }
+    UVector64 *code = fRXPat->fCompiledPat;
+    int32_t end = code->size();
+    for (int32_t loc=0; loc+1<end; loc++) {
+        int32_t op = (int32_t)code->elementAti(loc);
+        int32_t opType = URX_TYPE(op);
+        if (opType != URX_LOOP_SR_I && opType != URX_LOOP_DOT_I) {
+            continue;
+        }
+        int32_t loopcOp = (int32_t)code->elementAti(loc+1);
+        U_ASSERT(URX_TYPE(loopcOp) == URX_LOOP_C);
+
+        // The characters matched by the loop.
+        UnicodeSet loopChars;
+        if (opType == URX_LOOP_SR_I) {
+            loopChars = *(UnicodeSet *)fRXPat->fSets->elementAt(URX_VAL(op));
+        } else {
+            loopChars.complement();
+            if ((URX_VAL(op) & 1) == 0) {
+                loopChars.remove(0x0a);
+                if ((URX_VAL(op) & 2) == 0) {
+                    loopChars.remove(0x0b, 0x0d).remove(0x85).remove(0x2028, 0x2029);
+                }
+            }
+        }
+
+        // The characters that can begin the match of whatever follows the loop.
+        //   Capture group boundaries don't consume input, and are passed over.
+        int32_t nextLoc = loc + 2;
+        while (nextLoc < end && (URX_TYPE(code->elementAti(nextLoc)) == URX_START_CAPTURE ||
+                                 URX_TYPE(code->elementAti(nextLoc)) == URX_END_CAPTURE)) {
+            nextLoc++;
+        }
+        if (nextLoc >= end) {
+            continue;
+        }
+        int32_t nextOp = (int32_t)code->elementAti(nextLoc);
+        UnicodeSet nextChars;
+        if (URX_TYPE(nextOp) == URX_END) {
+            // Nothing follows.  A longer match is always found first.
+        } else if (URX_TYPE(nextOp) == URX_STRING) {
+            nextChars.add(fRXPat->fLiteralText.char32At(URX_VAL(nextOp)));
+        } else if (!charSetForOp(nextOp, nextChars)) {
+            continue;
+        }
+
+        if (!loopChars.containsSome(nextChars)) {
+            code->setElementAt(loopcOp | URX_LOOP_C_POSSESSIVE, loc+1);
+        }
+    }
+}
+
+
+
+
+//------------------------------------------------------------------------------
+//
+//   matchSpanInfo     Find out what limits the extent of a match, so that
+//                     RegexPattern::findAll() can divide its input into chunks
+//                     that are searched independently:
+//                       - The maximum match length.
+//                       - Whether any match could include a line terminator. If not,
+//                         no match crosses the start of a line.
+//                       - Whether a match can depend on the end of the previous
+//                         match, which is the case only for \G.
+//
+//                     Any op not known to be safe is assumed to possibly match a
+//                     line terminator.
+//
+//------------------------------------------------------------------------------
+void RegexCompile::matchSpanInfo() {
+    if (U_FAILURE(*fStatus)) {
+        return;
+    }
+    fRXPat->fMaxMatchLen = maxMatchLength(3, fRXPat->fCompiledPat->size()-1);
+
+    // The line terminators are those of the pattern's flags; a different
+    //   setting for part of the pattern, as with (?d), doesn't affect them.
+    UBool unixLines = (fRXPat->fFlags & UREGEX_UNIX_LINES) != 0;
+    UnicodeSet lineEnds;
+    if (unixLines) {
+        lineEnds.add(0x0a);
+    } else {
+        lineEnds.add(0x0a, 0x0d).add(0x85).add(0x2028, 0x2029);
+    }
+
+    UBool lineBounded = TRUE;
+    UBool chained = FALSE;
+    UVector64 *code = fRXPat->fCompiledPat;
+    int32_t end = code->size();
+    UnicodeSet set;
+    for (int32_t loc=0; loc<end; loc++) {
+        int32_t op = (int32_t)code->elementAti(loc);
+        int32_t opType = URX_TYPE(op);
+        int32_t opValue = URX_VAL(op);
+        switch (opType) {
+            // Ops that consume no input, or only input that was matched elsewhere in the pattern.
+        case URX_RESERVED_OP:
+        case URX_RESERVED_OP_N:
+        case URX_BACKTRACK:
+        case URX_END:
+        case URX_STRING_LEN:
+        case URX_STATE_SAVE:
+        case URX_NOP:
+        case URX_START_CAPTURE:
+        case URX_END_CAPTURE:
+        case URX_JMP:
+        case URX_FAIL:
+        case URX_JMP_SAV:
+        case URX_BACKSLASH_B:
+        case URX_JMP_SAV_X:
+        case URX_BACKSLASH_Z:
+        case URX_CARET:
+        case URX_DOLLAR:
+        case URX_CTR_LOOP:
+        case URX_CTR_LOOP_NG:
+        case URX_CARET_M_UNIX:
+        case URX_RELOC_OPRND:
+        case URX_STO_SP:
+        case URX_LD_SP:
+        case URX_BACKREF:
+        case URX_STO_INP_LOC:
+        case URX_JMPX:
+        case URX_LA_START:
+        case URX_LA_END:
+        case URX_BACKREF_I:
+        case URX_DOLLAR_M:
+        case URX_CARET_M:
+        case URX_LB_START:
+        case URX_LB_CONT:
+        case URX_LB_END:
+        case URX_LBN_CONT:
+        case URX_LBN_END:
+        case URX_LOOP_C:
+        case URX_BACKSLASH_BU:
+        case URX_DOLLAR_D:
+        case URX_DOLLAR_MD:
+        case URX_BACKSLASH_H:       // Horizontal white space contains no line terminators.
+        case URX_DOTANY:            // Dot matches no line terminators outside of DOTALL mode.
+            break;
+
+        case URX_DOTANY_UNIX:
+            // Matches line terminators other than \n.
+            if (!unixLines) {
+                lineBounded = FALSE;
+            }
+            break;
+
+        case URX_BACKSLASH_G:
+            chained = TRUE;
+            break;
+
+        case URX_CTR_INIT:
+        case URX_CTR_INIT_NG:
+            loc += 3;           // Skip the operands, which hold loop counts.
+            break;
+
+        case URX_BACKSLASH_V:
+            // \V can not match a line terminator, \v can.
+            if (opValue == 0) {
+                lineBounded = FALSE;
+            }
+            break;
+
+        case URX_ONECHAR:
+        case URX_ONECHAR_I:
+            // Line terminators have no case variants, and only match themselves.
+            if (lineEnds.contains(opValue)) {
+                lineBounded = FALSE;
+            }
+            break;
+
+        case URX_STRING:
+        case URX_STRING_I:
+            {
+                int32_t len = URX_VAL(code->elementAti(loc+1));
+                for (int32_t i=opValue; i<opValue+len; i++) {
+                    if (lineEnds.contains(fRXPat->fLiteralText.charAt(i))) {
+                        lineBounded = FALSE;
+                    }
+                }
+            }
+            break;
+
+        case URX_LOOP_SR_I:
+            if (((UnicodeSet *)fRXPat->fSets->elementAt(opValue))->containsSome(lineEnds)) {
+                lineBounded = FALSE;
+            }
+            break;
+
+        case URX_LOOP_DOT_I:
+            // Operand bit 0 is DOTALL mode, bit 1 is UNIX_LINES mode.
+            if ((opValue & 1) || ((opValue & 2) && !unixLines)) {
+                lineBounded = FALSE;
+            }
+            break;
+
+        default:
+            if (!charSetForOp(op, set) || set.containsSome(lineEnds)) {
+                lineBounded = FALSE;
+            }
+            break;
+        }
+    }
+    fRXPat->fLineBounded = lineBounded;
+    fRXPat->fChainedMatches = chained;
+}
+
+
+
+
+//------------------------------------------------------------------------------
+//
+//   linearize()    For patterns compiled with UREGEX_LINEAR, replace the compiled
+//                  pattern with an equivalent one that the matcher can run as a
+//                  Thompson NFA (see RegexMatcher::MatchLinear()).
+//
+//                  Every op in the rewritten code either consumes exactly one code point,
+//                  tests a condition at the current input position, records a capture
+//                  group position, or branches. Counted loops are unrolled, strings
+//                  become sequences of single characters, and the optimized [set]* and .*
+//                  loops become plain loops. Loops that can match an empty string keep
+//                  their loop-breaking ops, so that they end after an empty iteration
+//                  like they do in the backtracking engine.
+//
+//                  The capture group data is compacted to three frame slots per group,
+//                  followed by one slot for each loop-breaking input position. Nothing
+//                  else is kept in the stack frame or in the matcher data.
+//
+//                  Back references, look-around, atomic groups, possessive quantifiers
+//                  and \X need backtracking, and fail with U_REGEX_UNIMPLEMENTED.
+//
+//------------------------------------------------------------------------------
+static const int32_t LINEAR_PATTERN_MAX_SIZE = 0x8000;
+
+void RegexCompile::linearize() {
+    if (U_FAILURE(*fStatus)) {
+        return;
+    }
+    UVector64 code(*fStatus);
+    fRXPat->fLinearLoopDepth = 0;
+    linearizeBlock(0, fRXPat->fCompiledPat->size(), 0, code);
+    if (U_FAILURE(*fStatus)) {
+        return;
+    }
+
+    // Compact the capture group frame slots: group n uses slots 3*(n-1) .. 3*(n-1)+2.
+    UVector32 *groupMap = fRXPat->fGroupMap;
+    int32_t loc;
+    for (loc=0; loc<code.size(); loc++) {
+        int32_t op = (int32_t)code.elementAti(loc);
+        int32_t opType = URX_TYPE(op);
+        if (opType == URX_START_CAPTURE || opType == URX_END_CAPTURE) {
+            int32_t groupIndex = groupMap->indexOf(URX_VAL(op));
+            U_ASSERT(groupIndex >= 0);
+            code.setElementAt(buildOp(opType, groupIndex*3), loc);
+        }
+    }
+    int32_t numGroups = groupMap->size();
+    for (int32_t groupIndex=0; groupIndex<numGroups; groupIndex++) {
+        groupMap->setElementAt(groupIndex*3, groupIndex);
+    }
+
+    // The input position slots for loop breaking follow the capture groups.
+    //   Copies of an unrolled loop share their slot.
+    UVector32 inputLocSlots(*fStatus);
+    for (loc=0; loc<code.size(); loc++) {
+        int32_t op = (int32_t)code.elementAti(loc);
+        if (URX_TYPE(op) == URX_STO_INP_LOC) {
+            int32_t slotIndex = inputLocSlots.indexOf(URX_VAL(op));
+            if (slotIndex < 0) {
+                slotIndex = inputLocSlots.size();
+                inputLocSlots.addElement(URX_VAL(op), *fStatus);
+            }
+            code.setElementAt(buildOp(URX_STO_INP_LOC, numGroups*3 + slotIndex), loc);
+        }
+    }
+    fRXPat->fFrameSize = RESTACKFRAME_HDRCOUNT + numGroups*3 + inputLocSlots.size();
+
+    fRXPat->fCompiledPat->assign(code, *fStatus);
+}
+
+
+//------------------------------------------------------------------------------
+//
+//   linearizeBlock()   Rewrite the compiled pattern code from start to limit for the
+//                      linear-time engine, appending the new code to dest.
+//                      Branch targets in the block, and the block limit, are relocated.
+//                      loopDepth is the number of loops with loop breaking for empty
+//                      iterations that the block is in.
+//
+//------------------------------------------------------------------------------
+void RegexCompile::linearizeBlock(int32_t start, int32_t limit, int32_t loopDepth, UVector64 &dest) {
+    if (U_FAILURE(*fStatus)) {
+        return;
+    }
+    UVector64 *code = fRXPat->fCompiledPat;
+    UVector32  newLocs(*fStatus);       // New location for each location in the block.
+    UVector32  fixups(*fStatus);        // Locations in dest with branch targets still to relocate.
+    int32_t    loc = start;
+
+    while (loc < limit) {
+        if (dest.size() > LINEAR_PATTERN_MAX_SIZE && U_SUCCESS(*fStatus)) {
+            error(U_REGEX_PATTERN_TOO_BIG);
+        }
+        if (U_FAILURE(*fStatus)) {
+            return;
+        }
+        int32_t op      = (int32_t)code->elementAti(loc);
+        int32_t opType  = URX_TYPE(op);
+        int32_t opValue = URX_VAL(op);
+        int32_t newLoc  = dest.size();
+        int32_t opLimit = loc + 1;      // Location following this op and its operands.
+
+        switch (opType) {
+        case URX_NOP:
+            break;
+
+        case URX_STO_INP_LOC:
+            // The top of a loop with loop breaking for empty iterations, as in MatchAt().
+            //   The frame slot is relocated by linearize().
+            dest.addElement(op, *fStatus);
+            loopDepth++;
+            if (loopDepth > fRXPat->fLinearLoopDepth) {
+                fRXPat->fLinearLoopDepth = loopDepth;
+            }
+            break;
+
+        case URX_JMP_SAV_X:
+            // The end of that loop.
+            fixups.addElement(newLoc, *fStatus);
+            dest.addElement(op, *fStatus);
+            loopDepth--;
+            break;
+
+        case URX_JMP:
+        case URX_STATE_SAVE:
+        case URX_JMP_SAV:
+            fixups.addElement(newLoc, *fStatus);
+            dest.addElement(op, *fStatus);
+            break;
+
+        case URX_JMPX:
+            fixups.addElement(newLoc, *fStatus);
+            dest.addElement(buildOp(URX_JMP, opValue), *fStatus);
+            opLimit = loc + 2;
+            break;
+
+        case URX_BACKTRACK:
+        case URX_END:
+        case URX_FAIL:
+        case URX_ONECHAR:
+        case URX_ONECHAR_I:
+        case URX_START_CAPTURE:
+        case URX_END_CAPTURE:
+        case URX_STATIC_SETREF:
+        case URX_STAT_SETREF_N:
+        case URX_SETREF:
+        case URX_DOTANY:
+        case URX_DOTANY_UNIX:
+        case URX_BACKSLASH_B:
+        case URX_BACKSLASH_BU:
+        case URX_BACKSLASH_D:
+        case URX_BACKSLASH_G:
+        case URX_BACKSLASH_H:
+        case URX_BACKSLASH_V:
+        case URX_BACKSLASH_Z:
+        case URX_CARET:
+        case URX_CARET_M:
+        case URX_CARET_M_UNIX:
+        case URX_DOLLAR:
+        case URX_DOLLAR_D:
+        case URX_DOLLAR_M:
+        case URX_DOLLAR_MD:
+            dest.addElement(op, *fStatus);
+            break;
+
+        case URX_DOTANY_ALL:
+        case URX_BACKSLASH_R:
+            // These match a CR/LF sequence as a unit.
+            //   Compiles to
+            //      1.  STATE_SAVE  5
+            //      2.  ONECHAR     CR
+            //      3.  ONECHAR     LF
+            //      4.  JMP         6
+            //      5.  op          In the linear engine, does not match the CR of a CR/LF.
+            //      6.  ...
+            dest.addElement(buildOp(URX_STATE_SAVE, newLoc+4), *fStatus);
+            dest.addElement(buildOp(URX_ONECHAR, 0x0d), *fStatus);
+            dest.addElement(buildOp(URX_ONECHAR, 0x0a), *fStatus);
+            dest.addElement(buildOp(URX_JMP, newLoc+5), *fStatus);
+            dest.addElement(op, *fStatus);
+            break;
+
+        case URX_STRING:
+        case URX_STRING_I:
+            {
+                // Literal strings become a sequence of single characters.
+                //   Case insensitive strings are already case folded. The matcher needs to know
+                //   where each one starts, because an input character that case folds to
+                //   several characters can only match within a single string.
+                int32_t lenOp = (int32_t)code->elementAti(loc+1);
+                U_ASSERT(URX_TYPE(lenOp) == URX_STRING_LEN);
+                int32_t stringLen = URX_VAL(lenOp);
+                const UChar *str = fRXPat->fLiteralText.getBuffer() + opValue;
+                for (int32_t i=0; i<stringLen;) {
+                    UChar32 c;
+                    U16_NEXT(str, i, stringLen, c);
+                    if (opType == URX_STRING) {
+                        dest.addElement(buildOp(URX_ONECHAR, c), *fStatus);
+                    } else {
+                        dest.addElement(buildOp(URX_ONECHAR_I, i > U16_LENGTH(c) ? c | URX_ONECHAR_I_CONT : c), *fStatus);
+                    }
+                }
+                opLimit = loc + 2;
+            }
+            break;
+
+        case URX_LOOP_SR_I:
+        case URX_LOOP_DOT_I:
+            {
+                // Optimized [set]* or .*, followed by a URX_LOOP_C.
+                //   Compiles to a plain greedy loop
+                //      1.  STATE_SAVE  4
+                //      2.  SETREF or DOTANY, DOTANY_ALL, DOTANY_UNIX
+                //      3.  JMP         1
+                //      4.  ...
+                U_ASSERT(URX_TYPE(code->elementAti(loc+1)) == URX_LOOP_C);
+                int32_t repeatedOp;
+                if (opType == URX_LOOP_SR_I) {
+                    repeatedOp = buildOp(URX_SETREF, opValue);
+                } else if (opValue & 1) {
+                    repeatedOp = buildOp(URX_DOTANY_ALL, 0);
+                } else if (opValue & 2) {
+                    repeatedOp = buildOp(URX_DOTANY_UNIX, 0);
+                } else {
+                    repeatedOp = buildOp(URX_DOTANY, 0);
+                }
+                int32_t repeatedLen = URX_TYPE(repeatedOp) == URX_DOTANY_ALL ? 5 : 1;
+                dest.addElement(buildOp(URX_STATE_SAVE, newLoc+repeatedLen+2), *fStatus);
+                if (repeatedLen == 5) {
+                    dest.addElement(buildOp(URX_STATE_SAVE, newLoc+5), *fStatus);
+                    dest.addElement(buildOp(URX_ONECHAR, 0x0d), *fStatus);
+                    dest.addElement(buildOp(URX_ONECHAR, 0x0a), *fStatus);
+                    dest.addElement(buildOp(URX_JMP, newLoc+6), *fStatus);
+                }
+                dest.addElement(repeatedOp, *fStatus);
+                dest.addElement(buildOp(URX_JMP, newLoc), *fStatus);
+                opLimit = loc + 2;
+            }
+            break;
+
+        case URX_CTR_INIT:
+        case URX_CTR_INIT_NG:
+            {
+                // Counted loop {min,max}. The body is repeated min times, followed by
+                //   (max-min) optional copies, or by a loop if max is unbounded.
+                //   Greedy loops prefer another iteration (STATE_SAVE past the loop),
+                //   non-greedy loops prefer to skip it (JMP_SAV past the loop).
+                int32_t loopLoc  = URX_VAL(code->elementAti(loc+1));
+                int32_t minCount = (int32_t)code->elementAti(loc+2);
+                int32_t maxCount = (int32_t)code->elementAti(loc+3);
+                int32_t bodyStart = loc + 4;
+                int32_t skipType = opType == URX_CTR_INIT ? URX_STATE_SAVE : URX_JMP_SAV;
+                U_ASSERT(loopLoc >= bodyStart && loopLoc < limit);
+                if (maxCount == -1) {
+                    // Like URX_CTR_LOOP and URX_CTR_LOOP_NG in MatchAt(), an iteration past
+                    //   the minimum count that does not advance the input since the previous
+                    //   one ends the loop. The input position is kept in the frame slot that
+                    //   MatchAt() uses for it.
+                    //   Compiles to
+                    //      1.  skipType     8      if min == 0, instead of 2, 3 and 4
+                    //      2.  STO_INP_LOC  slot
+                    //      3.  body * min
+                    //      4.  JMP          7
+                    //      5.  STO_INP_LOC  slot   For the loop end op, not run.
+                    //      6.  body
+                    //      7.  JMP_SAV_X    6      For a non-greedy loop, CTR_LOOP_NG 6,
+                    //                              a JMP_SAV_X that prefers to end the loop.
+                    //      8.  ...
+                    int32_t stoOp     = buildOp(URX_STO_INP_LOC, opValue+1);
+                    int32_t skipLoc   = -1;
+                    int32_t jmpLoc    = -1;
+                    int32_t bodyDepth = loopDepth + 1;
+                    if (bodyDepth > fRXPat->fLinearLoopDepth) {
+                        fRXPat->fLinearLoopDepth = bodyDepth;
+                    }
+                    if (minCount == 0) {
+                        skipLoc = dest.size();
+                        dest.addElement(0, *fStatus);   // Branch past the loop, set below.
+                    } else {
+                        dest.addElement(stoOp, *fStatus);
+                        linearizeRepeat(bodyStart, loopLoc, minCount, bodyDepth, dest);
+                        jmpLoc = dest.size();
+                        dest.addElement(0, *fStatus);   // Branch to the loop end, set below.
+                    }
+                    dest.addElement(stoOp, *fStatus);
+                    int32_t topLoc = dest.size();
+                    linearizeBlock(bodyStart, loopLoc, bodyDepth, dest);
+                    if (jmpLoc >= 0) {
+                        dest.setElementAt(buildOp(URX_JMP, dest.size()), jmpLoc);
+                    }
+                    dest.addElement(buildOp(opType == URX_CTR_INIT ? URX_JMP_SAV_X : URX_CTR_LOOP_NG, topLoc),
+                                    *fStatus);
+                    if (skipLoc >= 0) {
+                        dest.setElementAt(buildOp(skipType, dest.size()), skipLoc);
+                    }
+                } else {
+                    linearizeRepeat(bodyStart, loopLoc, minCount, loopDepth, dest);
+                    UVector32 skipLocs(*fStatus);
+                    int32_t i;
+                    for (i=minCount; i<maxCount && U_SUCCESS(*fStatus); i++) {
+                        if (dest.size() > LINEAR_PATTERN_MAX_SIZE) {
+                            // The check in the loop over the ops is not reached for an empty body.
+                            error(U_REGEX_PATTERN_TOO_BIG);
+                            break;
+                        }
+                        skipLocs.addElement(dest.size(), *fStatus);
+                        dest.addElement(0, *fStatus);   // Branch past the loop, set below.
+                        linearizeBlock(bodyStart, loopLoc, loopDepth, dest);
+                    }
+                    for (i=0; i<skipLocs.size(); i++) {
+                        dest.setElementAt(buildOp(skipType, dest.size()), skipLocs.elementAti(i));
+                    }
+                }
+                opLimit = loopLoc + 1;
+            }
+            break;
+
+        case URX_STO_SP:
+        case URX_LD_SP:
+        case URX_LA_START:
+        case URX_LA_END:
+        case URX_LB_START:
+        case URX_LB_CONT:
+        case URX_LB_END:
+        case URX_LBN_CONT:
+        case URX_LBN_END:
+        case URX_BACKREF:
+        case URX_BACKREF_I:
+        case URX_BACKSLASH_X:
+            // Atomic and possessive constructs, look-around, back references and \X
+            //   can not be matched without backtracking.
+            error(U_REGEX_UNIMPLEMENTED);
+            break;
+
+        default:
+            // CTR_LOOP and LOOP_C are handled with the op they belong to,
+            //   operands with their op.
+            U_ASSERT(FALSE);
+            error(U_REGEX_INTERNAL_ERROR);
+        }
+
+        for (; loc<opLimit; loc++) {
+            newLocs.addElement(newLoc, *fStatus);
+        }
+    }
+    newLocs.addElement(dest.size(), *fStatus);     // The block limit.
+    if (U_FAILURE(*fStatus)) {
+        return;
+    }
+
+    // Relocate the branch targets.
+    for (int32_t i=0; i<fixups.size(); i++) {
+        int32_t fixupLoc = fixups.elementAti(i);
+        int32_t op = (int32_t)dest.elementAti(fixupLoc);
+        int32_t target = URX_VAL(op);
+        if (target < start || target > limit) {
+            U_ASSERT(FALSE);
+            error(U_REGEX_INTERNAL_ERROR);
+            return;
+        }
+        dest.setElementAt(buildOp(URX_TYPE(op), newLocs.elementAti(target-start)), fixupLoc);
+    }
+}
+
+
+//------------------------------------------------------------------------------
+//
+//   linearizeRepeat()  Append count copies of the linear code for a block of the
+//                      compiled pattern to dest, for the required iterations of a
+//                      counted loop. A block with no code, like (?:){1000000}, is
+//                      not repeated.
+//
+//------------------------------------------------------------------------------
+void RegexCompile::linearizeRepeat(int32_t start, int32_t limit, int32_t count,
+                                   int32_t loopDepth, UVector64 &dest) {
+    for (int32_t i=0; i<count && U_SUCCESS(*fStatus); i++) {
+        int32_t copyStart = dest.size();
+        linearizeBlock(start, limit, loopDepth, dest);
+        if (dest.size() == copyStart) {
+            break;
+        }
+    }
+}
 
 
 //------------------------------------------------------------------------------
@@ -26,6 +26,7 @@
 #include "uhash.h"
 #include "uvector.h"
 #include "uvectr32.h"
+#include "uvectr64.h"
 
 
 
@@ -120,6 +121,25 @@ private:
                                int32_t end);
     void        matchStartType();
     void        stripNOPs();
+    UBool       charSetForOp(int32_t op,             // Get the set of characters matched by an op
+                             UnicodeSet &set);       //   that matches exactly one character.
+    int32_t     loopSetRef(int32_t op);              // Get a SETREF op for the body of a single
+                                                     //   character * or + loop.
+    void        possessifyLoops();                   // Make loops possessive where backing off
+                                                     //   can't lead to a match.
+    void        matchSpanInfo();                     // Find where matches can lie, for use
+                                                     //   by RegexPattern::findAll().
+    void        linearize();                         // Rewrite the compiled pattern for the
+                                                     //   linear-time engine (UREGEX_LINEAR).
+    void        linearizeBlock(int32_t start,        // Rewrite one block of the compiled pattern,
+                               int32_t limit,        //   appending to dest.
+                               int32_t loopDepth,
+                               UVector64 &dest);
+    void        linearizeRepeat(int32_t start,       // Rewrite one block count times, for
+                                int32_t limit,       //   the required iterations of a
+                                int32_t count,       //   counted loop.
+                                int32_t loopDepth,
+                                UVector64 &dest);
 
     void        setEval(int32_t op);
     void        setPushOp(int32_t op);
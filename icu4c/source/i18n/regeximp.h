@@ -16,10 +16,13 @@
 
 #include "unicode/utypes.h"
 #include "unicode/uobject.h"
+#include "unicode/parseerr.h"
 #include "unicode/uniset.h"
+#include "unicode/unistr.h"
 #include "unicode/utext.h"
 
 #include "cmemory.h"
+#include "sharedobject.h"
 #include "ucase.h"
 
 U_NAMESPACE_BEGIN
@@ -252,6 +255,20 @@ enum {
 #define URX_TYPE(x)          ((uint32_t)(x) >> 24)
 #define URX_VAL(x)           ((x) & 0xffffff)
 
+//
+//  Flag in the operand of a URX_ONECHAR_I in a pattern compiled for the linear-time
+//    engine (UREGEX_LINEAR), set for the characters of a case insensitive string
+//    other than its first one.
+//
+#define URX_ONECHAR_I_CONT   0x800000
+
+//
+//  Flag in the operand of a URX_LOOP_C, set when the loop is possessive: nothing
+//    that can follow the loop begins with a character that the loop matches, so
+//    the loop never gives back input, and saves no state.
+//
+#define URX_LOOP_C_POSSESSIVE   0x800000
+
 
 //
 //  Access to Unicode Sets composite character properties
@@ -296,6 +313,17 @@ struct REStackFrame {
 // number of UVector elements in the header
 #define RESTACKFRAME_HDRCOUNT 2
 
+//
+//  Thread list for the linear-time match engine, RegexMatcher::MatchLinear().
+//    Holds one stack frame per thread, in order of decreasing thread priority.
+//    The frame's fPatIdx is the thread's position in the pattern; the fInputIdx
+//    is the input position at which the thread's match started.
+//
+struct RELinearThreads {
+    int32_t            fCount;           // Number of threads in the list.
+    int64_t           *fFrames;          // Frame storage, room for one thread per pattern op.
+};
+
 //
 //  Start-Of-Match type.  Used by find() to quickly scan to positions where a
 //                        match might start before firing up the full match engine.
@@ -409,6 +437,57 @@ class CaseFoldingUCharIterator: public UMemory {
 
 };
 
+
+// A compiled pattern, shared through the pattern cache.
+//  A RegexPattern can not be changed once compiled, so one cached
+//  pattern can serve any number of matchers, on any number of threads.
+//  Implementation in repattrn.cpp
+
+class RegexPattern;
+
+class SharedRegexPattern: public SharedObject {
+      public:
+        SharedRegexPattern(RegexPattern *patternToAdopt) : ptr(patternToAdopt) {}
+        virtual ~SharedRegexPattern();
+        const RegexPattern *get() const { return ptr; }
+
+        // Return the cached pattern for (regex, flags), compiling it if it is not
+        //  already in the cache.  The caller must removeRef() the result.
+        //  If compilation fails and pe is not NULL, the error position goes to pe.
+        static const SharedRegexPattern *getInstance(const UnicodeString &regex, uint32_t flags,
+                                                     UParseError *pe, UErrorCode &status);
+
+      private:
+        RegexPattern      *ptr;
+
+        SharedRegexPattern(const SharedRegexPattern &other);  // forbid copying of this class
+        SharedRegexPattern &operator=(const SharedRegexPattern &other);  // forbid copying of this class
+};
+
+
+// A replacement string for appendReplacement() and replaceAll(), parsed once
+//  into runs of literal text and references to capture groups, so that a
+//  replaceAll() need not rescan the replacement string for each match.
+//  Implementation in rematch.cpp
+
+class RegexReplacement: public UMemory {
+      public:
+        // Parse the replacement string.  An error in the replacement, such as a
+        //  reference to a group that does not exist, goes to fError, and is only
+        //  reported when the replacement is applied, after the parts that precede it.
+        RegexReplacement(UText *replacement, const RegexPattern &pattern, UErrorCode &status);
+
+        UnicodeString      fLiterals;      // The literal text, with escapes resolved.
+        MaybeStackArray<int32_t, 16> fParts;  // Length of a run from fLiterals if >= 0,
+                                           //   otherwise capture group number -(part+1).
+        int32_t            fPartCount;
+        UErrorCode         fError;
+
+      private:
+        void addLiteral(UChar32 c, UErrorCode &status);
+        void addPart(int32_t part, UErrorCode &status);
+};
+
 U_NAMESPACE_END
 #endif
 
@@ -303,6 +303,19 @@ RegexMatcher &RegexMatcher::appendReplacement(UText *dest,
     if (U_FAILURE(status)) {
         return *this;
     }
+    RegexReplacement parsedReplacement(replacement, *fPattern, status);
+    return appendReplacement(dest, parsedReplacement, status);
+}
+
+//
+//    appendReplacement, with a replacement that has already been parsed.
+//
+RegexMatcher &RegexMatcher::appendReplacement(UText *dest,
+                                              const RegexReplacement &replacement,
+                                              UErrorCode &status) {
+    if (U_FAILURE(status)) {
+        return *this;
+    }
     if (U_FAILURE(fDeferredStatus)) {
         status = fDeferredStatus;
         return *this;
@@ -338,12 +351,41 @@ RegexMatcher &RegexMatcher::appendReplacement(UText *dest,
     }
     fAppendPosition = fMatchEnd;
 
+    // Output the replacement, substituting the captured text for group references.
+    const UChar *literals = replacement.fLiterals.getBuffer();
+    for (int32_t i=0; i<replacement.fPartCount && U_SUCCESS(status); i++) {
+        int32_t part = replacement.fParts[i];
+        if (part >= 0) {
+            destLen += utext_replace(dest, destLen, destLen, literals, part, &status);
+            literals += part;
+        } else {
+            destLen += appendGroup(-(part+1), dest, status);
+        }
+    }
+    if (U_SUCCESS(status) && U_FAILURE(replacement.fError)) {
+        status = replacement.fError;
+    }
+
+    return *this;
+}
+
+
+//--------------------------------------------------------------------------------
+//
+//    RegexReplacement     Parse a replacement string, for appendReplacement() and
+//                         replaceAll(), into literal text and capture group references.
+//
+//--------------------------------------------------------------------------------
+RegexReplacement::RegexReplacement(UText *replacement, const RegexPattern &pattern, UErrorCode &status) :
+        fPartCount(0), fError(U_ZERO_ERROR) {
+    if (U_FAILURE(status)) {
+        return;
+    }
 
     // scan the replacement text, looking for substitutions ($n) and \escapes.
-    //  TODO:  optimize this loop by efficiently scanning for '$' or '\',
-    //         move entire ranges not containing substitutions.
     UTEXT_SETNATIVEINDEX(replacement, 0);
-    for (UChar32 c = UTEXT_NEXT32(replacement); U_SUCCESS(status) && c != U_SENTINEL;  c = UTEXT_NEXT32(replacement)) {
+    for (UChar32 c = UTEXT_NEXT32(replacement); U_SUCCESS(status) && U_SUCCESS(fError) && c != U_SENTINEL;
+            c = UTEXT_NEXT32(replacement)) {
         if (c == BACKSLASH) {
             // Backslash Escape.  Copy the following char out without further checks.
             //                    Note:  Surrogate pairs don't need any special handling
@@ -361,17 +403,7 @@ RegexMatcher &RegexMatcher::appendReplacement(UText *dest,
                 struct URegexUTextUnescapeCharContext context = U_REGEX_UTEXT_UNESCAPE_CONTEXT(replacement);
                 UChar32 escapedChar = u_unescapeAt(uregex_utext_unescape_charAt, &offset, INT32_MAX, &context);
                 if (escapedChar != (UChar32)0xFFFFFFFF) {
-                    if (U_IS_BMP(escapedChar)) {
-                        UChar c16 = (UChar)escapedChar;
-                        destLen += utext_replace(dest, destLen, destLen, &c16, 1, &status);
-                    } else {
-                        UChar surrogate[2];
-                        surrogate[0] = U16_LEAD(escapedChar);
-                        surrogate[1] = U16_TRAIL(escapedChar);
-                        if (U_SUCCESS(status)) {
-                            destLen += utext_replace(dest, destLen, destLen, surrogate, 2, &status);
-                        }
-                    }
+                    addLiteral(escapedChar, status);
                     // TODO:  Report errors for mal-formed \u escapes?
                     //        As this is, the original sequence is output, which may be OK.
                     if (context.lastOffset == offset) {
@@ -383,31 +415,11 @@ RegexMatcher &RegexMatcher::appendReplacement(UText *dest,
             } else {
                 (void)UTEXT_NEXT32(replacement);
                 // Plain backslash escape.  Just put out the escaped character.
-                if (U_IS_BMP(c)) {
-                    UChar c16 = (UChar)c;
-                    destLen += utext_replace(dest, destLen, destLen, &c16, 1, &status);
-                } else {
-                    UChar surrogate[2];
-                    surrogate[0] = U16_LEAD(c);
-                    surrogate[1] = U16_TRAIL(c);
-                    if (U_SUCCESS(status)) {
-                        destLen += utext_replace(dest, destLen, destLen, surrogate, 2, &status);
-                    }
-                }
+                addLiteral(c, status);
             }
         } else if (c != DOLLARSIGN) {
             // Normal char, not a $.  Copy it out without further checks.
-            if (U_IS_BMP(c)) {
-                UChar c16 = (UChar)c;
-                destLen += utext_replace(dest, destLen, destLen, &c16, 1, &status);
-            } else {
-                UChar surrogate[2];
-                surrogate[0] = U16_LEAD(c);
-                surrogate[1] = U16_TRAIL(c);
-                if (U_SUCCESS(status)) {
-                    destLen += utext_replace(dest, destLen, destLen, surrogate, 2, &status);
-                }
-            }
+            addLiteral(c, status);
         } else {
             // We've got a $.  Pick up a capture group name or number if one follows.
             // Consume digits so long as the resulting group number <= the number of
@@ -420,28 +432,28 @@ RegexMatcher &RegexMatcher::appendReplacement(UText *dest,
                 // Scan for a Named Capture Group, ${name}.
                 UnicodeString groupName;
                 utext_next32(replacement);
-                while(U_SUCCESS(status) && nextChar != RIGHTBRACKET) {
+                while(U_SUCCESS(fError) && nextChar != RIGHTBRACKET) {
                     nextChar = utext_next32(replacement);
                     if (nextChar == U_SENTINEL) {
-                        status = U_REGEX_INVALID_CAPTURE_GROUP_NAME;
+                        fError = U_REGEX_INVALID_CAPTURE_GROUP_NAME;
                     } else if ((nextChar >= 0x41 && nextChar <= 0x5a) ||       // A..Z
                                (nextChar >= 0x61 && nextChar <= 0x7a) ||       // a..z
                                (nextChar >= 0x31 && nextChar <= 0x39)) {       // 0..9
                         groupName.append(nextChar);
                     } else if (nextChar == RIGHTBRACKET) {
-                        groupNum = uhash_geti(fPattern->fNamedCaptureMap, &groupName);
+                        groupNum = uhash_geti(pattern.fNamedCaptureMap, &groupName);
                         if (groupNum == 0) {
-                            status = U_REGEX_INVALID_CAPTURE_GROUP_NAME;
+                            fError = U_REGEX_INVALID_CAPTURE_GROUP_NAME;
                         }
                     } else {
                         // Character was something other than a name char or a closing '}'
-                        status = U_REGEX_INVALID_CAPTURE_GROUP_NAME;
+                        fError = U_REGEX_INVALID_CAPTURE_GROUP_NAME;
                     }
                 }
 
             } else if (u_isdigit(nextChar)) {
                 // $n    Scan for a capture group number
-                int32_t numCaptureGroups = fPattern->fGroupMap->size();
+                int32_t numCaptureGroups = pattern.fGroupMap->size();
                 for (;;) {
                     nextChar = UTEXT_CURRENT32(replacement);
                     if (nextChar == U_SENTINEL) {
@@ -454,7 +466,7 @@ RegexMatcher &RegexMatcher::appendReplacement(UText *dest,
                     if (groupNum*10 + nextDigitVal > numCaptureGroups) {
                         // Don't consume the next digit if it makes the capture group number too big.
                         if (numDigits == 0) {
-                            status = U_INDEX_OUTOFBOUNDS_ERROR;
+                            fError = U_INDEX_OUTOFBOUNDS_ERROR;
                         }
                         break;
                     }
@@ -464,16 +476,39 @@ RegexMatcher &RegexMatcher::appendReplacement(UText *dest,
                 }
             } else {
                 // $ not followed by capture group name or number.
-                status = U_REGEX_INVALID_CAPTURE_GROUP_NAME;
+                fError = U_REGEX_INVALID_CAPTURE_GROUP_NAME;
             }
 
-            if (U_SUCCESS(status)) {
-                destLen += appendGroup(groupNum, dest, status);
+            if (U_SUCCESS(fError)) {
+                addPart(-(groupNum+1), status);
             }
         }  // End of $ capture group handling
     }  // End of per-character loop through the replacement string.
+}
 
-    return *this;
+void RegexReplacement::addLiteral(UChar32 c, UErrorCode &status) {
+    int32_t oldLength = fLiterals.length();
+    fLiterals.append(c);
+    int32_t length = fLiterals.length() - oldLength;
+    if (length == 0) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+    } else if (fPartCount > 0 && fParts[fPartCount-1] >= 0) {
+        fParts[fPartCount-1] += length;
+    } else {
+        addPart(length, status);
+    }
+}
+
+void RegexReplacement::addPart(int32_t part, UErrorCode &status) {
+    if (U_FAILURE(status)) {
+        return;
+    }
+    if (fPartCount == fParts.getCapacity() &&
+            fParts.resize(fPartCount * 2, fPartCount) == NULL) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    fParts[fPartCount++] = part;
 }
 
 
@@ -635,7 +670,7 @@ UBool RegexMatcher::find(UErrorCode &status) {
         return FALSE;
     }
 
-    if (UTEXT_FULL_TEXT_IN_CHUNK(fInputText, fInputLength)) {
+    if (UTEXT_FULL_TEXT_IN_CHUNK(fInputText, fInputLength) && (fPattern->fFlags & UREGEX_LINEAR) == 0) {
         return findUsingChunk(status);
     }
 
@@ -689,6 +724,18 @@ UBool RegexMatcher::find(UErrorCode &status) {
         testStartLimit = fActiveLimit - (fPattern->fMinMatchLen > 0 ? 1 : 0);
     }
 
+    if (fPattern->fFlags & UREGEX_LINEAR) {
+        // Try all of the start positions in one pass over the input.
+        MatchLinear(startPos, FALSE, TRUE, status);
+        if (U_FAILURE(status)) {
+            return FALSE;
+        }
+        if (!fMatch && fPattern->fStartType != START_START) {
+            fHitEnd = TRUE;
+        }
+        return fMatch;
+    }
+
     UChar32  c;
     U_ASSERT(startPos >= 0);
 
@@ -1469,7 +1516,9 @@ UBool RegexMatcher::lookingAt(UErrorCode &status) {
     else {
         resetPreserveRegion();
     }
-    if (UTEXT_FULL_TEXT_IN_CHUNK(fInputText, fInputLength)) {
+    if (fPattern->fFlags & UREGEX_LINEAR) {
+        MatchLinear(fActiveStart, FALSE, FALSE, status);
+    } else if (UTEXT_FULL_TEXT_IN_CHUNK(fInputText, fInputLength)) {
         MatchChunkAt((int32_t)fActiveStart, FALSE, status);
     } else {
         MatchAt(fActiveStart, FALSE, status);
@@ -1507,7 +1556,9 @@ UBool RegexMatcher::lookingAt(int64_t start, UErrorCode &status) {
         return FALSE;
     }
 
-    if (UTEXT_FULL_TEXT_IN_CHUNK(fInputText, fInputLength)) {
+    if (fPattern->fFlags & UREGEX_LINEAR) {
+        MatchLinear(nativeStart, FALSE, FALSE, status);
+    } else if (UTEXT_FULL_TEXT_IN_CHUNK(fInputText, fInputLength)) {
         MatchChunkAt((int32_t)nativeStart, FALSE, status);
     } else {
         MatchAt(nativeStart, FALSE, status);
@@ -1541,7 +1592,9 @@ UBool RegexMatcher::matches(UErrorCode &status) {
         resetPreserveRegion();
     }
 
-    if (UTEXT_FULL_TEXT_IN_CHUNK(fInputText, fInputLength)) {
+    if (fPattern->fFlags & UREGEX_LINEAR) {
+        MatchLinear(fActiveStart, TRUE, FALSE, status);
+    } else if (UTEXT_FULL_TEXT_IN_CHUNK(fInputText, fInputLength)) {
         MatchChunkAt((int32_t)fActiveStart, TRUE, status);
     } else {
         MatchAt(fActiveStart, TRUE, status);
@@ -1579,7 +1632,9 @@ UBool RegexMatcher::matches(int64_t start, UErrorCode &status) {
         return FALSE;
     }
 
-    if (UTEXT_FULL_TEXT_IN_CHUNK(fInputText, fInputLength)) {
+    if (fPattern->fFlags & UREGEX_LINEAR) {
+        MatchLinear(nativeStart, TRUE, FALSE, status);
+    } else if (UTEXT_FULL_TEXT_IN_CHUNK(fInputText, fInputLength)) {
         MatchChunkAt((int32_t)nativeStart, TRUE, status);
     } else {
         MatchAt(nativeStart, TRUE, status);
@@ -1726,9 +1781,10 @@ UText *RegexMatcher::replaceAll(UText *replacement, UText *dest, UErrorCode &sta
     }
 
     if (U_SUCCESS(status)) {
+        RegexReplacement parsedReplacement(replacement, *fPattern, status);
         reset();
         while (find()) {
-            appendReplacement(dest, replacement, status);
+            appendReplacement(dest, parsedReplacement, status);
             if (U_FAILURE(status)) {
                 break;
             }
@@ -1740,6 +1796,106 @@ UText *RegexMatcher::replaceAll(UText *replacement, UText *dest, UErrorCode &sta
 }
 
 
+//
+//    appendUTF8     Append UTF-16 text to a ByteSink, converted to UTF-8,
+//                   by way of a stack buffer.
+//
+static void appendUTF8(ByteSink &sink, const UChar *s, int32_t length, UErrorCode &status) {
+    char buffer[1024];
+    while (length > 0 && U_SUCCESS(status)) {
+        // At most 3 bytes for each UTF-16 code unit.  Don't split a surrogate pair.
+        int32_t pieceLength = length;
+        if (pieceLength > UPRV_LENGTHOF(buffer) / 3) {
+            pieceLength = UPRV_LENGTHOF(buffer) / 3;
+            if (U16_IS_LEAD(s[pieceLength-1])) {
+                --pieceLength;
+            }
+        }
+        int32_t length8 = 0;
+        u_strToUTF8WithSub(buffer, UPRV_LENGTHOF(buffer), &length8, s, pieceLength,
+                           0xFFFD,  // Standard substitution character.
+                           NULL,    // Don't care about number of substitutions.
+                           &status);
+        sink.Append(buffer, length8);
+        s += pieceLength;
+        length -= pieceLength;
+    }
+}
+
+//
+//    appendInputUTF8     Append a range of the input text to a ByteSink, as UTF-8.
+//
+void RegexMatcher::appendInputUTF8(ByteSink &sink, int64_t start, int64_t limit, UErrorCode &status) const {
+    if (start >= limit || U_FAILURE(status)) {
+        return;
+    }
+    if (UTEXT_FULL_TEXT_IN_CHUNK(fInputText, fInputLength)) {
+        appendUTF8(sink, fInputText->chunkContents+start, (int32_t)(limit-start), status);
+        return;
+    }
+    UChar buffer[256];
+    int32_t length = 0;
+    UTEXT_SETNATIVEINDEX(fInputText, start);
+    while (UTEXT_GETNATIVEINDEX(fInputText) < limit) {
+        UChar32 c = UTEXT_NEXT32(fInputText);
+        U16_APPEND_UNSAFE(buffer, length, c);
+        if (length >= UPRV_LENGTHOF(buffer) - 1) {
+            appendUTF8(sink, buffer, length, status);
+            length = 0;
+        }
+    }
+    appendUTF8(sink, buffer, length, status);
+}
+
+
+//
+//    replaceAll, UTF-8 ByteSink output
+//
+void RegexMatcher::replaceAll(const UnicodeString &replacement, ByteSink &sink, UErrorCode &status) {
+    if (U_FAILURE(status)) {
+        return;
+    }
+    if (U_FAILURE(fDeferredStatus)) {
+        status = fDeferredStatus;
+        return;
+    }
+
+    UText replacementText = UTEXT_INITIALIZER;
+    utext_openConstUnicodeString(&replacementText, &replacement, &status);
+    RegexReplacement parsedReplacement(&replacementText, *fPattern, status);
+    utext_close(&replacementText);
+    if (U_FAILURE(status)) {
+        return;
+    }
+
+    reset();
+    while (find()) {
+        appendInputUTF8(sink, fAppendPosition, fMatchStart, status);
+        fAppendPosition = fMatchEnd;
+
+        const UChar *literals = parsedReplacement.fLiterals.getBuffer();
+        for (int32_t i=0; i<parsedReplacement.fPartCount && U_SUCCESS(status); i++) {
+            int32_t part = parsedReplacement.fParts[i];
+            if (part >= 0) {
+                appendUTF8(sink, literals, part, status);
+                literals += part;
+            } else {
+                int32_t groupNum = -(part+1);
+                appendInputUTF8(sink, start64(groupNum, status), end64(groupNum, status), status);
+            }
+        }
+        if (U_SUCCESS(status) && U_FAILURE(parsedReplacement.fError)) {
+            status = parsedReplacement.fError;
+        }
+        if (U_FAILURE(status)) {
+            break;
+        }
+    }
+    appendInputUTF8(sink, fAppendPosition, fInputLength, status);
+    sink.Flush();
+}
+
+
 //--------------------------------------------------------------------------------
 //
 //    replaceFirst
@@ -1911,6 +2067,66 @@ RegexMatcher &RegexMatcher::reset(int64_t position, UErrorCode &status) {
 }
 
 
+//--------------------------------------------------------------------------------
+//
+//    usePattern
+//
+//--------------------------------------------------------------------------------
+RegexMatcher &RegexMatcher::usePattern(const RegexPattern &pattern, UErrorCode &status) {
+    if (U_FAILURE(status)) {
+        return *this;
+    }
+    if (U_FAILURE(fDeferredStatus)) {
+        status = fDeferredStatus;
+        return *this;
+    }
+    if (U_FAILURE(pattern.fDeferredStatus)) {
+        status = pattern.fDeferredStatus;
+        return *this;
+    }
+
+    if (&pattern != fPattern) {
+        // Keep the data area if it is big enough for the new pattern.
+        int32_t dataCapacity = fData == fSmallData ? UPRV_LENGTHOF(fSmallData) : fPattern->fDataSize;
+        if (pattern.fDataSize > dataCapacity) {
+            int64_t *newData = (int64_t *)uprv_malloc(pattern.fDataSize * sizeof(int64_t));
+            if (newData == NULL) {
+                status = U_MEMORY_ALLOCATION_ERROR;
+                return *this;
+            }
+            if (fData != fSmallData) {
+                uprv_free(fData);
+            }
+            fData = newData;
+        }
+        if (pattern.fNeedsAltInput && fAltInputText == NULL) {
+            fAltInputText = utext_clone(fAltInputText, fInputText, FALSE, TRUE, &status);
+            if (U_FAILURE(status)) {
+                return *this;
+            }
+        }
+
+        // Release the previous pattern only after any failures above,
+        //   which leave the matcher unchanged.
+        fPattern = &pattern;
+        delete fPatternOwned;
+        fPatternOwned = NULL;
+
+        // The stack limit is adjusted to hold at least one frame of the pattern.
+        //   See setStackLimit().
+        if (fStackLimit != 0) {
+            int32_t adjustedLimit = fStackLimit / sizeof(int32_t);
+            if (adjustedLimit < fPattern->fFrameSize) {
+                adjustedLimit = fPattern->fFrameSize;
+            }
+            fStack->setMaxCapacity(adjustedLimit);
+        }
+    }
+    resetPreserveRegion();
+    return *this;
+}
+
+
 //--------------------------------------------------------------------------------
 //
 //    refresh
@@ -2255,6 +2471,79 @@ int32_t  RegexMatcher::split(UText *input,
 }
 
 
+//
+//   splitIndexes    split(), giving the bounds of the fields in the input
+//                   rather than copies of their text.
+//
+int32_t  RegexMatcher::splitIndexes(UText *input,
+        int64_t         *dest,
+        int32_t          destCapacity,
+        UErrorCode      &status)
+{
+    if (U_FAILURE(status)) {
+        return 0;
+    };
+
+    if (destCapacity < 1 || dest == NULL) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+
+    reset(input);
+    int64_t   nextFieldStart = 0;
+    if (fActiveLimit == 0) {
+        return 0;
+    }
+
+    // The fields are the same as those from split().  See there for details.
+    int32_t i;
+    int32_t numCaptureGroups = fPattern->fGroupMap->size();
+    for (i=0; ; i++) {
+        if (i>=destCapacity-1) {
+            // The last field gets whatever is left of the input.
+            i = destCapacity-1;
+            dest[i*2]   = nextFieldStart < fActiveLimit ? nextFieldStart : fActiveLimit;
+            dest[i*2+1] = fActiveLimit;
+            break;
+        }
+        if (find(status)) {
+            dest[i*2]   = nextFieldStart;
+            dest[i*2+1] = fMatchStart;
+            nextFieldStart = fMatchEnd;
+
+            // Capture groups of the delimiter become fields of their own.
+            int32_t groupNum;
+            for (groupNum=1; groupNum<=numCaptureGroups; groupNum++) {
+                if (i >= destCapacity-2) {
+                    break;
+                }
+                i++;
+                dest[i*2]   = start64(groupNum, status);
+                dest[i*2+1] = end64(groupNum, status);
+            }
+
+            if (nextFieldStart == fActiveLimit) {
+                // An empty field follows a delimiter at the end of the input.
+                if (i+1 < destCapacity) {
+                    ++i;
+                    dest[i*2]   = fActiveLimit;
+                    dest[i*2+1] = fActiveLimit;
+                }
+                break;
+            }
+        } else {
+            dest[i*2]   = nextFieldStart;
+            dest[i*2+1] = fActiveLimit;
+            break;
+        }
+        if (U_FAILURE(status)) {
+            break;
+        }
+    }
+    return i+1;
+}
+
+
 //--------------------------------------------------------------------------------
 //
 //     start
@@ -2533,12 +2822,12 @@ UBool RegexMatcher::isWordBoundary(int64_t pos) {
     UBool isBoundary = FALSE;
     UBool cIsWord    = FALSE;
 
+    UTEXT_SETNATIVEINDEX(fInputText, pos);
     if (pos >= fLookLimit) {
         fHitEnd = TRUE;
     } else {
         // Determine whether char c at current position is a member of the word set of chars.
         // If we're off the end of the string, behave as though we're not at a word char.
-        UTEXT_SETNATIVEINDEX(fInputText, pos);
         UChar32  c = UTEXT_CURRENT32(fInputText);
         if (u_hasBinaryProperty(c, UCHAR_GRAPHEME_EXTEND) || u_charType(c) == U_FORMAT_CHAR) {
             // Current char is a combining one.  Not a boundary.
@@ -4161,6 +4450,12 @@ GC_Done:
                 //   that holds the starting input index for the match of this [set]*
                 int32_t loopcOp = (int32_t)pat[fp->fPatIdx];
                 U_ASSERT(URX_TYPE(loopcOp) == URX_LOOP_C);
+                if (loopcOp & URX_LOOP_C_POSSESSIVE) {
+                    // Giving back input can't help what follows to match. No state save.
+                    fp->fInputIdx = ix;
+                    fp->fPatIdx++;
+                    break;
+                }
                 int32_t stackLoc = URX_VAL(loopcOp);
                 U_ASSERT(stackLoc >= 0 && stackLoc < fFrameSize);
                 fp->fExtra[stackLoc] = fp->fInputIdx;
@@ -4222,6 +4517,12 @@ GC_Done:
                 //   that holds the starting input index for the match of this .*
                 int32_t loopcOp = (int32_t)pat[fp->fPatIdx];
                 U_ASSERT(URX_TYPE(loopcOp) == URX_LOOP_C);
+                if (loopcOp & URX_LOOP_C_POSSESSIVE) {
+                    // Giving back input can't help what follows to match. No state save.
+                    fp->fInputIdx = ix;
+                    fp->fPatIdx++;
+                    break;
+                }
                 int32_t stackLoc = URX_VAL(loopcOp);
                 U_ASSERT(stackLoc >= 0 && stackLoc < fFrameSize);
                 fp->fExtra[stackLoc] = fp->fInputIdx;
@@ -4269,7 +4570,11 @@ GC_Done:
                 }
 
 
-                fp = StateSave(fp, fp->fPatIdx-1, status);
+                // Save state to return here for the next step back, unless this
+                //   step reached the start of the loop, which is the last one.
+                if (fp->fInputIdx > backSearchIndex) {
+                    fp = StateSave(fp, fp->fPatIdx-1, status);
+                }
             }
             break;
 
@@ -5662,6 +5967,12 @@ GC_Done:
                 //   that holds the starting input index for the match of this [set]*
                 int32_t loopcOp = (int32_t)pat[fp->fPatIdx];
                 U_ASSERT(URX_TYPE(loopcOp) == URX_LOOP_C);
+                if (loopcOp & URX_LOOP_C_POSSESSIVE) {
+                    // Giving back input can't help what follows to match. No state save.
+                    fp->fInputIdx = ix;
+                    fp->fPatIdx++;
+                    break;
+                }
                 int32_t stackLoc = URX_VAL(loopcOp);
                 U_ASSERT(stackLoc >= 0 && stackLoc < fFrameSize);
                 fp->fExtra[stackLoc] = fp->fInputIdx;
@@ -5724,6 +6035,12 @@ GC_Done:
                 //   that holds the starting input index for the match of this .*
                 int32_t loopcOp = (int32_t)pat[fp->fPatIdx];
                 U_ASSERT(URX_TYPE(loopcOp) == URX_LOOP_C);
+                if (loopcOp & URX_LOOP_C_POSSESSIVE) {
+                    // Giving back input can't help what follows to match. No state save.
+                    fp->fInputIdx = ix;
+                    fp->fPatIdx++;
+                    break;
+                }
                 int32_t stackLoc = URX_VAL(loopcOp);
                 U_ASSERT(stackLoc >= 0 && stackLoc < fFrameSize);
                 fp->fExtra[stackLoc] = fp->fInputIdx;
@@ -5769,7 +6086,11 @@ GC_Done:
                 }
 
 
-                fp = StateSave(fp, fp->fPatIdx-1, status);
+                // Save state to return here for the next step back, unless this
+                //   step reached the start of the loop, which is the last one.
+                if (fp->fInputIdx > backSearchIndex) {
+                    fp = StateSave(fp, fp->fPatIdx-1, status);
+                }
             }
             break;
 
@@ -5813,6 +6134,663 @@ breakFromLoop:
 }
 
 
+//--------------------------------------------------------------------------------
+//
+//   MatchLinear   The match engine for patterns compiled with UREGEX_LINEAR.
+//
+//                 Instead of trying the alternatives of the pattern one after another,
+//                 and backtracking when one fails, all of them are run in lock step:
+//                 a list of threads, each with a pattern position and its own capture
+//                 group positions, is advanced over the input one code point at a time.
+//                 A thread that reaches a pattern position that another thread with a
+//                 higher priority already reached at the same input position is dropped,
+//                 so there are never more threads than pattern ops, and the time to match
+//                 is proportional to the length of the input.
+//
+//                 Threads are kept in the order in which the backtracking engine would
+//                 try them, and lower priority threads are dropped once a match is found,
+//                 so the match is normally the same as with MatchAt(). Loops that can
+//                 match an empty string end after an iteration that does not advance the
+//                 input, as they do in MatchAt(), rather than being dropped at the pattern
+//                 positions that the previous iteration already reached.
+//
+//                 The compiled pattern has been rewritten by RegexCompile::linearize() so
+//                 that each op consumes at most one code point, or tests the current position.
+//
+//                  startIdx:    begin matching a this index.
+//                  toEnd:       if true, match must extend to end of the input region
+//                  findMatch:   if true, a match may begin at startIdx or any position after it.
+//
+//--------------------------------------------------------------------------------
+void RegexMatcher::MatchLinear(int64_t startIdx, UBool toEnd, UBool findMatch, UErrorCode &status) {
+    if (U_FAILURE(status)) {
+        return;
+    }
+
+    const int64_t       *pat      = fPattern->fCompiledPat->getBuffer();
+    int32_t              patSize  = fPattern->fCompiledPat->size();
+    UVector             *sets     = fPattern->fSets;
+    fFrameSize = fPattern->fFrameSize;
+
+    // All of the working storage comes from the backtracking stack, so that the
+    //   stack limit applies to it:  the frame of the match found, a working frame,
+    //   the marks for each pattern position, the stack for following branches in
+    //   addLinearThread(), and the current and next thread lists.
+    int64_t listSize    = (int64_t)patSize * fFrameSize;
+    int64_t branchSize  = (4*(int64_t)patSize + 1) * (fPattern->fLinearLoopDepth + 1);
+    int64_t storageSize = 2*fFrameSize + 2*patSize + branchSize + 2*listSize;
+    fStack->removeAllElements();
+    int64_t *storage = NULL;
+    if (storageSize <= INT32_MAX) {
+        storage = fStack->reserveBlock((int32_t)storageSize, status);
+    }
+    if (storage == NULL || U_FAILURE(status)) {
+        status = U_REGEX_STACK_OVERFLOW;
+        return;
+    }
+    REStackFrame    *result  = (REStackFrame *)storage;
+    int64_t         *work    = storage + fFrameSize;
+    int64_t         *marks   = work + fFrameSize;
+    int64_t         *stack   = marks + 2*patSize;
+    RELinearThreads  lists[2];
+    lists[0].fCount  = 0;
+    lists[0].fFrames = stack + branchSize;
+    lists[1].fCount  = 0;
+    lists[1].fFrames = lists[0].fFrames + listSize;
+    RELinearThreads *clist   = &lists[0];
+    RELinearThreads *nlist   = &lists[1];
+
+    int32_t i;
+    for (i=0; i<fFrameSize; i++) {
+        storage[i] = -1;
+        work[i]    = -1;
+    }
+    for (i=0; i<patSize; i++) {
+        marks[2*i] = -1;
+    }
+
+    // Compute the position in the input beyond which a match can not begin.
+    //   Like find(), treat the minimum match length as one if the input is not UTF-16.
+    int64_t startLimit = fActiveLimit;
+    if (findMatch) {
+        if (UTEXT_USES_U16(fInputText)) {
+            startLimit = fActiveLimit - fPattern->fMinMatchLen;
+        } else if (fPattern->fMinMatchLen > 0) {
+            startLimit = fActiveLimit - 1;
+        }
+        if (fPattern->fStartType == START_START && startLimit > fActiveStart) {
+            startLimit = fActiveStart;
+        }
+    }
+    UBool   canSkip  = findMatch && (fPattern->fStartType == START_CHAR ||
+                                     fPattern->fStartType == START_STRING ||
+                                     fPattern->fStartType == START_SET);
+    UBool   isMatch  = FALSE;
+    int64_t matchEnd = -1;
+    int64_t mark     = 0;       // Identifies the thread list being built in the marks.
+    int64_t pos      = startIdx;
+
+    //
+    //  Main loop, one iteration per input position.
+    //
+    for (;;) {
+        // Start a new thread at this position, with the lowest priority,
+        //   unless a match has been found already.
+        if (!isMatch && (pos == startIdx || findMatch) && pos <= startLimit) {
+            if (canSkip && clist->fCount == 0) {
+                // No match is in progress. Skip ahead to the next position where
+                //   one can start.
+                int64_t skipStart = pos;
+                UTEXT_SETNATIVEINDEX(fInputText, pos);
+                while (pos < fActiveLimit && pos <= startLimit) {
+                    UChar32 c = UTEXT_NEXT32(fInputText);
+                    if (fPattern->fStartType == START_SET ?
+                            (c<256 ? fPattern->fInitialChars8->contains(c) : fPattern->fInitialChars->contains(c)) :
+                            c == fPattern->fInitialChar) {
+                        break;
+                    }
+                    pos = UTEXT_GETNATIVEINDEX(fInputText);
+                    if (findProgressInterrupt(pos, status)) {
+                        break;
+                    }
+                }
+                if (U_FAILURE(status)) {
+                    break;
+                }
+                if (pos >= fActiveLimit || pos > startLimit) {
+                    fHitEnd = TRUE;
+                    break;
+                }
+                if (pos != skipStart) {
+                    mark++;             // Pattern positions marked at skipStart are not reached here.
+                }
+            }
+            UBool isStart = TRUE;
+            if (findMatch && fPattern->fStartType == START_LINE && pos != fAnchorStart) {
+                // Like find(), start only after a line end, with a CR/LF taken as a unit.
+                UTEXT_SETNATIVEINDEX(fInputText, pos);
+                UChar32 prevC = UTEXT_PREVIOUS32(fInputText);
+                if (fPattern->fFlags & UREGEX_UNIX_LINES) {
+                    isStart = (prevC == 0x0a);
+                } else {
+                    UTEXT_SETNATIVEINDEX(fInputText, pos);
+                    isStart = isLineTerminator(prevC) &&
+                        !(prevC == 0x0d && pos < fActiveLimit && UTEXT_CURRENT32(fInputText) == 0x0a);
+                }
+            }
+            if (isStart) {
+                work[0] = pos;      // The match start position, in the frame's fInputIdx.
+                addLinearThread(*clist, 0, work, pos, mark, marks, stack);
+            }
+        }
+
+        UChar32  c       = U_SENTINEL;
+        int64_t  nextPos = pos;
+        UBool    atCRLF  = FALSE;   // At the CR of a CR/LF, which some ops match as a unit.
+        if (pos < fActiveLimit) {
+            UTEXT_SETNATIVEINDEX(fInputText, pos);
+            c = UTEXT_NEXT32(fInputText);
+            nextPos = UTEXT_GETNATIVEINDEX(fInputText);
+            atCRLF = c == 0x0d && nextPos < fActiveLimit && UTEXT_CURRENT32(fInputText) == 0x0a;
+        }
+
+        // Advance each thread over the character at this position, in priority order.
+        mark++;
+        nlist->fCount = 0;
+        for (int32_t t=0; t<clist->fCount; t++) {
+            int64_t *frame   = clist->fFrames + (int64_t)t*fFrameSize;
+            int32_t  patIdx  = (int32_t)((REStackFrame *)frame)->fPatIdx;
+            int32_t  op      = (int32_t)pat[patIdx];
+            int32_t  opType  = URX_TYPE(op);
+            int32_t  opValue = URX_VAL(op);
+
+            if (opType == URX_END) {
+                if (toEnd && pos != fActiveLimit) {
+                    // The pattern matched, but not to the end of input.
+                    continue;
+                }
+                // A match. Threads with a lower priority could only find a less preferred
+                //   one, drop them. Threads ahead of this one may still find a better match.
+                uprv_memcpy(result, frame, fFrameSize*sizeof(int64_t));
+                matchEnd = pos;
+                isMatch  = TRUE;
+                break;
+            }
+
+            if (c < 0) {
+                fHitEnd = TRUE;
+                continue;
+            }
+
+            UBool success;
+            switch (opType) {
+            case URX_ONECHAR:
+                success = (c == opValue);
+                break;
+
+            case URX_ONECHAR_I:
+                // Case insensitive one char.  The char from the pattern is already case folded.
+                success = (u_foldCase(c, U_FOLD_CASE_DEFAULT) == (opValue & ~URX_ONECHAR_I_CONT));
+                if (!success && c >= 0x80) {
+                    // An input character that case folds to several characters, like U+00DF,
+                    //   can match part of a case insensitive string, which linearize() has turned
+                    //   into a sequence of URX_ONECHAR_I ops. The thread continues after the part.
+                    const UChar *folding;
+                    int32_t foldLength = ucase_toFullFolding(c, &folding, U_FOLD_CASE_DEFAULT);
+                    if (foldLength >= 0 && foldLength <= UCASE_MAX_STRING_LENGTH) {
+                        int32_t opIdx = patIdx;     // The pattern always ends with URX_END.
+                        int32_t i = 0;
+                        UBool   isFoldMatch = TRUE;
+                        while (i < foldLength) {
+                            UChar32 foldedC;
+                            U16_NEXT(folding, i, foldLength, foldedC);
+                            int32_t foldedOp = (int32_t)pat[opIdx];
+                            int32_t opChar   = URX_VAL(foldedOp);
+                            if (opIdx == patIdx) {
+                                opChar &= ~URX_ONECHAR_I_CONT;
+                            } else {
+                                foldedC |= URX_ONECHAR_I_CONT;    // Must be in the same string.
+                            }
+                            if (URX_TYPE(foldedOp) != URX_ONECHAR_I || opChar != foldedC) {
+                                isFoldMatch = FALSE;
+                                break;
+                            }
+                            opIdx++;
+                        }
+                        if (isFoldMatch) {
+                            addLinearThread(*nlist, opIdx, frame, nextPos, mark, marks, stack);
+                        }
+                    }
+                }
+                break;
+
+            case URX_STATIC_SETREF:
+                {
+                    UBool negated = ((opValue & URX_NEG_SET) == URX_NEG_SET);
+                    opValue &= ~URX_NEG_SET;
+                    U_ASSERT(opValue > 0 && opValue < URX_LAST_SET);
+                    success = c<256 ? fPattern->fStaticSets8[opValue].contains(c) :
+                                      fPattern->fStaticSets[opValue]->contains(c);
+                    success ^= negated;
+                }
+                break;
+
+            case URX_STAT_SETREF_N:
+                U_ASSERT(opValue > 0 && opValue < URX_LAST_SET);
+                success = c<256 ? fPattern->fStaticSets8[opValue].contains(c) :
+                                  fPattern->fStaticSets[opValue]->contains(c);
+                success = !success;
+                break;
+
+            case URX_SETREF:
+                U_ASSERT(opValue > 0 && opValue < sets->size());
+                success = c<256 ? fPattern->fSets8[opValue].contains(c) :
+                                  ((UnicodeSet *)sets->elementAt(opValue))->contains(c);
+                break;
+
+            case URX_DOTANY:
+                success = !isLineTerminator(c);
+                break;
+
+            case URX_DOTANY_ALL:
+                // A CR/LF is matched by an alternative that linearize() put in front of this op.
+                success = !atCRLF;
+                break;
+
+            case URX_DOTANY_UNIX:
+                success = (c != 0x0a);
+                break;
+
+            case URX_BACKSLASH_D:
+                success = (u_charType(c) == U_DECIMAL_DIGIT_NUMBER);
+                success ^= (UBool)(opValue != 0);        // flip sense for \D
+                break;
+
+            case URX_BACKSLASH_H:
+                success = (u_charType(c) == U_SPACE_SEPARATOR || c == 9);
+                success ^= (UBool)(opValue != 0);        // flip sense for \H
+                break;
+
+            case URX_BACKSLASH_V:
+                success = isLineTerminator(c);
+                success ^= (UBool)(opValue != 0);        // flip sense for \V
+                break;
+
+            case URX_BACKSLASH_R:
+                // As with URX_DOTANY_ALL, a CR/LF is matched by an alternative.
+                success = isLineTerminator(c) && !atCRLF;
+                break;
+
+            default:
+                // Only ops that consume input are in the thread lists.
+                U_ASSERT(FALSE);
+                success = FALSE;
+                break;
+            }
+
+            if (success) {
+                addLinearThread(*nlist, patIdx+1, frame, nextPos, mark, marks, stack);
+            }
+            fTickCounter--;
+            if (fTickCounter <= 0) {
+                IncrementTime(status);    // Re-initializes fTickCounter
+            }
+        }
+        if (U_FAILURE(status)) {
+            break;
+        }
+
+        RELinearThreads *tmp = clist;
+        clist = nlist;
+        nlist = tmp;
+        if (pos >= fActiveLimit) {
+            break;
+        }
+        pos = nextPos;
+        if (clist->fCount == 0 && (isMatch || !findMatch || pos > startLimit)) {
+            break;
+        }
+        if (findMatch && !isMatch && findProgressInterrupt(pos, status)) {
+            break;
+        }
+    }
+
+    fMatch = isMatch;
+    if (isMatch) {
+        fLastMatchEnd = fMatchEnd;
+        fMatchStart   = result->fInputIdx;
+        fMatchEnd     = matchEnd;
+    }
+    fFrame = result;            // Contains the capture group results of the match.
+}
+
+
+//--------------------------------------------------------------------------------
+//
+//   addLinearThread   Add the threads for the pattern position patIdx to a thread list
+//                     for MatchLinear(), at the given input position.
+//
+//                     Branches, capture group ops and position tests are followed, in the
+//                     order the backtracking engine would take them, until an op that
+//                     consumes input, or the end of the pattern, is reached; a thread for
+//                     each of these is appended to the list.  Pattern positions that
+//                     already have the current mark were reached by a thread with a
+//                     higher priority, and are not followed again.
+//
+//                     The exception are loops that end after an empty iteration. A path
+//                     that gets back to a pattern position in such a loop, without
+//                     consuming input, has started a new iteration at this input position,
+//                     and the iteration ends there if it matches an empty string, where
+//                     the earlier visit would have continued the loop. The number of loops
+//                     that a path is in and has started at this input position, its empty
+//                     loop depth, is marked with the position, and the position is followed
+//                     again at a greater depth.
+//
+//                     frame:    the frame of the thread, with its capture group positions.
+//                               It is used as a working frame, and restored before returning.
+//                     marks:    the mark and the empty loop depth of each pattern position.
+//                     stack:    room for 4 entries for each op in the pattern, plus 1,
+//                               times the pattern's fLinearLoopDepth plus 1.
+//
+//--------------------------------------------------------------------------------
+void RegexMatcher::addLinearThread(RELinearThreads &list, int32_t patIdx, int64_t *frame,
+                                   int64_t inputIdx, int64_t mark, int64_t *marks, int64_t *stack) {
+    const int64_t *pat = fPattern->fCompiledPat->getBuffer();
+    REStackFrame  *fp  = (REStackFrame *)frame;
+
+    // Stack entries are either a pattern position to be explored, >= 0, with the empty
+    //   loop depth in the high 32 bits, or a frame location to be restored, -1 - location,
+    //   preceded by the saved value.
+    //   No loop has been started at inputIdx yet: addLinearThread() is called once for
+    //   each input position, or after consuming input.
+    int32_t sp = 0;
+    stack[sp++] = patIdx;
+    while (sp > 0) {
+        int64_t entry = stack[--sp];
+        if (entry < 0) {
+            fp->fExtra[-1 - entry] = stack[--sp];
+            continue;
+        }
+
+        int32_t depth = (int32_t)(entry >> 32);
+        for (int32_t pc = (int32_t)entry;;) {
+            if (marks[2*pc] == mark && marks[2*pc+1] >= depth) {
+                break;
+            }
+            marks[2*pc]   = mark;
+            marks[2*pc+1] = depth;
+            int32_t op      = (int32_t)pat[pc];
+            int32_t opValue = URX_VAL(op);
+            UBool   isThread = FALSE;
+
+            switch (URX_TYPE(op)) {
+            case URX_JMP:
+                pc = opValue;
+                continue;
+
+            case URX_STATE_SAVE:
+                // Continue with the next op, then the alternative.
+                stack[sp++] = ((int64_t)depth << 32) | opValue;
+                pc++;
+                continue;
+
+            case URX_JMP_SAV:
+                // Continue with the jump target, then the next op.
+                stack[sp++] = ((int64_t)depth << 32) | (pc + 1);
+                pc = opValue;
+                continue;
+
+            case URX_STO_INP_LOC:
+                // The top of a loop that ends after an empty iteration.
+                stack[sp++] = fp->fExtra[opValue];
+                stack[sp++] = -1 - opValue;
+                fp->fExtra[opValue] = inputIdx;
+                depth++;
+                pc++;
+                continue;
+
+            case URX_JMP_SAV_X:
+            case URX_CTR_LOOP_NG:
+                // The end of that loop, greedy or non-greedy (see RegexCompile::linearize()).
+                //   The input position at the start of the iteration is in the frame slot
+                //   of the URX_STO_INP_LOC before the jump target.
+                {
+                    int32_t slot = URX_VAL(pat[opValue-1]);
+                    U_ASSERT(URX_TYPE(pat[opValue-1]) == URX_STO_INP_LOC);
+                    int64_t savedInputIdx = fp->fExtra[slot];
+                    stack[sp++] = savedInputIdx;
+                    stack[sp++] = -1 - slot;
+                    if (savedInputIdx < inputIdx && URX_TYPE(op) == URX_JMP_SAV_X) {
+                        // Continue with a new iteration starting here, then the next op.
+                        stack[sp++] = ((int64_t)depth << 32) | (pc + 1);
+                        fp->fExtra[slot] = inputIdx;
+                        depth++;
+                        pc = opValue;
+                    } else if (savedInputIdx < inputIdx) {
+                        // Continue with the next op, then a new iteration starting here.
+                        //   The frame slot is set for it by a restore entry.
+                        stack[sp++] = ((int64_t)(depth + 1) << 32) | opValue;
+                        stack[sp++] = inputIdx;
+                        stack[sp++] = -1 - slot;
+                        pc++;
+                    } else {
+                        // An empty iteration, the loop ends.
+                        fp->fExtra[slot] = -1;
+                        depth--;
+                        pc++;
+                    }
+                }
+                continue;
+
+            case URX_START_CAPTURE:
+                stack[sp++] = fp->fExtra[opValue+2];
+                stack[sp++] = -1 - (opValue+2);
+                fp->fExtra[opValue+2] = inputIdx;
+                pc++;
+                continue;
+
+            case URX_END_CAPTURE:
+                stack[sp++] = fp->fExtra[opValue];
+                stack[sp++] = -1 - opValue;
+                stack[sp++] = fp->fExtra[opValue+1];
+                stack[sp++] = -1 - (opValue+1);
+                fp->fExtra[opValue]   = fp->fExtra[opValue+2];
+                fp->fExtra[opValue+1] = inputIdx;
+                pc++;
+                continue;
+
+            case URX_BACKTRACK:
+            case URX_FAIL:
+                break;
+
+            case URX_END:
+            case URX_ONECHAR:
+            case URX_ONECHAR_I:
+            case URX_STATIC_SETREF:
+            case URX_STAT_SETREF_N:
+            case URX_SETREF:
+            case URX_DOTANY:
+            case URX_DOTANY_ALL:
+            case URX_DOTANY_UNIX:
+            case URX_BACKSLASH_D:
+            case URX_BACKSLASH_H:
+            case URX_BACKSLASH_R:
+            case URX_BACKSLASH_V:
+                isThread = TRUE;
+                break;
+
+            default:
+                if (isLinearAssertion(op, inputIdx)) {
+                    pc++;
+                    continue;
+                }
+                break;
+            }
+
+            if (isThread) {
+                // Once input is consumed, no loop has been started at the new input position,
+                //   and the thread is the same as one at a greater empty loop depth.
+                marks[2*pc+1] = INT32_MAX;
+                int64_t *dest = list.fFrames + (int64_t)list.fCount*fFrameSize;
+                uprv_memcpy(dest, frame, fFrameSize*sizeof(int64_t));
+                ((REStackFrame *)dest)->fPatIdx = pc;
+                list.fCount++;
+            }
+            break;
+        }
+    }
+}
+
+
+//--------------------------------------------------------------------------------
+//
+//   isLinearAssertion   Test a pattern op that matches a position, not input text,
+//                       for MatchLinear().  Same as the corresponding ops in MatchAt().
+//
+//--------------------------------------------------------------------------------
+UBool RegexMatcher::isLinearAssertion(int32_t op, int64_t inputIdx) {
+    int32_t opValue = URX_VAL(op);
+    switch (URX_TYPE(op)) {
+    case URX_DOLLAR:                    //  $, test for End of line
+                                        //     or for position before new line at end of input
+        {
+            if (inputIdx >= fAnchorLimit) {
+                // We really are at the end of input.  Success.
+                fHitEnd = TRUE;
+                fRequireEnd = TRUE;
+                return TRUE;
+            }
+            UTEXT_SETNATIVEINDEX(fInputText, inputIdx);
+            UChar32 c = UTEXT_NEXT32(fInputText);
+            if (UTEXT_GETNATIVEINDEX(fInputText) >= fAnchorLimit) {
+                if (isLineTerminator(c)) {
+                    // If not in the middle of a CR/LF sequence
+                    if ( !(c==0x0a && inputIdx>fAnchorStart && ((void)UTEXT_PREVIOUS32(fInputText), UTEXT_PREVIOUS32(fInputText))==0x0d)) {
+                        // At new-line at end of input. Success
+                        fHitEnd = TRUE;
+                        fRequireEnd = TRUE;
+                        return TRUE;
+                    }
+                }
+            } else {
+                UChar32 nextC = UTEXT_NEXT32(fInputText);
+                if (c == 0x0d && nextC == 0x0a && UTEXT_GETNATIVEINDEX(fInputText) >= fAnchorLimit) {
+                    fHitEnd = TRUE;
+                    fRequireEnd = TRUE;
+                    return TRUE;                // At CR/LF at end of input.  Success
+                }
+            }
+            return FALSE;
+        }
+
+    case URX_DOLLAR_D:                  //  $, test for End of Line, in UNIX_LINES mode.
+        if (inputIdx >= fAnchorLimit) {
+            // Off the end of input.  Success.
+            fHitEnd = TRUE;
+            fRequireEnd = TRUE;
+            return TRUE;
+        } else {
+            UTEXT_SETNATIVEINDEX(fInputText, inputIdx);
+            UChar32 c = UTEXT_NEXT32(fInputText);
+            // Either at the last character of input, or off the end.
+            if (c == 0x0a && UTEXT_GETNATIVEINDEX(fInputText) == fAnchorLimit) {
+                fHitEnd = TRUE;
+                fRequireEnd = TRUE;
+                return TRUE;
+            }
+        }
+        return FALSE;
+
+    case URX_DOLLAR_M:                  //  $, test for End of line in multi-line mode
+        {
+            if (inputIdx >= fAnchorLimit) {
+                // We really are at the end of input.  Success.
+                fHitEnd = TRUE;
+                fRequireEnd = TRUE;
+                return TRUE;
+            }
+            // If we are positioned just before a new-line, succeed.
+            UTEXT_SETNATIVEINDEX(fInputText, inputIdx);
+            UChar32 c = UTEXT_CURRENT32(fInputText);
+            if (isLineTerminator(c)) {
+                // At a line end, except for the odd chance of  being in the middle of a CR/LF sequence
+                if ( !(c==0x0a && inputIdx>fAnchorStart && UTEXT_PREVIOUS32(fInputText)==0x0d)) {
+                    return TRUE;
+                }
+            }
+            return FALSE;
+        }
+
+    case URX_DOLLAR_MD:                 //  $, test for End of line in multi-line and UNIX_LINES mode
+        if (inputIdx >= fAnchorLimit) {
+            // We really are at the end of input.  Success.
+            fHitEnd = TRUE;
+            fRequireEnd = TRUE;
+            return TRUE;
+        }
+        UTEXT_SETNATIVEINDEX(fInputText, inputIdx);
+        return UTEXT_CURRENT32(fInputText) == 0x0a;
+
+    case URX_CARET:                     //  ^, test for start of line
+        return inputIdx == fAnchorStart;
+
+    case URX_CARET_M:                   //  ^, test for start of line in mulit-line mode
+        {
+            if (inputIdx == fAnchorStart) {
+                // We are at the start input.  Success.
+                return TRUE;
+            }
+            // Check whether character just before the current pos is a new-line
+            //   unless we are at the end of input
+            UTEXT_SETNATIVEINDEX(fInputText, inputIdx);
+            UChar32  c = UTEXT_PREVIOUS32(fInputText);
+            return (inputIdx < fAnchorLimit) && isLineTerminator(c);
+        }
+
+    case URX_CARET_M_UNIX:              //  ^, test for start of line in mulit-line + Unix-line mode
+        {
+            if (inputIdx <= fAnchorStart) {
+                // We are at the start input.  Success.
+                return TRUE;
+            }
+            // Check whether character just before the current pos is a new-line
+            UTEXT_SETNATIVEINDEX(fInputText, inputIdx);
+            return UTEXT_PREVIOUS32(fInputText) == 0x0a;
+        }
+
+    case URX_BACKSLASH_B:               // Test for word boundaries
+        {
+            UBool success = isWordBoundary(inputIdx);
+            success ^= (UBool)(opValue != 0);     // flip sense for \B
+            return success;
+        }
+
+    case URX_BACKSLASH_BU:              // Test for word boundaries, Unicode-style
+        {
+            UBool success = isUWordBoundary(inputIdx);
+            success ^= (UBool)(opValue != 0);     // flip sense for \B
+            return success;
+        }
+
+    case URX_BACKSLASH_G:               // Test for position at end of previous match
+        return (fMatch && inputIdx==fMatchEnd) || (fMatch==FALSE && inputIdx==fActiveStart);
+
+    case URX_BACKSLASH_Z:               // Test for end of Input
+        if (inputIdx < fAnchorLimit) {
+            return FALSE;
+        }
+        fHitEnd = TRUE;
+        fRequireEnd = TRUE;
+        return TRUE;
+
+    default:
+        // Ops that need backtracking are rejected by RegexCompile::linearize().
+        U_ASSERT(FALSE);
+        return FALSE;
+    }
+}
+
+
 UOBJECT_DEFINE_RTTI_IMPLEMENTATION(RegexMatcher)
 
 U_NAMESPACE_END
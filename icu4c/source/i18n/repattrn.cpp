@@ -16,6 +16,7 @@
 
 #include "unicode/regex.h"
 #include "unicode/uclean.h"
+#include "unicode/localpointer.h"
 #include "cmemory.h"
 #include "cstr.h"
 #include "uassert.h"
@@ -26,6 +27,7 @@
 #include "regexcmp.h"
 #include "regeximp.h"
 #include "regexst.h"
+#include "unifiedcache.h"
 
 U_NAMESPACE_BEGIN
 
@@ -107,6 +109,10 @@ RegexPattern &RegexPattern::operator = (const RegexPattern &other) {
     fInitialChar      = other.fInitialChar;
     *fInitialChars8   = *other.fInitialChars8;
     fNeedsAltInput    = other.fNeedsAltInput;
+    fMaxMatchLen      = other.fMaxMatchLen;
+    fLineBounded      = other.fLineBounded;
+    fChainedMatches   = other.fChainedMatches;
+    fLinearLoopDepth  = other.fLinearLoopDepth;
 
     //  Copy the pattern.  It's just values, nothing deep to copy.
     fCompiledPat->assign(*other.fCompiledPat, fDeferredStatus);
@@ -182,6 +188,10 @@ void RegexPattern::init() {
     fInitialChar      = 0;
     fInitialChars8    = NULL;
     fNeedsAltInput    = FALSE;
+    fMaxMatchLen      = INT32_MAX;
+    fLineBounded      = FALSE;
+    fChainedMatches   = FALSE;
+    fLinearLoopDepth  = 0;
     fNamedCaptureMap  = NULL;
 
     fPattern          = NULL; // will be set later
@@ -314,7 +324,8 @@ RegexPattern::compile(const UnicodeString &regex,
 
     const uint32_t allFlags = UREGEX_CANON_EQ | UREGEX_CASE_INSENSITIVE | UREGEX_COMMENTS |
     UREGEX_DOTALL   | UREGEX_MULTILINE        | UREGEX_UWORD |
-    UREGEX_ERROR_ON_UNKNOWN_ESCAPES           | UREGEX_UNIX_LINES | UREGEX_LITERAL;
+    UREGEX_ERROR_ON_UNKNOWN_ESCAPES           | UREGEX_UNIX_LINES | UREGEX_LITERAL |
+    UREGEX_LINEAR;
 
     if ((flags & ~allFlags) != 0) {
         status = U_REGEX_INVALID_FLAG;
@@ -365,7 +376,8 @@ RegexPattern::compile(UText                *regex,
 
     const uint32_t allFlags = UREGEX_CANON_EQ | UREGEX_CASE_INSENSITIVE | UREGEX_COMMENTS |
                               UREGEX_DOTALL   | UREGEX_MULTILINE        | UREGEX_UWORD |
-                              UREGEX_ERROR_ON_UNKNOWN_ESCAPES           | UREGEX_UNIX_LINES | UREGEX_LITERAL;
+                              UREGEX_ERROR_ON_UNKNOWN_ESCAPES           | UREGEX_UNIX_LINES | UREGEX_LITERAL |
+                              UREGEX_LINEAR;
 
     if ((flags & ~allFlags) != 0) {
         status = U_REGEX_INVALID_FLAG;
@@ -450,6 +462,102 @@ RegexPattern::compile(UText                *regex,
 }
 
 
+//---------------------------------------------------------------------
+//
+//   Pattern cache     Compiled patterns, keyed by (pattern string, flags),
+//                     shared through the UnifiedCache.  The cache handles
+//                     concurrent lookups of the same key, and evicts patterns
+//                     that are no longer referenced by any matcher once the
+//                     number of them exceeds its limits.
+//                     Only the C API uses the cache, so that the RegexPattern
+//                     of a C++ RegexMatcher is never shared without the caller's knowledge.
+//
+//---------------------------------------------------------------------
+class RegexPatternCacheKey : public CacheKey<SharedRegexPattern> {
+  public:
+    RegexPatternCacheKey(const UnicodeString &regex, uint32_t flags) :
+            fRegex(regex), fFlags(flags) {}
+    RegexPatternCacheKey(const RegexPatternCacheKey &other) :
+            CacheKey<SharedRegexPattern>(other), fRegex(other.fRegex), fFlags(other.fFlags) {}
+    virtual ~RegexPatternCacheKey();
+
+    virtual int32_t hashCode() const {
+        uint32_t hash = (uint32_t)CacheKey<SharedRegexPattern>::hashCode();
+        hash = 37u * hash + (uint32_t)fRegex.hashCode();
+        return (int32_t)(37u * hash + fFlags);
+    }
+
+    virtual UBool operator == (const CacheKeyBase &other) const {
+        if (this == &other) {
+            return TRUE;
+        }
+        if (!CacheKey<SharedRegexPattern>::operator == (other)) {
+            return FALSE;
+        }
+        const RegexPatternCacheKey &o = static_cast<const RegexPatternCacheKey &>(other);
+        return fFlags == o.fFlags && fRegex == o.fRegex;
+    }
+
+    virtual CacheKeyBase *clone() const {
+        return new RegexPatternCacheKey(*this);
+    }
+
+    virtual const SharedObject *createObject(const void * /*unused*/, UErrorCode &status) const {
+        RegexPattern *pat = RegexPattern::compile(fRegex, fFlags, status);
+        if (U_FAILURE(status)) {
+            return NULL;
+        }
+        SharedRegexPattern *result = new SharedRegexPattern(pat);
+        if (result == NULL) {
+            delete pat;
+            status = U_MEMORY_ALLOCATION_ERROR;
+            return NULL;
+        }
+        result->addRef();
+        return result;
+    }
+
+  private:
+    UnicodeString fRegex;
+    uint32_t      fFlags;
+};
+
+RegexPatternCacheKey::~RegexPatternCacheKey() {}
+
+
+SharedRegexPattern::~SharedRegexPattern() {
+    delete ptr;
+}
+
+
+const SharedRegexPattern *SharedRegexPattern::getInstance(const UnicodeString &regex,
+                                                          uint32_t flags,
+                                                          UParseError *pe,
+                                                          UErrorCode &status) {
+    const UnifiedCache *cache = UnifiedCache::getInstance(status);
+    if (U_FAILURE(status)) {
+        return NULL;
+    }
+    const SharedRegexPattern *result = NULL;
+    cache->get(RegexPatternCacheKey(regex, flags), result, status);
+    if (U_FAILURE(status)) {
+        SharedObject::clearPtr(result);
+        if (status < U_REGEX_ERROR_START || U_REGEX_ERROR_LIMIT <= status) {
+            // Only errors in the pattern itself are worth keeping. A failure that
+            //   may not happen again, like running out of memory, is removed from
+            //   the cache, along with any other unused entries.
+            cache->flush();
+        } else if (pe != NULL) {
+            // The cache keeps only the error code of a failed compile.
+            //   Compile again to fill in the position of the error.
+            UErrorCode compileStatus = U_ZERO_ERROR;
+            delete RegexPattern::compile(regex, flags, *pe, compileStatus);
+        }
+    }
+    return result;
+}
+
+
 //---------------------------------------------------------------------
 //
 //   flags
@@ -515,13 +623,17 @@ UBool U_EXPORT2 RegexPattern::matches(const UnicodeString   &regex,
 
     if (U_FAILURE(status)) {return FALSE;}
 
-    UBool         retVal;
+    UBool         retVal  = FALSE;
     RegexPattern *pat     = NULL;
     RegexMatcher *matcher = NULL;
 
     pat     = RegexPattern::compile(regex, 0, pe, status);
-    matcher = pat->matcher(input, status);
-    retVal  = matcher->matches(status);
+    if (U_SUCCESS(status)) {
+        matcher = pat->matcher(input, status);
+    }
+    if (U_SUCCESS(status)) {
+        retVal  = matcher->matches(status);
+    }
 
     delete matcher;
     delete pat;
@@ -679,6 +791,265 @@ int32_t  RegexPattern::split(UText *input,
 }
 
 
+//---------------------------------------------------------------------
+//
+//   findAll
+//
+//      The input is divided into chunks, and a task for each chunk finds
+//      the matches that begin within it, using a matcher whose region starts
+//      at the chunk start, with transparent, non-anchoring bounds so that
+//      the surrounding text is seen exactly as in a search of the whole input.
+//
+//      A chunk's search is the same as that of the whole input once both
+//      are looking for a match from the same position, or from positions with
+//      no match starting between them.  When a match from the preceding chunk
+//      runs past the start of a chunk, merging the results skips over the
+//      chunk's matches until the two are in step, or, failing that, searches
+//      the chunk again from the end of the preceding match.  This happens
+//      only for patterns with a bounded match length; chunks for patterns that
+//      can not match a line terminator start at line boundaries, and are never
+//      crossed.
+//
+//---------------------------------------------------------------------
+
+//
+//  FindAllChunk   One chunk of the input for findAll(), and the matches found in it.
+//
+struct FindAllChunk: public UMemory {
+    RegexMatcher   *fMatcher;
+    int64_t         fStart;         // Chunk start.
+    int64_t         fLimit;         // Chunk limit.  Later chunks hold matches that start here or beyond.
+    int64_t         fRegionLimit;   // Limit of the matcher region.  Matches starting
+                                    //   within the chunk may extend past the chunk limit.
+    UVector64      *fMatches;       // Start and end index of each match.
+    UErrorCode      fStatus;
+
+    FindAllChunk() : fMatcher(NULL), fStart(0), fLimit(0), fRegionLimit(0),
+                     fMatches(NULL), fStatus(U_ZERO_ERROR) {}
+    ~FindAllChunk() {
+        delete fMatcher;
+        delete fMatches;
+    }
+};
+
+//
+//  findInChunk    Find matches from the start of the matcher's region, up to the
+//                 first one that begins at or beyond the chunk limit.
+//
+static void findInChunk(RegexMatcher &m, int64_t limit, UVector64 &matches, UErrorCode &status) {
+    while (m.find(status)) {
+        int64_t start = m.start64(status);
+        if (start >= limit) {
+            break;
+        }
+        matches.addElement(start, status);
+        matches.addElement(m.end64(status), status);
+    }
+}
+
+U_CDECL_BEGIN
+static void U_CALLCONV
+findAllTask(void *taskContext, int32_t taskIndex) {
+    FindAllChunk &chunk = ((FindAllChunk *)taskContext)[taskIndex];
+    findInChunk(*chunk.fMatcher, chunk.fLimit, *chunk.fMatches, chunk.fStatus);
+}
+U_CDECL_END
+
+//
+//  searchPosAfter    The position from which find() looks for the match that
+//                    follows one from start to end.  After an empty match, the
+//                    search moves on by one code point.
+//
+static int64_t searchPosAfter(UText *text, int64_t start, int64_t end) {
+    if (start < end) {
+        return end;
+    }
+    utext_setNativeIndex(text, end);
+    utext_next32(text);
+    return utext_getNativeIndex(text);
+}
+
+static inline UBool isLineEnd(UChar32 c, UBool unixLines) {
+    if (unixLines) {
+        return c == 0x0a;
+    }
+    return (c >= 0x0a && c <= 0x0d) || c == 0x85 || c == 0x2028 || c == 0x2029;
+}
+
+int32_t RegexPattern::findAll(UText          *input,
+                              int32_t         taskCount,
+                              URegexExecutor *executor,
+                              const void     *executorContext,
+                              int64_t        *dest,
+                              int32_t         destCapacity,
+                              UErrorCode     &status) const {
+    if (U_FAILURE(status)) {
+        return 0;
+    }
+    if (U_FAILURE(fDeferredStatus)) {
+        status = fDeferredStatus;
+        return 0;
+    }
+    if (input == NULL || taskCount < 1 || destCapacity < 0 || (dest == NULL && destCapacity > 0)) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+
+    // A private iterator over the input, for finding the chunk boundaries and for merging.
+    LocalUTextPointer text(utext_clone(NULL, input, FALSE, TRUE, &status));
+    if (U_FAILURE(status)) {
+        return 0;
+    }
+    int64_t length = utext_nativeLength(text.getAlias());
+
+    //
+    // Choose the chunk boundaries, roughly evenly spaced.
+    //   For line bounded patterns, move each to the start of a line;
+    //   otherwise to the start of a code point.
+    //
+    UVector64 bounds(status);
+    bounds.addElement(0, status);
+    UBool lineBounded = fLineBounded && !fChainedMatches;
+    UBool lengthBounded = fMaxMatchLen != INT32_MAX && !fChainedMatches;
+    if (lineBounded || lengthBounded) {
+        UBool unixLines = (fFlags & UREGEX_UNIX_LINES) != 0;
+        int64_t chunkLength = length / taskCount;
+        for (int32_t i=1; i<taskCount && U_SUCCESS(status); i++) {
+            utext_setNativeIndex(text.getAlias(), chunkLength * i);
+            if (lineBounded) {
+                UChar32 c;
+                do {
+                    c = utext_next32(text.getAlias());
+                } while (c != U_SENTINEL && !isLineEnd(c, unixLines));
+            }
+            int64_t boundary = utext_getNativeIndex(text.getAlias());
+            if (boundary > bounds.lastElementi() && boundary < length) {
+                bounds.addElement(boundary, status);
+            }
+        }
+    }
+    bounds.addElement(length, status);
+    if (U_FAILURE(status)) {
+        return 0;
+    }
+
+    //
+    // Set up a matcher for each chunk.
+    //
+    int32_t chunkCount = bounds.size() - 1;
+    LocalArray<FindAllChunk> chunks(new FindAllChunk[chunkCount]);
+    if (chunks.isNull()) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return 0;
+    }
+    int32_t i;
+    for (i=0; i<chunkCount && U_SUCCESS(status); i++) {
+        FindAllChunk &chunk = chunks[i];
+        chunk.fStart = bounds.elementAti(i);
+        if (i == chunkCount-1) {
+            chunk.fLimit = U_INT64_MAX;     // Includes an empty match at the end of input.
+            chunk.fRegionLimit = length;
+        } else {
+            chunk.fLimit = bounds.elementAti(i+1);
+            chunk.fRegionLimit = chunk.fLimit;
+            if (!lineBounded) {
+                // Room for a match that begins just before the chunk limit.
+                //   fMaxMatchLen is in UTF-16 code units, so moving by that many code
+                //   points is enough for any input encoding.
+                utext_setNativeIndex(text.getAlias(), chunk.fLimit);
+                utext_moveIndex32(text.getAlias(), fMaxMatchLen);
+                chunk.fRegionLimit = utext_getNativeIndex(text.getAlias());
+            }
+        }
+        chunk.fMatches = new UVector64(status);
+        chunk.fMatcher = matcher(status);
+        if (U_SUCCESS(status) && (chunk.fMatches == NULL || chunk.fMatcher == NULL)) {
+            status = U_MEMORY_ALLOCATION_ERROR;
+        }
+        if (U_FAILURE(status)) {
+            break;
+        }
+        chunk.fMatcher->reset(text.getAlias());
+        chunk.fMatcher->useTransparentBounds(TRUE);
+        chunk.fMatcher->useAnchoringBounds(FALSE);
+        chunk.fMatcher->region(chunk.fStart, chunk.fRegionLimit, status);
+    }
+    if (U_FAILURE(status)) {
+        return 0;
+    }
+
+    //
+    // Search the chunks.
+    //
+    if (executor != NULL && chunkCount > 1) {
+        (*executor)(executorContext, chunkCount, findAllTask, chunks.getAlias());
+    } else {
+        for (i=0; i<chunkCount; i++) {
+            findAllTask(chunks.getAlias(), i);
+        }
+    }
+    for (i=0; i<chunkCount; i++) {
+        if (U_FAILURE(chunks[i].fStatus)) {
+            status = chunks[i].fStatus;
+            return 0;
+        }
+    }
+
+    //
+    // Merge the results.
+    //   searchPos is where a search of the whole input would look for its next match.
+    //   No match starts between it and the start of the chunk being merged.
+    //
+    UVector64 rescan(status);
+    int32_t matchCount = 0;
+    int64_t searchPos = 0;
+    for (i=0; i<chunkCount && U_SUCCESS(status); i++) {
+        FindAllChunk &chunk = chunks[i];
+        int64_t from = searchPos > chunk.fStart ? searchPos : chunk.fStart;
+        if (from >= chunk.fLimit) {
+            // A match from an earlier chunk spans this one.
+            continue;
+        }
+
+        // Find the chunk's first match that its search looked for from
+        //   at or before the position that the whole input search has reached.
+        const UVector64 *matches = chunk.fMatches;
+        int64_t chunkSearchPos = chunk.fStart;
+        int32_t m;
+        for (m=0; m<matches->size(); m+=2) {
+            int64_t start = matches->elementAti(m);
+            if (chunkSearchPos <= from && from <= start) {
+                break;
+            }
+            chunkSearchPos = searchPosAfter(text.getAlias(), start, matches->elementAti(m+1));
+        }
+        if (chunkSearchPos > from) {
+            // The chunk's search never got in step.  Search this chunk again.
+            rescan.removeAllElements();
+            chunk.fMatcher->region(from, chunk.fRegionLimit, status);
+            findInChunk(*chunk.fMatcher, chunk.fLimit, rescan, status);
+            matches = &rescan;
+            m = 0;
+        }
+
+        for (; m<matches->size(); m+=2) {
+            int64_t start = matches->elementAti(m);
+            int64_t end = matches->elementAti(m+1);
+            if (matchCount < destCapacity) {
+                dest[matchCount*2] = start;
+                dest[matchCount*2+1] = end;
+            }
+            matchCount++;
+            searchPos = searchPosAfter(text.getAlias(), start, end);
+        }
+    }
+    if (U_SUCCESS(status) && matchCount > destCapacity) {
+        status = U_BUFFER_OVERFLOW_ERROR;
+    }
+    return matchCount;
+}
+
+
 //---------------------------------------------------------------------
 //
 //   dump    Output the compiled form of the pattern.
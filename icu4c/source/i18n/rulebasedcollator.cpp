@@ -1328,6 +1328,62 @@ RuleBasedCollator::getSortKey(const UChar *s, int32_t length,
     return U_SUCCESS(errorCode) ? sink.NumberOfBytesAppended() : 0;
 }
 
+namespace {
+
+/** Maximum length of the part of a compact sort key after the primary weights. */
+const int32_t COMPACT_LOWER_LEVELS_LENGTH = 4;
+
+}  // namespace
+
+int32_t
+RuleBasedCollator::getCompactSortKey(const UnicodeString &s,
+                                     uint8_t *dest, int32_t capacity) const {
+    return getCompactSortKey(s.getBuffer(), s.length(), dest, capacity);
+}
+
+int32_t
+RuleBasedCollator::getCompactSortKey(const UChar *s, int32_t length,
+                                     uint8_t *dest, int32_t capacity) const {
+    if((s == NULL && length != 0) || capacity < 0 || (dest == NULL && capacity > 0)) {
+        return 0;
+    }
+    MaybeStackArray<uint8_t, 400> key;
+    int32_t keyLength = getSortKey(s, length, key.getAlias(), key.getCapacity());
+    if(keyLength > key.getCapacity()) {
+        if(key.resize(keyLength) == NULL) { return 0; }
+        keyLength = getSortKey(s, length, key.getAlias(), keyLength);
+    }
+    if(keyLength == 0) { return 0; }
+    // Sort key weight bytes are never 00 or 01,
+    // so the primary level ends at the first level separator.
+    uint8_t *p = key.getAlias();
+    int32_t limit = keyLength - 1;  // before the terminator
+    int32_t primaryLength = 0;
+    while(primaryLength < limit && p[primaryLength] != Collation::LEVEL_SEPARATOR_BYTE) {
+        ++primaryLength;
+    }
+    int32_t lowerStart = primaryLength + 1;
+    if((limit - lowerStart) > COMPACT_LOWER_LEVELS_LENGTH) {
+        // Replace the lower levels with a hash (FNV-1a) of their bytes,
+        // written with byte values 02..FF.
+        uint32_t hash = 0x811c9dc5;
+        for(int32_t i = lowerStart; i < limit; ++i) {
+            hash = (hash ^ p[i]) * 0x01000193;
+        }
+        for(int32_t i = 0; i < COMPACT_LOWER_LEVELS_LENGTH; ++i) {
+            p[lowerStart + i] = (uint8_t)(2 + hash % 254);
+            hash /= 254;
+        }
+        limit = lowerStart + COMPACT_LOWER_LEVELS_LENGTH;
+        p[limit] = Collation::TERMINATOR_BYTE;
+        keyLength = limit + 1;
+    }
+    if(capacity > 0) {
+        uprv_memcpy(dest, p, keyLength <= capacity ? keyLength : capacity);
+    }
+    return keyLength;
+}
+
 void
 RuleBasedCollator::writeSortKey(const UChar *s, int32_t length,
                                 SortKeyByteSink &sink, UErrorCode &errorCode) const {
@@ -1511,6 +1567,41 @@ RuleBasedCollator::internalGetCEs(const UnicodeString &str, UVector64 &ces,
 
 namespace {
 
+uint32_t getFirstPrimary(CollationIterator &iter, const CollationSettings &settings,
+                         UErrorCode &errorCode) {
+    // With "shifted" alternate handling, variable primaries are ignored at the primary level.
+    uint32_t variableTop =
+        settings.getAlternateHandling() == UCOL_SHIFTED ? settings.variableTop : 0;
+    int64_t ce;
+    while((ce = iter.nextCE(errorCode)) != Collation::NO_CE) {
+        uint32_t p = (uint32_t)(ce >> 32);
+        if(p > variableTop) {
+            return settings.hasReordering() ? settings.reorder(p) : p;
+        }
+    }
+    return 0;
+}
+
+}  // namespace
+
+uint32_t
+RuleBasedCollator::internalGetFirstPrimary(const UnicodeString &str, UErrorCode &errorCode) const {
+    if(U_FAILURE(errorCode)) { return 0; }
+    const UChar *s = str.getBuffer();
+    const UChar *limit = s + str.length();
+    UBool numeric = settings->isNumeric();
+    // Stops after the first non-ignorable CE, without looking at the rest of the string.
+    if(settings->dontCheckFCD()) {
+        UTF16CollationIterator iter(data, numeric, s, s, limit);
+        return getFirstPrimary(iter, *settings, errorCode);
+    } else {
+        FCDUTF16CollationIterator iter(data, numeric, s, s, limit);
+        return getFirstPrimary(iter, *settings, errorCode);
+    }
+}
+
+namespace {
+
 void appendSubtag(CharString &s, char letter, const char *subtag, int32_t length,
                   UErrorCode &errorCode) {
     if(U_FAILURE(errorCode) || length == 0) { return; }
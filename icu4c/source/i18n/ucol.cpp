@@ -209,6 +209,18 @@ ucol_getSortKey(const    UCollator    *coll,
     return keySize;
 }
 
+U_CAPI int32_t U_EXPORT2
+ucol_getCompactSortKey(const UCollator *coll,
+                       const UChar *source, int32_t sourceLength,
+                       uint8_t *result, int32_t resultLength) {
+    const RuleBasedCollator *rbc = RuleBasedCollator::rbcFromUCollator(coll);
+    if(rbc == NULL) {
+        return Collator::fromUCollator(coll)->
+                getSortKey(source, sourceLength, result, resultLength);
+    }
+    return rbc->getCompactSortKey(source, sourceLength, result, resultLength);
+}
+
 U_CAPI int32_t U_EXPORT2
 ucol_nextSortKeyPart(const UCollator *coll,
                      UCharIterator *iter,
@@ -271,6 +271,22 @@ public:
          */
         int32_t getBucketIndex(const UnicodeString &name, UErrorCode &errorCode) const;
 
+#ifndef U_HIDE_DRAFT_API
+        /**
+         * Finds the index buckets for an array of names.
+         * Equivalent to calling getBucketIndex() for each name.
+         *
+         * @param names the strings to be sorted into index buckets
+         * @param length the number of names
+         * @param indices receives the bucket number for each name;
+         *                must have room for length values
+         * @param errorCode Error code, will be set with the reason if the operation fails.
+         * @draft ICU 63
+         */
+        void getBucketIndices(const UnicodeString names[], int32_t length, int32_t *indices,
+                              UErrorCode &errorCode) const;
+#endif  /* U_HIDE_DRAFT_API */
+
         /**
          * Returns the index-th bucket. Returns NULL if the index is out of range.
          *
@@ -532,6 +548,24 @@ public:
      */
     virtual int32_t  getBucketIndex(const UnicodeString &itemName, UErrorCode &status);
 
+#ifndef U_HIDE_DRAFT_API
+    /**
+     *   Given an array of record names, return the zero-based index of the Bucket
+     *   in which each item should appear.
+     *   Equivalent to calling getBucketIndex() for each name.
+     *   Records will not be added to the index by this function.
+     *
+     * @param names  The names whose bucket positions in the index are to be determined.
+     * @param length  The number of names.
+     * @param indices  Receives the bucket number for each name;
+     *                 must have room for length values.
+     * @param status  Error code, will be set with the reason if the operation fails.
+     * @draft ICU 63
+     */
+    void getBucketIndices(const UnicodeString names[], int32_t length, int32_t *indices,
+                          UErrorCode &status);
+#endif  /* U_HIDE_DRAFT_API */
+
 
     /**
      *   Get the zero based index of the current Bucket from an iteration
@@ -65,7 +65,9 @@ struct Regex8BitSet;
 class  RegexCImpl;
 class  RegexMatcher;
 class  RegexPattern;
+class  RegexReplacement;
 struct REStackFrame;
+struct RELinearThreads;
 class  RuleBasedBreakIterator;
 class  UnicodeSet;
 class  UVector;
@@ -563,6 +565,56 @@ public:
         int32_t          destCapacity,
         UErrorCode       &status) const;
 
+#ifndef U_HIDE_DRAFT_API
+    /**
+     * Find all of the matches for this pattern in the input text, searching
+     * separate parts of a large input concurrently.
+     *
+     * The matches are the same as those that would be found by calling
+     * <code>RegexMatcher::find()</code> repeatedly over the whole input, and
+     * are returned in the same order.  Only the bounds of the overall matches
+     * are returned, not those of capture groups.
+     *
+     * The input is divided into chunks at points that no match can cross.
+     * This is possible when the pattern can not match a line terminator,
+     * in which case the input is divided at line boundaries, or when the
+     * length of the longest possible match is bounded, in which case a
+     * search may run a little past the end of its chunk, and any match that
+     * does cross a chunk boundary is resolved when the results are merged.
+     * Patterns that have neither property, and patterns that use <code>\\G</code>,
+     * are searched sequentially as a single chunk.
+     *
+     * A matcher is created for each chunk; the input text must remain
+     * unchanged, and must be safe to read from multiple threads, until
+     * this function returns.
+     *
+     * @param input       The text to be searched.
+     * @param taskCount   The number of chunks to divide the input into.  Fewer
+     *                    chunks may be used, depending on the pattern and the input.
+     * @param executor    The function to run the search of each chunk, typically
+     *                    by handing the chunks to a pool of threads.  If NULL, the
+     *                    chunks are searched one after another on the calling thread.
+     * @param executorContext  A context pointer that is passed to the executor.
+     * @param dest        An array to receive the start and end index of each match,
+     *                    with match i occupying <code>dest[2*i]</code> and <code>dest[2*i+1]</code>.
+     *                    Can be NULL if destCapacity is 0.
+     * @param destCapacity  The number of matches that dest can hold; the array must
+     *                    have space for 2*destCapacity elements.
+     * @param status      A reference to a UErrorCode to receive any errors.
+     *                    Set to U_BUFFER_OVERFLOW_ERROR if there are more than
+     *                    destCapacity matches.
+     * @return            The number of matches found.  This may be more than destCapacity.
+     * @draft ICU 63
+     */
+    int32_t findAll(UText          *input,
+                    int32_t         taskCount,
+                    URegexExecutor *executor,
+                    const void     *executorContext,
+                    int64_t        *dest,
+                    int32_t         destCapacity,
+                    UErrorCode     &status) const;
+#endif  /* U_HIDE_DRAFT_API */
+
 
     /**
      * ICU "poor man's RTTI", returns a UClassID for the actual class.
@@ -626,11 +678,21 @@ private:
     Regex8BitSet   *fInitialChars8;
     UBool           fNeedsAltInput;
 
+    int32_t         fMaxMatchLen;  // Maximum Match Length, in UTF-16 code units, or INT32_MAX
+                                   //   if unbounded.  May be longer than the true longest
+                                   //   match, never shorter.
+    UBool           fLineBounded;  // TRUE if no match can include a line terminator.
+    UBool           fChainedMatches; // TRUE if a match can depend on where the previous
+                                   //   match ended, as with \G.
+    int32_t         fLinearLoopDepth; // UREGEX_LINEAR: nesting depth of the loops that
+                                   //   end after an iteration that matches an empty string.
+
     UHashtable     *fNamedCaptureMap;  // Map from capture group names to numbers.
 
     friend class RegexCompile;
     friend class RegexMatcher;
     friend class RegexCImpl;
+    friend class RegexReplacement;
 
     //
     //  Implementation Methods
@@ -1153,6 +1215,27 @@ public:
     */
     virtual RegexMatcher &refreshInputText(UText *input, UErrorCode &status);
 
+#ifndef U_HIDE_DRAFT_API
+   /**
+    *   Changes the pattern that this matcher uses to find matches.
+    *   This allows a RegexMatcher to be reused with a different pattern, keeping
+    *   the storage it has already allocated for matching, which is more efficient
+    *   than creating a new RegexMatcher for each pattern.
+    * <p>
+    *   The input text, the region and its bounds settings, the time and stack
+    *   limits and any callbacks are kept.  The results of any previous match
+    *   are discarded, and a subsequent find() will begin at the start of the region.
+    *
+    *   @param pattern The new pattern.  The matcher retains a reference to it,
+    *                  so the pattern must not be deleted while the matcher
+    *                  is still using it.
+    *   @param status  A reference to a UErrorCode to receive any errors.
+    *   @return this RegexMatcher.
+    *   @draft ICU 63
+    */
+    RegexMatcher &usePattern(const RegexPattern &pattern, UErrorCode &status);
+#endif  /* U_HIDE_DRAFT_API */
+
 private:
     /**
      * Cause a compilation error if an application accidentally attempts to
@@ -1405,6 +1488,30 @@ public:
     *    @stable ICU 4.6
     */
     virtual UText *replaceAll(UText *replacement, UText *dest, UErrorCode &status);
+
+#ifndef U_HIDE_DRAFT_API
+   /**
+    *    Replaces every substring of the input that matches the pattern
+    *    with the given replacement string, writing the result to a ByteSink
+    *    in UTF-8.
+    *
+    *    This method first resets this matcher. It then scans the input string
+    *    looking for matches of the pattern. Input that is not part of any
+    *    match is left unchanged; each match is replaced in the result by the
+    *    replacement string. The replacement string may contain references to
+    *    capture groups.
+    *
+    *    The replacement string is parsed once for the whole operation, and the
+    *    result is written directly to the sink, without building an intermediate
+    *    UTF-16 string.
+    *
+    *    @param   replacement a string containing the replacement text.
+    *    @param   sink        the ByteSink to receive the results of the find and replace, in UTF-8.
+    *    @param   status      a reference to a UErrorCode to receive any errors.
+    *    @draft ICU 63
+    */
+    void replaceAll(const UnicodeString &replacement, ByteSink &sink, UErrorCode &status);
+#endif  /* U_HIDE_DRAFT_API */
     
 
    /**
@@ -1604,6 +1711,37 @@ public:
         UText           *dest[],
         int32_t          destCapacity,
         UErrorCode       &status);
+
+#ifndef U_HIDE_DRAFT_API
+    /**
+     * Split a string into fields, giving the start and limit index of each
+     * field in the input rather than a copy of its text.
+     * The fields are the same as those produced by split(), including
+     * those for capture groups in the delimiter pattern; a capture group that
+     * did not take part in the match has a start and limit of -1.
+     *
+     * @param input   The string to be split into fields.  The field delimiters
+     *                match the pattern (in the "this" object).  This matcher
+     *                will be reset to this input string.
+     * @param dest    An array to receive the bounds of the fields, with field i
+     *                occupying <code>dest[2*i]</code> (start) and <code>dest[2*i+1]</code> (limit).
+     * @param destCapacity  The number of fields that dest can hold; the array must
+     *                have space for 2*destCapacity elements.
+     *                If the number of fields found is less than destCapacity, the
+     *                extra elements of the destination array are not altered.
+     *                If destCapacity is less than the number of fields, the last
+     *                field extends to the end of the input, including any
+     *                field delimiters.
+     * @param status  A reference to a UErrorCode to receive any errors.
+     * @return        The number of fields into which the input string was split.
+     *
+     * @draft ICU 63
+     */
+    int32_t splitIndexes(UText *input,
+        int64_t         *dest,
+        int32_t          destCapacity,
+        UErrorCode       &status);
+#endif  /* U_HIDE_DRAFT_API */
     
   /**
     *   Set a processing time limit for match operations with this Matcher.
@@ -1792,11 +1930,25 @@ private:
     inline UBool         findProgressInterrupt(int64_t matchIndex, UErrorCode &status);
     
     int64_t              appendGroup(int32_t groupNum, UText *dest, UErrorCode &status) const;
+    RegexMatcher        &appendReplacement(UText *dest, const RegexReplacement &replacement,
+                                           UErrorCode &status);
+    void                 appendInputUTF8(ByteSink &sink, int64_t start, int64_t limit,
+                                         UErrorCode &status) const;
     
     UBool                findUsingChunk(UErrorCode &status);
     void                 MatchChunkAt(int32_t startIdx, UBool toEnd, UErrorCode &status);
     UBool                isChunkWordBoundary(int32_t pos);
 
+    //
+    //  MatchLinear   The match engine for patterns compiled with UREGEX_LINEAR.
+    //                Runs all threads of the pattern in a single pass over the input.
+    //                If findMatch is TRUE, a match may start at any position from startIdx on.
+    //
+    void                 MatchLinear(int64_t startIdx, UBool toEnd, UBool findMatch, UErrorCode &status);
+    void                 addLinearThread(RELinearThreads &list, int32_t patIdx, int64_t *frame,
+                                         int64_t inputIdx, int64_t mark, int64_t *marks, int64_t *stack);
+    UBool                isLinearAssertion(int32_t op, int64_t inputIdx);
+
     const RegexPattern  *fPattern;
     RegexPattern        *fPatternOwned;    // Non-NULL if this matcher owns the pattern, and
                                            //   should delete it when through.
@@ -649,6 +649,59 @@ public:
     virtual int32_t getSortKey(const char16_t *source, int32_t sourceLength,
                                uint8_t *result, int32_t resultLength) const;
 
+#ifndef U_HIDE_DRAFT_API
+    /**
+     * Get a compact sort key as an array of bytes from a UnicodeString.
+     * It contains the primary weights of the regular sort key,
+     * followed by a fixed-size hash of the weights of all other levels
+     * up to the strength of this collator.
+     * Such keys are smaller than regular sort keys, especially for long strings,
+     * for example for database indexes.
+     *
+     * Compact sort keys are compared with <code>strcmp()</code> like regular sort keys.
+     * If two strings compare different on the primary level,
+     * then their compact sort keys compare in the same order.
+     * Strings that compare equal (with this collator's strength)
+     * have equal compact sort keys.
+     * Strings with the same primary weights but other differences
+     * usually have different compact sort keys, but they are ordered arbitrarily
+     * (consistently for a given collator and version),
+     * and equal compact sort keys do not guarantee equal strings.
+     * When the lower levels are no longer than the hash, then they are kept as is.
+     *
+     * Compact sort keys must not be compared with regular sort keys,
+     * nor merged or used for bounds with ucol_mergeSortkeys() and ucol_getBound().
+     *
+     * @param source string to be processed.
+     * @param result buffer to store result in. If NULL, number of bytes needed
+     *        will be returned.
+     * @param resultLength length of the result buffer. If if not enough the
+     *        buffer will be filled to capacity.
+     * @return Number of bytes needed for storing the compact sort key
+     * @see getSortKey
+     * @draft ICU 63
+     */
+    int32_t getCompactSortKey(const UnicodeString &source, uint8_t *result,
+                              int32_t resultLength) const;
+
+    /**
+     * Get a compact sort key as an array of bytes from a char16_t buffer.
+     * See the UnicodeString overload for details.
+     *
+     * @param source string to be processed.
+     * @param sourceLength length of string to be processed. If -1, the string
+     *        is 0 terminated and length will be decided by the function.
+     * @param result buffer to store result in. If NULL, number of bytes needed
+     *        will be returned.
+     * @param resultLength length of the result buffer. If if not enough the
+     *        buffer will be filled to capacity.
+     * @return Number of bytes needed for storing the compact sort key
+     * @draft ICU 63
+     */
+    int32_t getCompactSortKey(const char16_t *source, int32_t sourceLength,
+                              uint8_t *result, int32_t resultLength) const;
+#endif  /* U_HIDE_DRAFT_API */
+
     /**
      * Retrieves the reordering codes for this collator.
      * @param dest The array to fill with the script ordering.
@@ -790,6 +843,16 @@ public:
      * @internal for tests & tools
      */
     void internalGetCEs(const UnicodeString &str, UVector64 &ces, UErrorCode &errorCode) const;
+
+    /**
+     * Returns the first primary weight of the string that is not ignored
+     * at the primary level with the current settings, after script reordering,
+     * or 0 if the string is completely ignorable at the primary level.
+     * Strings with different first primary weights compare in the order of these weights.
+     * Used by AlphabeticIndex.
+     * @internal
+     */
+    uint32_t internalGetFirstPrimary(const UnicodeString &str, UErrorCode &errorCode) const;
 #endif  // U_HIDE_INTERNAL_API
 
 protected:
@@ -1019,6 +1019,42 @@ ucol_getSortKey(const    UCollator    *coll,
         uint8_t        *result,
         int32_t        resultLength);
 
+#ifndef U_HIDE_DRAFT_API
+/**
+ * Get a compact sort key for a string from a UCollator.
+ * It contains the primary weights of the regular sort key,
+ * followed by a fixed-size hash of the weights of all other levels
+ * up to the strength of the collator.
+ * Compact sort keys are compared with <TT>strcmp</TT> like regular sort keys.
+ *
+ * Strings that differ on the primary level have compact sort keys in the same order
+ * as their regular sort keys.
+ * Strings that compare equal have equal compact sort keys.
+ * Strings with the same primary weights but other differences
+ * usually have different compact sort keys, but they are ordered arbitrarily,
+ * and equal compact sort keys do not guarantee equal strings.
+ * Compact sort keys must not be mixed with regular sort keys,
+ * nor used with ucol_mergeSortkeys() or ucol_getBound().
+ *
+ * For a collator that is not a RuleBasedCollator, this returns the regular sort key.
+ * The buffer and return value semantics are the same as for ucol_getSortKey().
+ * @param coll The UCollator containing the collation rules.
+ * @param source The string to transform.
+ * @param sourceLength The length of source, or -1 if null-terminated.
+ * @param result A pointer to a buffer to receive the compact sort key.
+ * @param resultLength The maximum size of result.
+ * @return The size needed to fully store the compact sort key.
+ *      If there was an internal error generating the sort key,
+ *      a zero value is returned.
+ * @see ucol_getSortKey
+ * @draft ICU 63
+ */
+U_DRAFT int32_t U_EXPORT2
+ucol_getCompactSortKey(const UCollator *coll,
+                       const UChar *source, int32_t sourceLength,
+                       uint8_t *result, int32_t resultLength);
+#endif  /* U_HIDE_DRAFT_API */
+
 
 /** Gets the next count bytes of a sort key. Caller needs
  *  to preserve state array between calls and to provide
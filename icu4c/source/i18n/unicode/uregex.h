@@ -105,7 +105,25 @@ typedef enum URegexpFlag{
        *     escaped letters represent themselves.
        *     @stable ICU 4.0
        */
-     UREGEX_ERROR_ON_UNKNOWN_ESCAPES = 512
+     UREGEX_ERROR_ON_UNKNOWN_ESCAPES = 512,
+
+#ifndef U_HIDE_DRAFT_API
+     /**  Linear-time matching.
+       *     If set, matching runs all alternatives of the pattern in a single
+       *     pass over the input instead of backtracking, so that the time to
+       *     match is proportional to the length of the input for any pattern,
+       *     and patterns like (a+)+b can not take exponential time.
+       *     The matches and capture groups are intended to be the same as
+       *     without the flag, but this is not guaranteed for all patterns.
+       *
+       *     Patterns that contain back references, look-ahead or look-behind
+       *     assertions, atomic groups, possessive quantifiers or \\X fail to
+       *     compile with U_REGEX_UNIMPLEMENTED. Counted repetitions {n,m} are
+       *     expanded; very large ones fail with U_REGEX_PATTERN_TOO_BIG.
+       *     @draft ICU 63
+       */
+     UREGEX_LINEAR = 1024
+#endif  /* U_HIDE_DRAFT_API */
 
 }  URegexpFlag;
 
@@ -114,7 +132,9 @@ typedef enum URegexpFlag{
   *  string form into an internal representation using the specified match mode flags.
   *  The resulting regular expression handle can then be used to perform various
   *   matching operations.
-  * 
+  * <p>
+  *  Compiled patterns are kept in a process-wide cache, so opening the same
+  *  pattern with the same flags again does not compile it again.
   *
   * @param pattern        The Regular Expression pattern to be compiled. 
   * @param patternLength  The length of the pattern, or -1 if the pattern is
@@ -279,7 +299,8 @@ uregex_pattern(const URegularExpression *regexp,
  * @param regexp     The compiled regular expression.
  * @param status     Receives errors detected by this function.
  * @return the pattern text.  The storage for the text is owned by the regular expression
- *                   object, and must not be altered or deleted.
+ *                   object, and must not be altered or deleted.  The UText is not shared
+ *                   with clones, or with other handles for the same pattern.
  *
  * @stable ICU 4.6
  */
@@ -1610,5 +1631,48 @@ uregex_getFindProgressCallback(const URegularExpression          *regexp,
                                 const void                        **context,
                                 UErrorCode                        *status);
 
+#ifndef U_HIDE_DRAFT_API
+/**
+ * Function pointer for one task of a parallel regular expression operation,
+ * such as <code>RegexPattern::findAll()</code>.
+ * Tasks are supplied by ICU, and run by a <code>URegexExecutor</code>
+ * that is supplied by the application.
+ *
+ * @param taskContext  the task context pointer that ICU passed to the executor.
+ * @param taskIndex    the index of the task to run, from 0 to taskCount-1.
+ * @draft ICU 63
+ */
+U_CDECL_BEGIN
+typedef void U_CALLCONV URegexTask (
+                   void       *taskContext,
+                   int32_t     taskIndex);
+U_CDECL_END
+
+/**
+ * Function pointer for an application supplied executor, used to run the
+ * tasks of a parallel regular expression operation concurrently,
+ * for example on a thread pool.
+ *
+ * The executor must call <code>task(taskContext, i)</code> exactly once for each
+ * <code>i</code> from 0 to <code>taskCount-1</code>.  The calls may be made in any order,
+ * on any threads, and concurrently with each other.  The executor must not
+ * return until all of the calls have returned.
+ *
+ * @param context      the executor context pointer that the application passed
+ *                     to the ICU function along with the executor.
+ * @param taskCount    the number of tasks to run.
+ * @param task         the function that runs one task.
+ * @param taskContext  context pointer to pass to each call of the task function.
+ * @draft ICU 63
+ */
+U_CDECL_BEGIN
+typedef void U_CALLCONV URegexExecutor (
+                   const void  *context,
+                   int32_t      taskCount,
+                   URegexTask  *task,
+                   void        *taskContext);
+U_CDECL_END
+#endif  /* U_HIDE_DRAFT_API */
+
 #endif   /*  !UCONFIG_NO_REGULAR_EXPRESSIONS  */
 #endif   /*  UREGEX_H  */
@@ -25,6 +25,7 @@
 #include "umutex.h"
 #include "uvectr32.h"
 
+#include "regeximp.h"
 #include "regextxt.h"
 
 U_NAMESPACE_BEGIN
@@ -36,7 +37,8 @@ public:
     RegularExpression();
     ~RegularExpression();
     int32_t           fMagic;
-    RegexPattern     *fPat;
+    const RegexPattern       *fPat;
+    const SharedRegexPattern *fSharedPat;  // Holds the reference to fPat in the pattern cache.
     u_atomic_int32_t *fPatRefCount;
     UChar            *fPatString;
     int32_t           fPatStringLen;
@@ -45,6 +47,7 @@ public:
     int32_t           fTextLength;   // Length provided by user with setText(), which
                                      //  may be -1.
     UBool             fOwnsText;
+    UText            *fPatText;      // Clone of the pattern text, for uregex_patternUText().
 };
 
 static const int32_t REXP_MAGIC = 0x72657870; // "rexp" in ASCII
@@ -52,6 +55,7 @@ static const int32_t REXP_MAGIC = 0x72657870; // "rexp" in ASCII
 RegularExpression::RegularExpression() {
     fMagic        = REXP_MAGIC;
     fPat          = NULL;
+    fSharedPat    = NULL;
     fPatRefCount  = NULL;
     fPatString    = NULL;
     fPatStringLen = 0;
@@ -59,19 +63,21 @@ RegularExpression::RegularExpression() {
     fText         = NULL;
     fTextLength   = 0;
     fOwnsText     = FALSE;
+    fPatText      = NULL;
 }
 
 RegularExpression::~RegularExpression() {
     delete fMatcher;
     fMatcher = NULL;
     if (fPatRefCount!=NULL && umtx_atomic_dec(fPatRefCount)==0) {
-        delete fPat;
+        SharedObject::clearPtr(fSharedPat);
         uprv_free(fPatString);
         uprv_free((void *)fPatRefCount);
     }
     if (fOwnsText && fText!=NULL) {
         uprv_free((void *)fText);
     }
+    utext_close(fPatText);
     fMagic = 0;
 }
 
@@ -147,22 +153,16 @@ uregex_open( const  UChar          *pattern,
     u_memcpy(patBuf, pattern, actualPatLen);
     patBuf[actualPatLen] = 0;
 
-    UText patText = UTEXT_INITIALIZER;
-    utext_openUChars(&patText, patBuf, patternLength, status);
-
     //
-    // Compile the pattern
+    // Get the compiled pattern. It comes from the pattern cache
+    //    if the same pattern and flags have been compiled before.
     //
-    if (pe != NULL) {
-        re->fPat = RegexPattern::compile(&patText, flags, *pe, *status);
-    } else {
-        re->fPat = RegexPattern::compile(&patText, flags, *status);
-    }
-    utext_close(&patText);
-
+    re->fSharedPat = SharedRegexPattern::getInstance(
+        UnicodeString(FALSE, patBuf, actualPatLen), flags, pe, *status);
     if (U_FAILURE(*status)) {
         goto ErrorExit;
     }
+    re->fPat = re->fSharedPat->get();
 
     //
     // Create the matcher object
@@ -230,22 +230,16 @@ uregex_openUText(UText          *pattern,
     re->fPatStringLen = pattern16Length;
     utext_extract(pattern, 0, patternNativeLength, patBuf, pattern16Length+1, status);
 
-    UText patText = UTEXT_INITIALIZER;
-    utext_openUChars(&patText, patBuf, pattern16Length, status);
-
     //
-    // Compile the pattern
+    // Get the compiled pattern. It comes from the pattern cache
+    //    if the same pattern and flags have been compiled before.
     //
-    if (pe != NULL) {
-        re->fPat = RegexPattern::compile(&patText, flags, *pe, *status);
-    } else {
-        re->fPat = RegexPattern::compile(&patText, flags, *status);
-    }
-    utext_close(&patText);
-
+    re->fSharedPat = SharedRegexPattern::getInstance(
+        UnicodeString(FALSE, patBuf, pattern16Length), flags, pe, *status);
     if (U_FAILURE(*status)) {
         goto ErrorExit;
     }
+    re->fPat = re->fSharedPat->get();
 
     //
     // Create the matcher object
@@ -302,6 +296,7 @@ uregex_clone(const URegularExpression *source2, UErrorCode *status)  {
     }
 
     clone->fPat          = source->fPat;
+    clone->fSharedPat    = source->fSharedPat;
     clone->fPatRefCount  = source->fPatRefCount;
     clone->fPatString    = source->fPatString;
     clone->fPatStringLen = source->fPatStringLen;
@@ -344,7 +339,15 @@ U_CAPI UText * U_EXPORT2
 uregex_patternUText(const URegularExpression *regexp2,
                           UErrorCode         *status)  {
     RegularExpression *regexp = (RegularExpression*)regexp2;
-    return regexp->fPat->patternText(*status);
+    if (validateRE(regexp, FALSE, status) == FALSE) {
+        return NULL;
+    }
+    // The pattern's own UText is shared with the other users of a cached pattern,
+    //   possibly on other threads. Give each handle its own iterator over it.
+    if (regexp->fPatText == NULL) {
+        regexp->fPatText = utext_clone(NULL, regexp->fPat->patternText(*status), FALSE, TRUE, status);
+    }
+    return U_SUCCESS(*status) ? regexp->fPatText : NULL;
 }
 
 
@@ -47,6 +47,7 @@ static void TestBreakIteratorSafeClone(void);
 static void TestBreakIteratorRules(void);
 static void TestBreakIteratorRuleError(void);
 static void TestBreakIteratorStatusVec(void);
+static void TestBreakIteratorGetBoundaries(void);
 static void TestBreakIteratorUText(void);
 static void TestBreakIteratorTailoring(void);
 static void TestBreakIteratorRefresh(void);
@@ -65,6 +66,7 @@ void addBrkIterAPITest(TestNode** root)
     addTest(root, &TestBreakIteratorRules, "tstxtbd/cbiapts/TestBreakIteratorRules");
     addTest(root, &TestBreakIteratorRuleError, "tstxtbd/cbiapts/TestBreakIteratorRuleError");
     addTest(root, &TestBreakIteratorStatusVec, "tstxtbd/cbiapts/TestBreakIteratorStatusVec");
+    addTest(root, &TestBreakIteratorGetBoundaries, "tstxtbd/cbiapts/TestBreakIteratorGetBoundaries");
     addTest(root, &TestBreakIteratorTailoring, "tstxtbd/cbiapts/TestBreakIteratorTailoring");
     addTest(root, &TestBreakIteratorRefresh, "tstxtbd/cbiapts/TestBreakIteratorRefresh");
     addTest(root, &TestBug11665, "tstxtbd/cbiapts/TestBug11665");
@@ -710,6 +712,77 @@ static void TestBreakIteratorStatusVec() {
 }
 
 
+/*
+ *   TestBreakIteratorGetBoundaries()   Test ubrk_getBoundaries(), preflighting, a
+ *                                      buffer that is too short, and one that fits,
+ *                                      against the boundaries from ubrk_next().
+ */
+static void TestBreakIteratorGetBoundaries(void) {
+    static const struct {
+        UBreakIteratorType type;
+        const char *locale;
+    } testItems[] = {
+        { UBRK_WORD,     "en" },
+        { UBRK_SENTENCE, "en" },
+        { UBRK_SENTENCE, "en@ss=standard" }     /* with suppressions after "Mr." */
+    };
+    UChar   text[64];
+    int32_t i;
+
+    u_uastrncpy(text, "Mr. Smith went to Washington. He said hello, world! Bye.", UPRV_LENGTHOF(text));
+    for (i = 0; i < UPRV_LENGTHOF(testItems); i++) {
+        UErrorCode      status = U_ZERO_ERROR;
+        UBreakIterator *bi = ubrk_open(testItems[i].type, testItems[i].locale, text, -1, &status);
+        int32_t         expected[64];
+        int32_t         actual[64];
+        int32_t         expectedCount = 0;
+        int32_t         count;
+        int32_t         pos;
+
+        if (U_FAILURE(status)) {
+            log_data_err("FAIL: ubrk_open(%d, \"%s\") - %s\n",
+                         testItems[i].type, testItems[i].locale, u_errorName(status));
+            continue;
+        }
+        for (pos = ubrk_first(bi); pos != UBRK_DONE; pos = ubrk_next(bi)) {
+            expected[expectedCount++] = pos;
+        }
+
+        /* Preflighting. */
+        count = ubrk_getBoundaries(bi, NULL, 0, &status);
+        if (status != U_BUFFER_OVERFLOW_ERROR || count != expectedCount) {
+            log_err("FAIL: \"%s\" ubrk_getBoundaries(NULL, 0) = %d (%s), expected %d\n",
+                    testItems[i].locale, count, u_errorName(status), expectedCount);
+        }
+
+        /* A buffer that is too short is filled with the first boundaries. */
+        status = U_ZERO_ERROR;
+        memset(actual, -1, sizeof(actual));
+        count = ubrk_getBoundaries(bi, actual, 2, &status);
+        if (status != U_BUFFER_OVERFLOW_ERROR || count != expectedCount ||
+                actual[0] != expected[0] || actual[1] != expected[1] || actual[2] != -1) {
+            log_err("FAIL: \"%s\" ubrk_getBoundaries(capacity 2) = %d (%s) {%d, %d, %d}\n",
+                    testItems[i].locale, count, u_errorName(status), actual[0], actual[1], actual[2]);
+        }
+
+        /* The exact capacity. */
+        status = U_ZERO_ERROR;
+        memset(actual, -1, sizeof(actual));
+        count = ubrk_getBoundaries(bi, actual, expectedCount, &status);
+        if (U_FAILURE(status) || count != expectedCount ||
+                memcmp(actual, expected, expectedCount * sizeof(int32_t)) != 0) {
+            log_err("FAIL: \"%s\" ubrk_getBoundaries(capacity %d) = %d (%s), boundaries differ from ubrk_next()\n",
+                    testItems[i].locale, expectedCount, count, u_errorName(status));
+        }
+        if (ubrk_current(bi) != u_strlen(text)) {
+            log_err("FAIL: \"%s\" after ubrk_getBoundaries(), ubrk_current() = %d\n",
+                    testItems[i].locale, ubrk_current(bi));
+        }
+        ubrk_close(bi);
+    }
+}
+
+
 /*
  *  static void TestBreakIteratorUText(void);
  *
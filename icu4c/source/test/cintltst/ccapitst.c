@@ -70,6 +70,7 @@ static void TestConvertEx(void);
 static void TestConvertExFromUTF8(void);
 static void TestConvertExFromUTF8_C5F0(void);
 static void TestConvertAlgorithmic(void);
+static void TestConvertByName(void);
        void TestDefaultConverterError(void);    /* defined in cctest.c */
        void TestDefaultConverterSet(void);    /* defined in cctest.c */
 static void TestToUCountPending(void);
@@ -105,6 +106,7 @@ void addTestConvert(TestNode** root)
     addTest(root, &TestConvertExFromUTF8,       "tsconv/ccapitst/TestConvertExFromUTF8");
     addTest(root, &TestConvertExFromUTF8_C5F0,  "tsconv/ccapitst/TestConvertExFromUTF8_C5F0");
     addTest(root, &TestConvertAlgorithmic,      "tsconv/ccapitst/TestConvertAlgorithmic");
+    addTest(root, &TestConvertByName,           "tsconv/ccapitst/TestConvertByName");
     addTest(root, &TestDefaultConverterError,   "tsconv/ccapitst/TestDefaultConverterError");
     addTest(root, &TestDefaultConverterSet,     "tsconv/ccapitst/TestDefaultConverterSet");
 #if !UCONFIG_NO_FILE_IO
@@ -2889,6 +2891,92 @@ ucnv_close(cnv);
 #endif
 }
 
+static void
+TestConvertByName() {
+#if !UCONFIG_NO_LEGACY_CONVERSION
+    static const UChar unicode[]={ 0x61, 0x4e00, 0x30a1, 0xff61, 0x410, 0x62 };
+    static const char shiftJIS[]={
+        0x61, (char)0x88, (char)0xea, (char)0x83, 0x40, (char)0xa1, (char)0x84, 0x40, 0x62
+    };
+    /* the second time around, the names come from the recently-loaded cache */
+    static const char *const names[]={
+        "Shift-JIS", "Shift-JIS", "ibm-943_P15A-2003", "ibm-943_P15A-2003",
+        "shift_jis,swaplfnl", "shift_jis,swaplfnl"
+    };
+
+    UChar uTarget[20];
+    char target[20];
+    UErrorCode errorCode;
+    int32_t i, length;
+
+    for(i=0; i<UPRV_LENGTHOF(names); ++i) {
+        errorCode=U_ZERO_ERROR;
+        length=ucnv_convertFromUChars(names[i], target, UPRV_LENGTHOF(target),
+                                      unicode, UPRV_LENGTHOF(unicode), &errorCode);
+        if(errorCode==U_FILE_ACCESS_ERROR) {
+            log_data_err("unable to open a %s converter - %s\n", names[i], u_errorName(errorCode));
+            return;
+        }
+        if( U_FAILURE(errorCode) ||
+            length!=sizeof(shiftJIS) ||
+            memcmp(target, shiftJIS, length)!=0
+        ) {
+            log_err("ucnv_convertFromUChars(%s) fails (%s), returns %d expect %d\n",
+                    names[i], u_errorName(errorCode), length, (int)sizeof(shiftJIS));
+        }
+
+        errorCode=U_ZERO_ERROR;
+        length=ucnv_convertToUChars(names[i], uTarget, UPRV_LENGTHOF(uTarget),
+                                    shiftJIS, sizeof(shiftJIS), &errorCode);
+        if( U_FAILURE(errorCode) ||
+            length!=UPRV_LENGTHOF(unicode) ||
+            u_memcmp(uTarget, unicode, length)!=0
+        ) {
+            log_err("ucnv_convertToUChars(%s) fails (%s), returns %d expect %d\n",
+                    names[i], u_errorName(errorCode), length, UPRV_LENGTHOF(unicode));
+        }
+
+        if(i==3) {
+            /* must not leave dangling cache entries */
+            ucnv_flushCache();
+        }
+    }
+
+    /* preflighting */
+    errorCode=U_ZERO_ERROR;
+    length=ucnv_convertToUChars("Shift-JIS", NULL, 0, shiftJIS, sizeof(shiftJIS), &errorCode);
+    if(errorCode!=U_BUFFER_OVERFLOW_ERROR || length!=UPRV_LENGTHOF(unicode)) {
+        log_err("ucnv_convertToUChars(preflighting) fails (%s expect U_BUFFER_OVERFLOW_ERROR), returns %d expect %d\n",
+                u_errorName(errorCode), length, UPRV_LENGTHOF(unicode));
+    }
+
+    /* algorithmic converter */
+    errorCode=U_ZERO_ERROR;
+    length=ucnv_convertFromUChars("UTF-16BE", target, UPRV_LENGTHOF(target), unicode, 2, &errorCode);
+    if(U_FAILURE(errorCode) || length!=4 || target[0]!=0 || target[1]!=0x61 || target[2]!=0x4e || target[3]!=0) {
+        log_err("ucnv_convertFromUChars(UTF-16BE) fails (%s), returns %d expect 4\n",
+                u_errorName(errorCode), length);
+    }
+
+    /* unknown converter */
+    errorCode=U_ZERO_ERROR;
+    length=ucnv_convertToUChars("no-such-converter", uTarget, UPRV_LENGTHOF(uTarget),
+                                shiftJIS, sizeof(shiftJIS), &errorCode);
+    if(errorCode!=U_FILE_ACCESS_ERROR || length!=0) {
+        log_err("ucnv_convertToUChars(unknown converter) sets %s expect U_FILE_ACCESS_ERROR\n",
+                u_errorName(errorCode));
+    }
+
+    /* incoming failure */
+    errorCode=U_MESSAGE_PARSE_ERROR;
+    length=ucnv_convertFromUChars("Shift-JIS", target, UPRV_LENGTHOF(target),
+                                  unicode, UPRV_LENGTHOF(unicode), &errorCode);
+    if(errorCode!=U_MESSAGE_PARSE_ERROR || length!=0) {
+        log_err("ucnv_convertFromUChars(U_MESSAGE_PARSE_ERROR) sets %s\n", u_errorName(errorCode));
+    }
+#endif
+}
+
 #if !UCONFIG_NO_FILE_IO && !UCONFIG_NO_LEGACY_CONVERSION
 static void TestLMBCSMaxChar(void) {
     static const struct {
@@ -85,6 +85,9 @@ static void setNuConvTestName(const char *codepage, const char *direction)
 
 
 static void TestCallBackFailure(void);
+#if !UCONFIG_NO_LEGACY_CONVERSION
+static void TestInlineCallBacks(void);
+#endif
 
 void addTestConvertErrorCallBack(TestNode** root);
 
@@ -98,6 +101,7 @@ void addTestConvertErrorCallBack(TestNode** root)
 #if !UCONFIG_NO_LEGACY_CONVERSION
     addTest(root, &TestLegalAndOtherCallBack,  "tsconv/nccbtst/TestLegalAndOtherCallBack");
     addTest(root, &TestSingleByteCallBack,  "tsconv/nccbtst/TestSingleByteCallBack");
+    addTest(root, &TestInlineCallBacks,  "tsconv/nccbtst/TestInlineCallBacks");
 #endif
 
     addTest(root, &TestCallBackFailure,  "tsconv/nccbtst/TestCallBackFailure");
@@ -3385,3 +3389,179 @@ static void TestCallBackFailure(void) {
         log_err("Error: ucnv_cbToUWriteUChars did not react correctly to a bad UErrorCode\n");
     }
 }
+
+#if !UCONFIG_NO_LEGACY_CONVERSION
+/*
+ * The built-in SKIP and SUBSTITUTE callbacks are handled inside the MBCS
+ * conversion loops without calling out. Wrapping them in another callback
+ * forces the regular callback path; both must produce identical results.
+ */
+typedef struct {
+    UConverterFromUCallback fromUAction;
+    UConverterToUCallback toUAction;
+    const void *context;
+} WrappedCallBack;
+
+static void U_CALLCONV
+wrappedFromUCallBack(const void *context, UConverterFromUnicodeArgs *args,
+                     const UChar *codeUnits, int32_t length, UChar32 codePoint,
+                     UConverterCallbackReason reason, UErrorCode *err) {
+    const WrappedCallBack *wrapped=(const WrappedCallBack *)context;
+    wrapped->fromUAction(wrapped->context, args, codeUnits, length, codePoint, reason, err);
+}
+
+static void U_CALLCONV
+wrappedToUCallBack(const void *context, UConverterToUnicodeArgs *args,
+                   const char *codeUnits, int32_t length,
+                   UConverterCallbackReason reason, UErrorCode *err) {
+    const WrappedCallBack *wrapped=(const WrappedCallBack *)context;
+    wrapped->toUAction(wrapped->context, args, codeUnits, length, reason, err);
+}
+
+/* converts in chunks of chunkSize target units; returns the output length */
+static int32_t
+inlineFromU(UConverter *cnv, const UChar *src, int32_t srcLength,
+            char *dest, int32_t *offsets, int32_t destCapacity, int32_t chunkSize,
+            UErrorCode *pErrorCode) {
+    const UChar *source=src, *sourceLimit=src+srcLength;
+    char *target=dest, *targetLimit=dest+destCapacity;
+    int32_t *pOffsets=offsets;
+    ucnv_resetFromUnicode(cnv);
+    for(;;) {
+        char *limit=target+chunkSize<targetLimit ? target+chunkSize : targetLimit;
+        *pErrorCode=U_ZERO_ERROR;
+        ucnv_fromUnicode(cnv, &target, limit, &source, sourceLimit, pOffsets, TRUE, pErrorCode);
+        pOffsets=offsets+(target-dest);
+        if(*pErrorCode!=U_BUFFER_OVERFLOW_ERROR || target==targetLimit) {
+            break;
+        }
+    }
+    return (int32_t)(target-dest);
+}
+
+static int32_t
+inlineToU(UConverter *cnv, const char *src, int32_t srcLength,
+          UChar *dest, int32_t *offsets, int32_t destCapacity, int32_t chunkSize,
+          UErrorCode *pErrorCode) {
+    const char *source=src, *sourceLimit=src+srcLength;
+    UChar *target=dest, *targetLimit=dest+destCapacity;
+    int32_t *pOffsets=offsets;
+    ucnv_resetToUnicode(cnv);
+    for(;;) {
+        UChar *limit=target+chunkSize<targetLimit ? target+chunkSize : targetLimit;
+        *pErrorCode=U_ZERO_ERROR;
+        ucnv_toUnicode(cnv, &target, limit, &source, sourceLimit, pOffsets, TRUE, pErrorCode);
+        pOffsets=offsets+(target-dest);
+        if(*pErrorCode!=U_BUFFER_OVERFLOW_ERROR || target==targetLimit) {
+            break;
+        }
+    }
+    return (int32_t)(target-dest);
+}
+
+static void TestInlineCallBacks(void) {
+    static const char *const names[]={
+        "windows-1252", "ibm-943_P15A-2003", "windows-949-2000",
+        "ibm-1363", "ibm-1047", "ibm-930", "GB18030"
+    };
+    static const UChar unicode[]={
+        0x61, 0x62, 0xe0e, 0x63, 0x4e00, 0xad, 0xe01, 0x20ac,
+        0xd800, 0xdc00, 0x5b57, 0xffff, 0x64, 0xac00, 0x3000, 0x30a2,
+        0xe01, 0xe02, 0x65, 0xd7a3, 0x66, 0xd83d, 0xde00, 0x67
+    };
+    static const int32_t chunks[]={ 1, 3, 1000 };
+    static const UConverterFromUCallback fromUActions[]={
+        UCNV_FROM_U_CALLBACK_SKIP, UCNV_FROM_U_CALLBACK_SUBSTITUTE
+    };
+    static const UConverterToUCallback toUActions[]={
+        UCNV_TO_U_CALLBACK_SKIP, UCNV_TO_U_CALLBACK_SUBSTITUTE
+    };
+    static const void *const contexts[]={ NULL, UCNV_SUB_STOP_ON_ILLEGAL };
+    /* longer than UCNV_MAX_SUBCHAR_LEN when converted */
+    static const UChar longSub[]={ 0x3c, 0x75, 0x6e, 0x6d, 0x61, 0x70, 0x70, 0x65, 0x64, 0x3e, 0 };
+
+    char bytes[400];
+    char bytes1[400], bytes2[400];
+    UChar uchars1[400], uchars2[400];
+    int32_t offsets1[400], offsets2[400];
+    uint32_t seed=0x12345;
+    int32_t i, n, a, c, ch, length1, length2;
+
+    /* deterministic pseudo-random bytes */
+    for(i=0; i<UPRV_LENGTHOF(bytes); ++i) {
+        seed=seed*1103515245+12345;
+        bytes[i]=(char)(seed>>16);
+    }
+
+    for(n=0; n<UPRV_LENGTHOF(names); ++n) {
+        UErrorCode errorCode=U_ZERO_ERROR;
+        UConverter *cnv=ucnv_open(names[n], &errorCode);
+        if(U_FAILURE(errorCode)) {
+            log_data_err("unable to open %s - %s\n", names[n], u_errorName(errorCode));
+            continue;
+        }
+        if((n&1)!=0) {
+            ucnv_setSubstString(cnv, longSub, -1, &errorCode);
+            if(U_FAILURE(errorCode)) {
+                /* stateful converters may not accept it */
+                errorCode=U_ZERO_ERROR;
+            }
+        }
+        for(a=0; a<2; ++a) {
+            for(c=0; c<UPRV_LENGTHOF(contexts); ++c) {
+                for(ch=0; ch<UPRV_LENGTHOF(chunks); ++ch) {
+                    WrappedCallBack wrapped;
+                    UErrorCode errorCode1=U_ZERO_ERROR, errorCode2=U_ZERO_ERROR;
+                    wrapped.fromUAction=fromUActions[a];
+                    wrapped.toUAction=toUActions[a];
+                    wrapped.context=contexts[c];
+
+                    /* fromUnicode */
+                    errorCode=U_ZERO_ERROR;
+                    ucnv_setFromUCallBack(cnv, fromUActions[a], contexts[c], NULL, NULL, &errorCode);
+                    memset(offsets1, 0x55, sizeof(offsets1));
+                    length1=inlineFromU(cnv, unicode, UPRV_LENGTHOF(unicode),
+                                        bytes1, offsets1, UPRV_LENGTHOF(bytes1), chunks[ch], &errorCode1);
+                    ucnv_setFromUCallBack(cnv, wrappedFromUCallBack, &wrapped, NULL, NULL, &errorCode);
+                    memset(offsets2, 0x55, sizeof(offsets2));
+                    length2=inlineFromU(cnv, unicode, UPRV_LENGTHOF(unicode),
+                                        bytes2, offsets2, UPRV_LENGTHOF(bytes2), chunks[ch], &errorCode2);
+                    if(errorCode1!=errorCode2 || length1!=length2 ||
+                            0!=memcmp(bytes1, bytes2, length1) ||
+                            0!=memcmp(offsets1, offsets2, length1*4)) {
+                        log_err("%s fromUnicode action %d context %d chunk %d: "
+                                "inline handling differs from the callback (%s/%d vs. %s/%d)\n",
+                                names[n], (int)a, (int)c, (int)chunks[ch],
+                                u_errorName(errorCode1), (int)length1,
+                                u_errorName(errorCode2), (int)length2);
+                    }
+
+                    /* toUnicode */
+                    errorCode1=errorCode2=U_ZERO_ERROR;
+                    ucnv_setToUCallBack(cnv, toUActions[a], contexts[c], NULL, NULL, &errorCode);
+                    memset(offsets1, 0x55, sizeof(offsets1));
+                    length1=inlineToU(cnv, bytes, UPRV_LENGTHOF(bytes),
+                                      uchars1, offsets1, UPRV_LENGTHOF(uchars1), chunks[ch], &errorCode1);
+                    ucnv_setToUCallBack(cnv, wrappedToUCallBack, &wrapped, NULL, NULL, &errorCode);
+                    memset(offsets2, 0x55, sizeof(offsets2));
+                    length2=inlineToU(cnv, bytes, UPRV_LENGTHOF(bytes),
+                                      uchars2, offsets2, UPRV_LENGTHOF(uchars2), chunks[ch], &errorCode2);
+                    if(errorCode1!=errorCode2 || length1!=length2 ||
+                            0!=memcmp(uchars1, uchars2, length1*U_SIZEOF_UCHAR) ||
+                            0!=memcmp(offsets1, offsets2, length1*4)) {
+                        log_err("%s toUnicode action %d context %d chunk %d: "
+                                "inline handling differs from the callback (%s/%d vs. %s/%d)\n",
+                                names[n], (int)a, (int)c, (int)chunks[ch],
+                                u_errorName(errorCode1), (int)length1,
+                                u_errorName(errorCode2), (int)length2);
+                    }
+                    if(U_FAILURE(errorCode)) {
+                        log_err("%s: setting callbacks failed - %s\n", names[n], u_errorName(errorCode));
+                    }
+                }
+            }
+        }
+        ucnv_close(cnv);
+    }
+}
+#endif
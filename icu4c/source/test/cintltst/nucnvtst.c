@@ -78,6 +78,7 @@ static void TestISO_2022_CN_EXT(void);
 #endif
 static void TestJIS(void);
 static void TestHZ(void);
+static void TestISO_2022_Runs(void);
 #endif
 
 static void TestSCSU(void);
@@ -104,6 +105,7 @@ static void TestJB5275_1(void);
 static void TestJitterbug6175(void);
 
 static void TestIsFixedWidth(void);
+static void TestASCIIRuns(void);
 #endif
 
 static void TestInBufSizes(void);
@@ -300,6 +302,7 @@ void addTestNewConvert(TestNode** root)
    addTest(root, &TestJitterbug915, "tsconv/nucnvtst/TestJitterbug915");
     */
    addTest(root, &TestHZ, "tsconv/nucnvtst/TestHZ");
+   addTest(root, &TestISO_2022_Runs, "tsconv/nucnvtst/TestISO_2022_Runs");
 #endif
 
    addTest(root, &TestSCSU, "tsconv/nucnvtst/TestSCSU");
@@ -332,6 +335,7 @@ void addTestNewConvert(TestNode** root)
    addTest(root, &TestJitterbug6175, "tsconv/nucnvtst/TestJitterbug6175");
 
    addTest(root, &TestIsFixedWidth, "tsconv/nucnvtst/TestIsFixedWidth");
+   addTest(root, &TestASCIIRuns, "tsconv/nucnvtst/TestASCIIRuns");
 #endif
 }
 
@@ -3150,6 +3154,101 @@ TestHZ() {
     free(cBuf);
 }
 
+/*
+ * The ISO-2022 and HZ converters convert runs of ASCII and double-byte characters
+ * between escape/shift sequences with separate code.
+ * Test runs that are interrupted by unassigned and unmappable characters,
+ * CR/LF and buffer boundaries.
+ */
+static void
+TestISO_2022_Runs() {
+    static const uint8_t jpBytes[]={
+        0x1b, 0x24, 0x42, 0x30, 0x21, 0x24, 0x22, 0x24, 0x24, 0x2f, 0x21, 0x30, 0x22,
+        0x1b, 0x28, 0x42, 0x61, 0x62, 0x63, 0x0d, 0x0a,
+        0x1b, 0x24, 0x42, 0x24, 0x22, 0x1b, 0x28, 0x42
+    };
+    static const UChar jpUChars[]={
+        0x4e9c, 0x3042, 0x3044, 0xfffd, 0x5516, 0x61, 0x62, 0x63, 0x0d, 0x0a, 0x3042
+    };
+    static const int32_t jpToUOffsets[]={ 3, 5, 7, 9, 11, 16, 17, 18, 19, 20, 24 };
+    /* fromUnicode writes the subchar for U+FFFD and only switches charsets when necessary */
+    static const uint8_t jpFromUBytes[]={
+        0x1b, 0x24, 0x42, 0x30, 0x21, 0x24, 0x22, 0x24, 0x24,
+        0x1b, 0x28, 0x42, 0x1a,
+        0x1b, 0x24, 0x42, 0x30, 0x22,
+        0x1b, 0x28, 0x42, 0x61, 0x62, 0x63, 0x0d, 0x0a,
+        0x1b, 0x24, 0x42, 0x24, 0x22, 0x1b, 0x28, 0x42
+    };
+    static const int32_t jpFromUOffsets[]={
+        0, 0, 0, 0, 0, 1, 1, 2, 2,
+        3, 3, 3, 3,
+        4, 4, 4, 4, 4,
+        5, 5, 5, 5, 6, 7, 8, 9,
+        10, 10, 10, 10, 10, 10, 10, 10
+    };
+
+    /* KS C 5601 0x222f is U+00BF */
+    static const uint8_t krBytes[]={
+        0x1b, 0x24, 0x29, 0x43, 0x61, 0x62,
+        0x0e, 0x30, 0x21, 0x30, 0x22, 0x22, 0x2f, 0x30, 0x21, 0x0f,
+        0x20, 0x63, 0x64, 0x0e, 0x30, 0x23, 0x0f
+    };
+    static const UChar krUChars[]={
+        0x61, 0x62, 0xac00, 0xac01, 0xbf, 0xac00, 0x20, 0x63, 0x64, 0xac04
+    };
+    static const int32_t krToUOffsets[]={ 4, 5, 7, 9, 11, 13, 16, 17, 18, 20 };
+
+    /* GB 2312 row 10 is unassigned */
+    static const uint8_t cnBytes[]={
+        0x61, 0x62, 0x1b, 0x24, 0x29, 0x41,
+        0x0e, 0x30, 0x21, 0x30, 0x22, 0x2a, 0x21, 0x30, 0x23, 0x0f,
+        0x20, 0x63, 0x64, 0x0d, 0x0a
+    };
+    static const UChar cnUChars[]={
+        0x61, 0x62, 0x554a, 0x963f, 0xfffd, 0x57c3, 0x20, 0x63, 0x64, 0x0d, 0x0a
+    };
+    static const int32_t cnToUOffsets[]={ 0, 1, 7, 9, 11, 13, 16, 17, 18, 19, 20 };
+
+    /* the HZ table maps GB 2312 row 10 to the PUA */
+    static const uint8_t hzBytes[]={
+        0x61, 0x62, 0x7e, 0x7b, 0x30, 0x21, 0x30, 0x22, 0x2a, 0x21, 0x30, 0x23, 0x7e, 0x7d,
+        0x20, 0x63, 0x64, 0x7e, 0x7e, 0x65
+    };
+    static const UChar hzUChars[]={
+        0x61, 0x62, 0x554a, 0x963f, 0xe000, 0x57c3, 0x20, 0x63, 0x64, 0x7e, 0x65
+    };
+    static const int32_t hzToUOffsets[]={ 0, 1, 4, 6, 8, 10, 14, 15, 16, 17, 19 };
+
+    /* {input buffer size, output buffer size} */
+    static const int32_t bufferSizes[][2]={
+        { NEW_MAX_BUFFER, NEW_MAX_BUFFER },
+        { 1, NEW_MAX_BUFFER },
+        { 3, NEW_MAX_BUFFER },
+        { NEW_MAX_BUFFER, 1 },
+        { NEW_MAX_BUFFER, 3 },
+        { 2, 3 }
+    };
+    int32_t i;
+
+    for(i=0; i<UPRV_LENGTHOF(bufferSizes); ++i) {
+        gInBufferSize=bufferSizes[i][0];
+        gOutBufferSize=bufferSizes[i][1];
+
+        testConvertToU(jpBytes, sizeof(jpBytes), jpUChars, UPRV_LENGTHOF(jpUChars),
+                       "ISO-2022-JP", jpToUOffsets, FALSE);
+        testConvertFromU(jpUChars, UPRV_LENGTHOF(jpUChars), jpFromUBytes, sizeof(jpFromUBytes),
+                         "ISO-2022-JP", jpFromUOffsets, FALSE);
+        testConvertToU(krBytes, sizeof(krBytes), krUChars, UPRV_LENGTHOF(krUChars),
+                       "ISO-2022-KR", krToUOffsets, FALSE);
+        testConvertToU(cnBytes, sizeof(cnBytes), cnUChars, UPRV_LENGTHOF(cnUChars),
+                       "ISO-2022-CN", cnToUOffsets, FALSE);
+        testConvertToU(hzBytes, sizeof(hzBytes), hzUChars, UPRV_LENGTHOF(hzUChars),
+                       "HZ", hzToUOffsets, FALSE);
+    }
+    gInBufferSize=NEW_MAX_BUFFER;
+    gOutBufferSize=NEW_MAX_BUFFER;
+}
+
 static void
 TestISCII(){
         /* test input */
@@ -4715,7 +4814,13 @@ TestGB18030() {
         0x82, 0x35, 0x8f, 0x33,
         0x84, 0x31, 0xa4, 0x39,
         0x90, 0x30, 0x81, 0x30,
-        0xe3, 0x32, 0x9a, 0x35
+        0xe3, 0x32, 0x9a, 0x35,
+        0x81, 0x30, 0xd3, 0x30,
+        0x81, 0x35, 0xf4, 0x36,
+        0x82, 0x30, 0xa6, 0x33,
+        0x82, 0x34, 0xe7, 0x33,
+        0x84, 0x30, 0x9c, 0x38,
+        0x84, 0x31, 0xa2, 0x34
 #if 0
         /*
          * Feature removed   markus 2000-oct-26
@@ -4740,7 +4845,13 @@ TestGB18030() {
         4, 0x9fa6,
         4, 0xffff,
         4, 0x10000,
-        4, 0x10ffff
+        4, 0x10ffff,
+        4, 0x452,
+        4, 0x1e3e,
+        4, 0x361b,
+        4, 0x4c76,
+        4, 0xfa2a,
+        4, 0xffe6
 #if 0
         /* Feature removed. See comment above. */
         8, 0x10000
@@ -5611,3 +5722,104 @@ TestIsFixedWidth() {
         ucnv_close(cnv);
     }
 }
+
+/*
+ * Long ASCII runs are copied in blocks by the MBCS converters.
+ * Compare bulk conversion with offsets against converting one code unit at a time,
+ * with runs that are shorter than, equal to and longer than one block.
+ */
+static void
+TestASCIIRuns() {
+    static const struct {
+        const char *name;
+        UChar nonASCII;
+    } cases[] = {
+        { "windows-1252", 0xe9 },
+        { "ibm-943_P15A-2003", 0x4e00 },
+        { "EUC-JP", 0x4e00 },
+        { "windows-949-2000", 0xac00 },
+        { "GB18030", 0x4e00 }
+    };
+    static const int32_t runLengths[] = { 40, 16, 3, 17, 1, 33 };
+
+    UChar unicode[200], uBack[200];
+    char bytes[600], expBytes[600];
+    int32_t offsets[600], expOffsets[600], uOffsets[200];
+    int32_t i, j, uLength, length, expLength;
+
+    for (i = 0; i < UPRV_LENGTHOF(cases); i++) {
+        UErrorCode errorCode = U_ZERO_ERROR;
+        UConverter *cnv = ucnv_open(cases[i].name, &errorCode);
+        const UChar *uSource;
+        char *target;
+        const char *source;
+        UChar *uTarget;
+
+        if (U_FAILURE(errorCode)) {
+            log_data_err("Error opening converter %s - %s\n", cases[i].name, u_errorName(errorCode));
+            continue;
+        }
+
+        uLength = 0;
+        for (j = 0; j < UPRV_LENGTHOF(runLengths); j++) {
+            int32_t k;
+            for (k = 0; k < runLengths[j]; k++) {
+                unicode[uLength] = (UChar)(0x21 + (uLength % 0x5e));
+                ++uLength;
+            }
+            unicode[uLength++] = cases[i].nonASCII;
+        }
+
+        /* expected bytes and offsets, one code unit at a time */
+        expLength = 0;
+        for (j = 0; j < uLength; j++) {
+            length = ucnv_fromUChars(cnv, expBytes + expLength, UPRV_LENGTHOF(expBytes) - expLength,
+                                     unicode + j, 1, &errorCode);
+            while (length-- > 0) {
+                expOffsets[expLength++] = j;
+            }
+        }
+        if (U_FAILURE(errorCode)) {
+            log_err("%s: ucnv_fromUChars() failed - %s\n", cases[i].name, u_errorName(errorCode));
+            ucnv_close(cnv);
+            continue;
+        }
+
+        ucnv_reset(cnv);
+        uSource = unicode;
+        target = bytes;
+        ucnv_fromUnicode(cnv, &target, bytes + UPRV_LENGTHOF(bytes), &uSource, unicode + uLength,
+                         offsets, TRUE, &errorCode);
+        length = (int32_t)(target - bytes);
+        if (U_FAILURE(errorCode) || length != expLength ||
+                uprv_memcmp(bytes, expBytes, length) != 0 ||
+                uprv_memcmp(offsets, expOffsets, length * 4) != 0) {
+            log_err("%s: ucnv_fromUnicode() of ASCII runs gives wrong bytes or offsets - %s\n",
+                    cases[i].name, u_errorName(errorCode));
+        }
+
+        ucnv_reset(cnv);
+        source = expBytes;
+        uTarget = uBack;
+        ucnv_toUnicode(cnv, &uTarget, uBack + UPRV_LENGTHOF(uBack), &source, expBytes + expLength,
+                       uOffsets, TRUE, &errorCode);
+        length = (int32_t)(uTarget - uBack);
+        if (U_FAILURE(errorCode) || length != uLength || u_memcmp(uBack, unicode, length) != 0) {
+            log_err("%s: ucnv_toUnicode() of ASCII runs does not round-trip - %s\n",
+                    cases[i].name, u_errorName(errorCode));
+        } else {
+            int32_t byteIndex = 0;
+            for (j = 0; j < uLength; j++) {
+                if (uOffsets[j] != byteIndex) {
+                    log_err("%s: ucnv_toUnicode() offsets[%d]=%d != %d\n",
+                            cases[i].name, j, uOffsets[j], byteIndex);
+                    break;
+                }
+                while (byteIndex < expLength && expOffsets[byteIndex] == j) {
+                    ++byteIndex;
+                }
+            }
+        }
+        ucnv_close(cnv);
+    }
+}
@@ -1541,6 +1541,17 @@ static void TestUTextAPI(void) {
         TEST_ASSERT_SUCCESS(status);
         TEST_ASSERT_UTEXT(str_hel, resultText);
 
+        /* A clone shares the compiled pattern, but not the pattern UText. */
+        {
+            URegularExpression *clone = uregex_clone(re, &status);
+            UText *cloneText = uregex_patternUText(clone, &status);
+            TEST_ASSERT_SUCCESS(status);
+            TEST_ASSERT(cloneText != resultText);
+            TEST_ASSERT_UTEXT(str_hel, cloneText);
+            TEST_ASSERT(uregex_patternUText(re, &status) == resultText);
+            uregex_close(clone);
+        }
+
         uregex_close(re);
     }
 
@@ -469,6 +469,19 @@ static void TestSelector()
         /* UTF-8 NUL-terminated */
         verifyResult(ucnvsel_selectForUTF8(sel_rt, s, -1, &status), manual_rt);
         verifyResult(ucnvsel_selectForUTF8(sel_fb, s, -1, &status), manual_fb);
+        /* UTF-8 batch: the same string plus an empty one gives the same result */
+        {
+          const char *strings8[3];
+          int32_t lengths8[3];
+          strings8[0] = s;
+          strings8[1] = "";
+          strings8[2] = s;
+          lengths8[0] = length8;
+          lengths8[1] = 0;
+          lengths8[2] = -1;
+          verifyResult(ucnvsel_selectForUTF8Strings(sel_rt, strings8, lengths8, 3, &status), manual_rt);
+          verifyResult(ucnvsel_selectForUTF8Strings(sel_fb, strings8, NULL, 3, &status), manual_fb);
+        }
 
         u_strFromUTF8(utf16, UPRV_LENGTHOF(utf16), &length16, s, length8, &status);
         if (U_FAILURE(status)) {
@@ -485,6 +498,20 @@ static void TestSelector()
             /* UTF-16 NUL-terminated */
             verifyResult(ucnvsel_selectForString(sel_rt, utf16, -1, &status), manual_rt);
             verifyResult(ucnvsel_selectForString(sel_fb, utf16, -1, &status), manual_fb);
+            /* UTF-16 batch */
+            {
+              static const UChar empty[] = { 0 };
+              const UChar *strings16[3];
+              int32_t lengths16[3];
+              strings16[0] = empty;
+              strings16[1] = utf16;
+              strings16[2] = utf16;
+              lengths16[0] = -1;
+              lengths16[1] = length16;
+              lengths16[2] = -1;
+              verifyResult(ucnvsel_selectForStrings(sel_rt, strings16, lengths16, 3, &status), manual_rt);
+              verifyResult(ucnvsel_selectForStrings(sel_fb, strings16, NULL, 3, &status), manual_fb);
+            }
           }
         }
 
@@ -68,6 +68,7 @@ void AlphabeticIndexTest::runIndexedTest( int32_t index, UBool exec, const char*
     TESTCASE_AUTO(TestJapaneseKanji);
     TESTCASE_AUTO(TestChineseUnihan);
     TESTCASE_AUTO(testHasBuckets);
+    TESTCASE_AUTO(TestGetBucketIndices);
     TESTCASE_AUTO_END;
 }
 
@@ -749,4 +750,58 @@ void AlphabeticIndexTest::checkHasBuckets(const Locale &locale, UScriptCode scri
             uscript_getScript(bucket->getLabel().char32At(0), errorCode));
 }
 
+void AlphabeticIndexTest::TestGetBucketIndices() {
+    static const char *const names[] = {
+        "", " ", "123", "-", "Adelbert", "\\u00C6sculap", "Aesthet", "Berlin",
+        "Sacher", "Schiller", "schiller", "Sch", "Sc", "Steiff", "St", "Sultan", "Thomas",
+        "Zyx", "\\u00DCbel", "\\u03B1\\u03B2", "\\u4E5D", "\\U00050005", "\\uFFFF"
+    };
+    const int32_t length = UPRV_LENGTHOF(names);
+    UnicodeString strings[length];
+    for (int32_t i = 0; i < length; ++i) {
+        strings[i] = UnicodeString(names[i], -1, US_INV).unescape();
+    }
+    static const char *const locales[] = { "de", "zh@collation=pinyin" };
+    for (int32_t j = 0; j < UPRV_LENGTHOF(locales); ++j) {
+        IcuTestErrorCode errorCode(*this, locales[j]);
+        AlphabeticIndex index(locales[j], errorCode);
+        if (j == 0) {
+            // Labels with multiple primary weights.
+            index.addLabels(UnicodeSet(u"[\\u00C6{Sch*}{St*}]", errorCode), errorCode);
+        }
+        LocalPointer<AlphabeticIndex::ImmutableIndex> immIndex(index.buildImmutableIndex(errorCode));
+        if (errorCode.errDataIfFailureAndReset("AlphabeticIndex(%s)", locales[j])) {
+            continue;
+        }
+        int32_t indices[length];
+        int32_t immIndices[length];
+        index.getBucketIndices(strings, length, indices, errorCode);
+        immIndex->getBucketIndices(strings, length, immIndices, errorCode);
+        for (int32_t i = 0; i < length; ++i) {
+            UnicodeString msg = UnicodeString("bucket index of \"") + strings[i] + "\"";
+            assertEquals(msg, index.getBucketIndex(strings[i], errorCode), indices[i]);
+            assertEquals(UnicodeString("immutable ") + msg, indices[i], immIndices[i]);
+            // The record data is the record's position in the strings array.
+            index.addRecord(strings[i], strings + i, errorCode);
+        }
+        // The records are sorted into buckets by comparing them with the bucket boundaries,
+        // which must agree with the bucket indexes.
+        index.resetBucketIterator(errorCode);
+        while (index.nextBucket(errorCode)) {
+            while (index.nextRecord(errorCode)) {
+                int32_t i = static_cast<int32_t>(
+                    static_cast<const UnicodeString *>(index.getRecordData()) - strings);
+                assertEquals(UnicodeString("record bucket of \"") + strings[i] + "\"",
+                             indices[i], index.getBucketIndex());
+            }
+        }
+
+        // Illegal arguments.
+        index.getBucketIndices(strings, -1, indices, errorCode);
+        assertEquals("negative length", U_ILLEGAL_ARGUMENT_ERROR, errorCode.reset());
+        immIndex->getBucketIndices(NULL, 1, indices, errorCode);
+        assertEquals("NULL names", U_ILLEGAL_ARGUMENT_ERROR, errorCode.reset());
+    }
+}
+
 #endif
@@ -53,6 +53,10 @@ public:
 
     void testHasBuckets();
     void checkHasBuckets(const Locale &locale, UScriptCode script);
+    /**
+     * Test bulk bucketing against the buckets of added records.
+     */
+    void TestGetBucketIndices();
 };
 
 #endif
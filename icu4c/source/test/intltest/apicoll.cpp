@@ -47,6 +47,7 @@
 
 #include "sfwdchit.h"
 #include "cmemory.h"
+#include "cstring.h"
 #include <stdlib.h>
 
 void
@@ -2517,6 +2518,132 @@ void CollationAPITest::TestGapTooSmall() {
     }
 }
 
+void CollationAPITest::TestCachedInstances() {
+    // Collators for the same locale ID are cloned from a cached prototype.
+    // Each instance must still be independent, have the keyword settings applied,
+    // and report the same status as the first one.
+    IcuTestErrorCode errorCode(*this, "TestCachedInstances");
+    const char *localeID = "de-u-ks-level2-kn";
+    LocalPointer<Collator> coll1(Collator::createInstance(localeID, errorCode));
+    if(errorCode.errDataIfFailureAndReset("Collator::createInstance(%s)", localeID)) {
+        return;
+    }
+    LocalPointer<Collator> coll2(Collator::createInstance(localeID, errorCode));
+    errorCode.errIfFailureAndReset("Collator::createInstance(%s) again", localeID);
+    assertTrue("same collator twice", *coll1 == *coll2);
+    assertEquals("strength from keyword", UCOL_SECONDARY, coll2->getStrength());
+    assertEquals("numeric from keyword", UCOL_ON,
+                 coll2->getAttribute(UCOL_NUMERIC_COLLATION, errorCode));
+    assertEquals("2 < 10", UCOL_LESS, coll2->compare(u"2", u"10", errorCode));
+
+    coll1->setStrength(Collator::TERTIARY);
+    coll1->setAttribute(UCOL_NUMERIC_COLLATION, UCOL_OFF, errorCode);
+    LocalPointer<Collator> coll3(Collator::createInstance(localeID, errorCode));
+    errorCode.errIfFailureAndReset("Collator::createInstance(%s) third time", localeID);
+    assertTrue("changed collator differs", *coll1 != *coll3);
+    assertTrue("unchanged collators equal", *coll2 == *coll3);
+    assertEquals("cached strength unchanged", UCOL_SECONDARY, coll3->getStrength());
+    assertEquals("cached numeric unchanged", UCOL_ON,
+                 coll3->getAttribute(UCOL_NUMERIC_COLLATION, errorCode));
+
+    // A fallback warning is reported for every instance, not just the first.
+    localeID = "xx-YY-u-ks-level1";
+    for(int32_t i = 0; i < 2; ++i) {
+        UErrorCode status = U_ZERO_ERROR;
+        LocalPointer<Collator> coll(Collator::createInstance(localeID, status));
+        if(U_FAILURE(status)) {
+            errln("Collator::createInstance(%s) failed - %s", localeID, u_errorName(status));
+        } else if(status != U_USING_DEFAULT_WARNING) {
+            errln("Collator::createInstance(%s) #%d did not warn - %s",
+                  localeID, (int)i, u_errorName(status));
+        } else if(coll->getStrength() != Collator::PRIMARY) {
+            errln("Collator::createInstance(%s) #%d wrong strength", localeID, (int)i);
+        }
+    }
+
+    // Errors are reported every time as well.
+    localeID = "it-u-ks-xyz";
+    for(int32_t i = 0; i < 2; ++i) {
+        UErrorCode status = U_ZERO_ERROR;
+        LocalPointer<Collator> coll(Collator::createInstance(localeID, status));
+        if(status != U_ILLEGAL_ARGUMENT_ERROR || coll.isValid()) {
+            errln("Collator::createInstance(%s) #%d did not fail as expected - %s",
+                  localeID, (int)i, u_errorName(status));
+        }
+    }
+}
+
+void CollationAPITest::TestCompactSortKey() {
+    IcuTestErrorCode errorCode(*this, "TestCompactSortKey");
+    LocalPointer<Collator> coll(Collator::createInstance("en", errorCode));
+    if(errorCode.errDataIfFailureAndReset("Collator::createInstance(en)")) {
+        return;
+    }
+    RuleBasedCollator *rbc = dynamic_cast<RuleBasedCollator *>(coll.getAlias());
+    if(rbc == NULL) {
+        errln("the en collator is not a RuleBasedCollator");
+        return;
+    }
+    // Strings in primary order; the long ones have long lower levels.
+    static const char16_t *const primaryOrder[] = {
+        u"a", u"ab", u"abc", u"Abcdefghijk", u"ábcdefghijkl", u"b", u"Zurich", u"zürichsee"
+    };
+    uint8_t key[100], prevKey[100];
+    int32_t prevLength = 0;
+    for(int32_t i = 0; i < UPRV_LENGTHOF(primaryOrder); ++i) {
+        UnicodeString s(primaryOrder[i]);
+        int32_t length = rbc->getCompactSortKey(s, key, UPRV_LENGTHOF(key));
+        int32_t fullLength = rbc->getSortKey(s, NULL, 0);
+        if(length <= 0 || length > UPRV_LENGTHOF(key) || key[length - 1] != 0) {
+            errln("compact sort key #%d has bad length %d", (int)i, (int)length);
+            return;
+        }
+        if(length > fullLength) {
+            errln("compact sort key #%d is longer than the full sort key", (int)i);
+        }
+        if(i > 0 && uprv_strcmp((const char *)prevKey, (const char *)key) >= 0) {
+            errln("compact sort key #%d does not sort after the previous one", (int)i);
+        }
+        // Preflighting and the C API return the same length.
+        assertEquals("preflighting", length, rbc->getCompactSortKey(s, NULL, 0));
+        uint8_t cKey[100];
+        int32_t cLength = ucol_getCompactSortKey(rbc->toUCollator(), primaryOrder[i], -1,
+                                                 cKey, UPRV_LENGTHOF(cKey));
+        if(cLength != length || uprv_memcmp(key, cKey, length) != 0) {
+            errln("ucol_getCompactSortKey() differs from getCompactSortKey() for #%d", (int)i);
+        }
+        uprv_memcpy(prevKey, key, length);
+        prevLength = length;
+    }
+    assertTrue("long strings have a fixed-size hash", prevLength < rbc->getSortKey(
+            UnicodeString(primaryOrder[UPRV_LENGTHOF(primaryOrder) - 1]), NULL, 0));
+
+    // Case variants are primary-equal but still get different keys;
+    // equal strings get equal keys.
+    uint8_t key1[100], key2[100];
+    UnicodeString s1(u"Abcdefghijk"), s2(u"abcdefghijk");
+    int32_t length1 = rbc->getCompactSortKey(s1, key1, UPRV_LENGTHOF(key1));
+    int32_t length2 = rbc->getCompactSortKey(s2, key2, UPRV_LENGTHOF(key2));
+    assertTrue("case variants differ",
+               length1 != length2 || uprv_memcmp(key1, key2, length1) != 0);
+    length2 = rbc->getCompactSortKey(UnicodeString(s1), key2, UPRV_LENGTHOF(key2));
+    assertTrue("equal strings have equal keys",
+               length1 == length2 && uprv_memcmp(key1, key2, length1) == 0);
+
+    // With primary strength, case variants are equal and the key has no hash.
+    rbc->setStrength(Collator::PRIMARY);
+    length1 = rbc->getCompactSortKey(s1, key1, UPRV_LENGTHOF(key1));
+    length2 = rbc->getCompactSortKey(s2, key2, UPRV_LENGTHOF(key2));
+    assertTrue("primary-equal strings",
+               length1 == length2 && uprv_memcmp(key1, key2, length1) == 0);
+    assertEquals("primary strength key is the sort key", rbc->getSortKey(s1, NULL, 0), length1);
+
+    // A too-small buffer is filled to capacity.
+    length1 = rbc->getCompactSortKey(s1, key1, 3);
+    assertTrue("overflow returns the needed length", length1 > 3);
+    assertTrue("overflow fills the buffer", uprv_memcmp(key1, key2, 3) == 0);
+}
+
  void CollationAPITest::dump(UnicodeString msg, RuleBasedCollator* c, UErrorCode& status) {
     const char* bigone = "One";
     const char* littleone = "one";
@@ -2560,6 +2687,8 @@ void CollationAPITest::runIndexedTest( int32_t index, UBool exec, const char* &n
     TESTCASE_AUTO(TestIterNumeric);
     TESTCASE_AUTO(TestBadKeywords);
     TESTCASE_AUTO(TestGapTooSmall);
+    TESTCASE_AUTO(TestCachedInstances);
+    TESTCASE_AUTO(TestCompactSortKey);
     TESTCASE_AUTO_END;
 }
 
@@ -174,6 +174,8 @@ public:
     void TestIterNumeric();
     void TestBadKeywords();
     void TestGapTooSmall();
+    void TestCachedInstances();
+    void TestCompactSortKey();
 
 private:
     // If this is too small for the test data, just increase it.
@@ -15,6 +15,7 @@
 */
 
 #include <string.h>
+#include <string>
 
 #include "unicode/utypes.h"
 #include "unicode/bytestrie.h"
@@ -45,6 +46,7 @@ public:
     void TestLongBranch();
     void TestValuesForState();
     void TestCompact();
+    void TestSortedInput();
 
     BytesTrie *buildMonthsTrie(UStringTrieBuildOption buildOption);
     void TestHasUniqueValue();
@@ -100,6 +102,7 @@ void BytesTrieTest::runIndexedTest(int32_t index, UBool exec, const char *&name,
     TESTCASE_AUTO(TestLongBranch);
     TESTCASE_AUTO(TestValuesForState);
     TESTCASE_AUTO(TestCompact);
+    TESTCASE_AUTO(TestSortedInput);
     TESTCASE_AUTO(TestHasUniqueValue);
     TESTCASE_AUTO(TestGetNextBytes);
     TESTCASE_AUTO(TestIteratorFromBranch);
@@ -266,6 +269,75 @@ void BytesTrieTest::TestCompact() {
     checkData(data, UPRV_LENGTHOF(data));
 }
 
+// The builder skips sorting when the strings are added in order.
+// The serialized trie must not depend on the input order,
+// and duplicates must be detected either way.
+void BytesTrieTest::TestSortedInput() {
+    IcuTestErrorCode errorCode(*this, "TestSortedInput()");
+    // Three-letter strings in ascending order, with some two-letter prefixes before them.
+    static const int32_t count=2000;
+    char strings[count+count/26+1][4];
+    int32_t values[count+count/26+1];
+    int32_t length=0;
+    for(int32_t i=0; i<count; ++i) {
+        char c0=(char)('a'+i/676);
+        char c1=(char)('a'+(i/26)%26);
+        char c2=(char)('a'+i%26);
+        char *s;
+        if((i%26)==0 && (i%52)!=0) {
+            // A two-letter prefix sorts before its extensions.
+            s=strings[length];
+            s[0]=c0;
+            s[1]=c1;
+            s[2]=0;
+            values[length++]=-i;
+        }
+        s=strings[length];
+        s[0]=c0;
+        s[1]=c1;
+        s[2]=c2;
+        s[3]=0;
+        values[length++]=i;
+    }
+    for(int32_t option=0; option<2; ++option) {
+        UStringTrieBuildOption buildOption=
+            option==0 ? USTRINGTRIE_BUILD_FAST : USTRINGTRIE_BUILD_SMALL;
+        std::string sortedResult, reverseResult;
+        for(int32_t reverse=0; reverse<2; ++reverse) {
+            builder_->clear();
+            for(int32_t j=0; j<length; ++j) {
+                int32_t k=reverse ? length-1-j : j;
+                const char *s=strings[k];
+                int32_t value=values[k];
+                builder_->add(s, value, errorCode);
+            }
+            StringPiece result=builder_->buildStringPiece(buildOption, errorCode);
+            if(errorCode.errIfFailureAndReset("build(%s)", reverse ? "reverse" : "sorted")) {
+                return;
+            }
+            (reverse ? reverseResult : sortedResult)=std::string(result.data(), result.length());
+        }
+        if(sortedResult!=reverseResult) {
+            errln("sorted and reverse-sorted input yield different tries for build option %d",
+                  (int)buildOption);
+        }
+    }
+    // Duplicates in otherwise sorted input.
+    builder_->clear();
+    builder_->add("a", 1, errorCode).add("b", 2, errorCode).add("b", 3, errorCode).add("c", 4, errorCode);
+    delete builder_->build(USTRINGTRIE_BUILD_FAST, errorCode);
+    if(errorCode.reset()!=U_ILLEGAL_ARGUMENT_ERROR) {
+        errln("BytesTrieBuilder did not detect duplicates in sorted input");
+    }
+    // Duplicates that are adjacent only after sorting.
+    builder_->clear();
+    builder_->add("b", 1, errorCode).add("a", 2, errorCode).add("c", 3, errorCode).add("b", 4, errorCode);
+    delete builder_->build(USTRINGTRIE_BUILD_FAST, errorCode);
+    if(errorCode.reset()!=U_ILLEGAL_ARGUMENT_ERROR) {
+        errln("BytesTrieBuilder did not detect duplicates in unsorted input");
+    }
+}
+
 BytesTrie *BytesTrieTest::buildMonthsTrie(UStringTrieBuildOption buildOption) {
     // All types of nodes leading to the same value,
     // for code coverage of recursive functions.
@@ -40,6 +40,9 @@
 #include "unicode/utf16.h"
 #include "convtest.h"
 #include "cmemory.h"
+#include "ucnv_bld.h"
+#include "ucnv_ext.h"
+#include "ucnvmbcs.h"
 #include "unicode/tstdtmod.h"
 #include <string.h>
 #include <stdlib.h>
@@ -77,6 +80,7 @@ ConversionTest::runIndexedTest(int32_t index, UBool exec, const char *&name, cha
     TESTCASE_AUTO(TestGetUnicodeSet2);
     TESTCASE_AUTO(TestDefaultIgnorableCallback);
     TESTCASE_AUTO(TestUTF8ToUTF8Overflow);
+    TESTCASE_AUTO(TestExtToUIndex);
     TESTCASE_AUTO_END;
 }
 
@@ -839,6 +843,115 @@ ConversionTest::TestUTF8ToUTF8Overflow() {
     }
 }
 
+// Check the two-byte extension toUnicode mappings, which are looked up in a hash index
+// (UConverterMBCSTable.extToUIndex), against the nested byte sections of the toUTable.
+// Two-byte sequences that are prefixes of longer mappings are not in the index;
+// for them, check the longer mappings, which must still be found.
+void
+ConversionTest::TestExtToUIndex() {
+    static const char *const cnvNames[]={
+        "ibm-1390",     // EBCDIC_STATEFUL, DBCS extension mappings
+        "ibm-943",      // SBCS/DBCS
+        "ibm-33722",    // EUC-JP: 8F A2 is a prefix of three-byte mappings
+        "*test3"        // 01 02 is a prefix of three-byte mappings
+    };
+    for(int32_t n=0; n<UPRV_LENGTHOF(cnvNames); ++n) {
+        UErrorCode errorCode=U_ZERO_ERROR;
+        LocalUConverterPointer cnv(cnv_open(cnvNames[n], errorCode));
+        if(U_FAILURE(errorCode)) {
+            errcheckln(errorCode, "failed to open converter %s - %s", cnvNames[n], u_errorName(errorCode));
+            continue;
+        }
+        const UConverterMBCSTable &mbcs=cnv->sharedData->mbcs;
+        const int32_t *cx=mbcs.extIndexes;
+        if(cx==NULL || mbcs.extToUIndex==NULL) {
+            errln("converter %s has no toUnicode extension index", cnvNames[n]);
+            continue;
+        }
+        const uint32_t *toUTable=UCNV_EXT_ARRAY(cx, UCNV_EXT_TO_U_INDEX, uint32_t);
+        int32_t indexed=0, longer=0;
+        int32_t length=(int32_t)UCNV_EXT_TO_U_GET_BYTE(toUTable[0]);
+        for(int32_t i=1; i<=length; ++i) {
+            uint32_t value=UCNV_EXT_TO_U_GET_VALUE(toUTable[i]);
+            if(value==0 || !UCNV_EXT_TO_U_IS_PARTIAL(value)) {
+                continue;
+            }
+            uint8_t bytes[3]={ (uint8_t)UCNV_EXT_TO_U_GET_BYTE(toUTable[i]), 0, 0 };
+            const uint32_t *section=toUTable+UCNV_EXT_TO_U_GET_PARTIAL_INDEX(value);
+            int32_t sectionLength=(int32_t)UCNV_EXT_TO_U_GET_BYTE(section[0]);
+            for(int32_t j=1; j<=sectionLength; ++j) {
+                value=UCNV_EXT_TO_U_GET_VALUE(section[j]);
+                bytes[1]=(uint8_t)UCNV_EXT_TO_U_GET_BYTE(section[j]);
+                if(value==0) {
+                    continue;
+                } else if(!UCNV_EXT_TO_U_IS_PARTIAL(value)) {
+                    indexed+=checkExtToU(cnv.getAlias(), cnvNames[n], cx, bytes, 2, value);
+                    continue;
+                }
+                // A prefix: Check the three-byte mappings that continue it.
+                const uint32_t *section3=toUTable+UCNV_EXT_TO_U_GET_PARTIAL_INDEX(value);
+                int32_t section3Length=(int32_t)UCNV_EXT_TO_U_GET_BYTE(section3[0]);
+                for(int32_t k=1; k<=section3Length; ++k) {
+                    value=UCNV_EXT_TO_U_GET_VALUE(section3[k]);
+                    if(value!=0 && !UCNV_EXT_TO_U_IS_PARTIAL(value)) {
+                        bytes[2]=(uint8_t)UCNV_EXT_TO_U_GET_BYTE(section3[k]);
+                        longer+=checkExtToU(cnv.getAlias(), cnvNames[n], cx, bytes, 3, value);
+                    }
+                }
+            }
+        }
+        logln("%s: %d two-byte and %d three-byte extension mappings checked",
+              cnvNames[n], (int)indexed, (int)longer);
+        if(indexed==0) {
+            errln("%s: no two-byte extension mappings found", cnvNames[n]);
+        }
+    }
+}
+
+// Convert the bytes of one extension mapping, and compare with its mapping value
+// from the toUTable. Returns 1 if they match.
+int32_t
+ConversionTest::checkExtToU(UConverter *cnv, const char *name, const int32_t *cx,
+                            const uint8_t *bytes, int32_t length, uint32_t value) {
+    UnicodeString expected;
+    value=UCNV_EXT_TO_U_MASK_ROUNDTRIP(value);
+    if(UCNV_EXT_TO_U_IS_CODE_POINT(value)) {
+        expected.append((UChar32)UCNV_EXT_TO_U_GET_CODE_POINT(value));
+    } else {
+        expected.append(UCNV_EXT_ARRAY(cx, UCNV_EXT_TO_U_UCHARS_INDEX, UChar)+UCNV_EXT_TO_U_GET_INDEX(value),
+                        UCNV_EXT_TO_U_GET_LENGTH(value));
+    }
+
+    // Double-byte characters of an SI/SO-stateful converter are enclosed in SO/SI.
+    char input[8];
+    int32_t inputLength=0;
+    UBool isSISO=(UBool)(ucnv_getType(cnv)==UCNV_EBCDIC_STATEFUL);
+    if(isSISO) {
+        input[inputLength++]=0xe;
+    }
+    for(int32_t i=0; i<length; ++i) {
+        input[inputLength++]=(char)bytes[i];
+    }
+    if(isSISO) {
+        input[inputLength++]=0xf;
+    }
+
+    UChar result[32];
+    UErrorCode errorCode=U_ZERO_ERROR;
+    ucnv_reset(cnv);
+    int32_t resultLength=ucnv_toUChars(cnv, result, UPRV_LENGTHOF(result), input, inputLength, &errorCode);
+    if(U_FAILURE(errorCode) || expected!=UnicodeString(FALSE, result, resultLength)) {
+        char hex[3*8+1];
+        for(int32_t i=0; i<length; ++i) {
+            sprintf(hex+3*i, " %02x", bytes[i]);
+        }
+        errln("%s: toUnicode(%s) = %s and length %d, differs from the extension mapping",
+              name, hex, u_errorName(errorCode), (int)resultLength);
+        return 0;
+    }
+    return 1;
+}
+
 // open testdata or ICU data converter ------------------------------------- ***
 
 UConverter *
@@ -77,6 +77,7 @@ public:
     void TestGetUnicodeSet2();
     void TestDefaultIgnorableCallback();
     void TestUTF8ToUTF8Overflow();
+    void TestExtToUIndex();
 
 private:
     UBool
@@ -100,6 +101,10 @@ private:
     UConverter *
     cnv_open(const char *name, UErrorCode &errorCode);
 
+    int32_t
+    checkExtToU(UConverter *cnv, const char *name, const int32_t *cx,
+                const uint8_t *bytes, int32_t length, uint32_t value);
+
     /* for testing direct UTF-8 conversion */
     UConverter *utf8Cnv;
 };
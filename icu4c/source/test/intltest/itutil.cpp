@@ -43,6 +43,7 @@ extern IntlTest *createPluralMapTest();
 #if !UCONFIG_NO_FORMATTING
 extern IntlTest *createStaticUnicodeSetsTest();
 #endif
+extern IntlTest *createStringTrieMapTest();
 
 
 #define CASE(id, test) case id:                               \
@@ -148,6 +149,14 @@ void IntlTestUtilities::runIndexedTest( int32_t index, UBool exec, const char* &
             }
 #endif
             break;
+        case 25:
+            name = "StringTrieMapTest";
+            if (exec) {
+                logln("TestSuite StringTrieMapTest---"); logln();
+                LocalPointer<IntlTest> test(createStringTrieMapTest());
+                callTest(*test, par);
+            }
+            break;
         default: name = ""; break; //needed to end loop
     }
 }
@@ -1402,6 +1402,102 @@ void RBBIAPITest::TestFilteredBreakIteratorBuilder() {
 #endif
 }
 
+// Check that iterating with next() and getBoundaries() both find the expected boundaries.
+static void checkGetBoundaries(IntlTest &test, BreakIterator *bi,
+                               const int32_t expected[], int32_t expectedCount, const char *name) {
+    UErrorCode status = U_ZERO_ERROR;
+    int32_t i = 0;
+    for (int32_t n = bi->first(); n != UBRK_DONE; n = bi->next(), ++i) {
+        if (i >= expectedCount || n != expected[i]) {
+            test.errln("%s next() boundary %d = %d, expected %d",
+                       name, (int)i, (int)n, i < expectedCount ? (int)expected[i] : -1);
+            return;
+        }
+    }
+    if (i != expectedCount) {
+        test.errln("%s next() found %d boundaries, expected %d", name, (int)i, (int)expectedCount);
+        return;
+    }
+    int32_t actual[100];
+    int32_t count = bi->getBoundaries(actual, UPRV_LENGTHOF(actual), status);
+    if (U_FAILURE(status) || count != expectedCount) {
+        test.errln("%s getBoundaries() = %d (%s), expected %d",
+                   name, (int)count, u_errorName(status), (int)expectedCount);
+        return;
+    }
+    for (i = 0; i < count; ++i) {
+        if (actual[i] != expected[i]) {
+            test.errln("%s getBoundaries()[%d] = %d, expected %d",
+                       name, (int)i, (int)actual[i], (int)expected[i]);
+            return;
+        }
+    }
+    // Preflighting and truncation.
+    status = U_ZERO_ERROR;
+    if (bi->getBoundaries(NULL, 0, status) != count || status != U_BUFFER_OVERFLOW_ERROR) {
+        test.errln("%s getBoundaries(NULL, 0) preflighting failed - %s", name, u_errorName(status));
+    }
+    status = U_ZERO_ERROR;
+    actual[2] = -1;
+    if (bi->getBoundaries(actual, 2, status) != count || status != U_BUFFER_OVERFLOW_ERROR ||
+            actual[1] != expected[1] || actual[2] != -1) {
+        test.errln("%s getBoundaries(capacity 2) failed - %s", name, u_errorName(status));
+    }
+}
+
+void RBBIAPITest::TestFilteredGetBoundaries() {
+#if !UCONFIG_NO_BREAK_ITERATION && !UCONFIG_NO_FILTERED_BREAK_ITERATION
+    UErrorCode status = U_ZERO_ERROR;
+    LocalPointer<BreakIterator> bi(BreakIterator::createSentenceInstance(Locale("en@ss=standard"), status));
+    if (U_FAILURE(status)) {
+        dataerrln("Failure creating en@ss=standard sentence break iterator - %s", u_errorName(status));
+        return;
+    }
+    // Exceptions (Mr., Capt., Ph.D.), a partial match (Ph. alone), and non-ASCII text
+    // including a supplementary code point and unpaired surrogates.
+    UnicodeString text(
+        u"Mr. Smith met Capt. Jones. The Ph.D. student left. He is a Ph. "
+        u"Sure. \u00C9t\u00E9 \U0001F600. Mr.  Brown? Yes. #. Mr. # ok. Mr.");
+    text.setCharAt(text.indexOf(u'#'), 0xD800);
+    text.setCharAt(text.indexOf(u'#'), 0xDC00);
+    // Plain "en" also breaks after "Mr." (4) and "Capt." (20), and none of these
+    // suppress a break after "Mr." followed by two spaces (82).
+    static const int32_t expected[] = { 0, 27, 51, 63, 69, 77, 82, 89, 94, 97, 107, 110 };
+    const int32_t expectedCount = UPRV_LENGTHOF(expected);
+    bi->setText(text);
+    checkGetBoundaries(*this, bi.getAlias(), expected, expectedCount, "UnicodeString");
+
+    // UTF-8 text, accessed directly by the filtered iterator.
+    // The boundaries are byte offsets; the unpaired surrogates become U+FFFD.
+    static const int32_t expectedUTF8[] = { 0, 27, 51, 63, 69, 81, 86, 93, 98, 103, 115, 118 };
+    std::string utf8;
+    text.toUTF8String(utf8);
+    status = U_ZERO_ERROR;
+    LocalUTextPointer ut(utext_openUTF8(NULL, utf8.data(), (int64_t)utf8.length(), &status));
+    bi->setText(ut.getAlias(), status);
+    TEST_ASSERT_SUCCESS(status);
+    checkGetBoundaries(*this, bi.getAlias(), expectedUTF8, UPRV_LENGTHOF(expectedUTF8), "UTF-8");
+
+    // Generic UText access, not through a string.
+    bi->adoptText(new StringCharacterIterator(text));
+    checkGetBoundaries(*this, bi.getAlias(), expected, expectedCount, "CharacterIterator");
+
+    // A clone continues with the text.
+    bi->setText(text);
+    LocalPointer<BreakIterator> clone(bi->clone());
+    checkGetBoundaries(*this, clone.getAlias(), expected, expectedCount, "clone");
+
+    // Empty text.
+    int32_t boundaries[20];
+    bi->setText(UnicodeString());
+    status = U_ZERO_ERROR;
+    TEST_ASSERT(1 == bi->getBoundaries(boundaries, UPRV_LENGTHOF(boundaries), status));
+    TEST_ASSERT(boundaries[0] == 0);
+#else
+    logln("Skipped- not: !UCONFIG_NO_BREAK_ITERATION && !UCONFIG_NO_FILTERED_BREAK_ITERATION");
+#endif
+}
+
 //---------------------------------------------
 // runIndexedTest
 //---------------------------------------------
@@ -1431,6 +1527,7 @@ void RBBIAPITest::runIndexedTest( int32_t index, UBool exec, const char* &name,
     TESTCASE_AUTO(TestRefreshInputText);
 #if !UCONFIG_NO_BREAK_ITERATION
     TESTCASE_AUTO(TestFilteredBreakIteratorBuilder);
+    TESTCASE_AUTO(TestFilteredGetBoundaries);
 #endif
     TESTCASE_AUTO_END;
 }
@@ -56,6 +56,7 @@ public:
     void TestIteration(void);
 
     void TestFilteredBreakIteratorBuilder(void);
+    void TestFilteredGetBoundaries(void);
 
     /**
      * Tests creating RuleBasedBreakIterator from rules strings.
@@ -29,6 +29,7 @@
 #endif
 #include "unicode/schriter.h"
 #include "unicode/uchar.h"
+#include "unicode/ucharstriebuilder.h"
 #include "unicode/utf16.h"
 #include "unicode/ucnv.h"
 #include "unicode/uniset.h"
@@ -36,12 +37,15 @@
 #include "unicode/ustring.h"
 #include "unicode/utext.h"
 
+#include "brkeng.h"
 #include "charstr.h"
 #include "cmemory.h"
 #include "cstr.h"
+#include "dictionarydata.h"
 #include "intltest.h"
 #include "rbbitst.h"
 #include "rbbidata.h"
+#include "ucmndata.h"
 #include "utypeinfo.h"  // for 'typeid' to work
 #include "uvector.h"
 #include "uvectr32.h"
@@ -114,6 +118,9 @@ void RBBITest::runIndexedTest( int32_t index, UBool exec, const char* &name, cha
     TESTCASE_AUTO(TestBug13447);
     TESTCASE_AUTO(TestReverse);
     TESTCASE_AUTO(TestBug13692);
+    TESTCASE_AUTO(TestCustomDictionary);
+    TESTCASE_AUTO(TestSharedPrototypes);
+    TESTCASE_AUTO(TestBreakEngineCache);
     TESTCASE_AUTO_END;
 }
 
@@ -4561,6 +4568,238 @@ void RBBITest::TestBug13692() {
     assertSuccess(WHERE, status);
 }
 
+// Builds .dict format data with a UCharsTrie, as gendict would write it.
+static std::vector<uint32_t> buildCustomDictionary(const char16_t *const words[], const int32_t costs[],
+                                                   int32_t count, UErrorCode &status) {
+    std::vector<uint32_t> data;
+    UCharsTrieBuilder builder(status);
+    for (int32_t i = 0; i < count; ++i) {
+        builder.add(UnicodeString(words[i]), costs[i], status);
+    }
+    UnicodeString trie;
+    builder.buildUnicodeString(USTRINGTRIE_BUILD_SMALL, trie, status);
+    if (U_FAILURE(status)) {
+        return data;
+    }
+    const int32_t headerSize = 32;
+    const int32_t indexesSize = DictionaryData::IX_COUNT * 4;
+    const int32_t totalSize = indexesSize + trie.length() * 2;
+    data.resize((headerSize + totalSize + 3) / 4);
+    DataHeader *header = reinterpret_cast<DataHeader *>(data.data());
+    header->dataHeader.headerSize = headerSize;
+    header->dataHeader.magic1 = 0xda;
+    header->dataHeader.magic2 = 0x27;
+    header->info.size = sizeof(UDataInfo);
+    header->info.isBigEndian = U_IS_BIG_ENDIAN;
+    header->info.charsetFamily = U_CHARSET_FAMILY;
+    header->info.sizeofUChar = U_SIZEOF_UCHAR;
+    header->info.dataFormat[0] = 0x44;  // "Dict"
+    header->info.dataFormat[1] = 0x69;
+    header->info.dataFormat[2] = 0x63;
+    header->info.dataFormat[3] = 0x74;
+    header->info.formatVersion[0] = 1;
+    int32_t *indexes = reinterpret_cast<int32_t *>(data.data() + headerSize / 4);
+    indexes[DictionaryData::IX_STRING_TRIE_OFFSET] = indexesSize;
+    indexes[DictionaryData::IX_RESERVED1_OFFSET] = totalSize;
+    indexes[DictionaryData::IX_RESERVED2_OFFSET] = totalSize;
+    indexes[DictionaryData::IX_TOTAL_SIZE] = totalSize;
+    indexes[DictionaryData::IX_TRIE_TYPE] = DictionaryData::TRIE_TYPE_UCHARS | DictionaryData::TRIE_HAS_VALUES;
+    indexes[DictionaryData::IX_TRANSFORM] = DictionaryData::TRANSFORM_NONE;
+    u_memcpy(reinterpret_cast<UChar *>(indexes + DictionaryData::IX_COUNT), trie.getBuffer(), trie.length());
+    return data;
+}
+
+static UnicodeString iterateBoundaries(BreakIterator &bi) {
+    UnicodeString result;
+    for (int32_t pos = bi.first(); pos != BreakIterator::DONE; pos = bi.next()) {
+        result.append(u' ').append((UChar)(u'0' + pos));
+    }
+    return result;
+}
+
+static UnicodeString getBoundaries(BreakIterator &bi, const UnicodeString &text) {
+    bi.setText(text);
+    return iterateBoundaries(bi);
+}
+
+void RBBITest::TestCustomDictionary() {
+#if !UCONFIG_NO_NORMALIZATION
+    UErrorCode status = U_ZERO_ERROR;
+    LocalPointer<RuleBasedBreakIterator> bi((RuleBasedBreakIterator *)
+            BreakIterator::createWordInstance(Locale::getChinese(), status), status);
+    if (!assertSuccess(WHERE, status, true)) {
+        return;
+    }
+    // Made-up words that the built-in dictionary does not know.
+    static const char16_t *const words[] = { u"鱼猫狗", u"狗鸟" };
+    static const int32_t costs[] = { 10, 20 };
+    std::vector<uint32_t> dict = buildCustomDictionary(words, costs, UPRV_LENGTHOF(words), status);
+    if (!assertSuccess(WHERE, status)) {
+        return;
+    }
+    int32_t length = (int32_t)(dict.size() * 4);
+    UnicodeString text(u"鱼猫狗鸟狗鸟");
+    UnicodeString builtIn = getBoundaries(*bi, text);
+    assertTrue(WHERE, builtIn != UnicodeString(u" 0 3 4 6"));
+
+    bi->addCustomDictionary(USCRIPT_HAN, dict.data(), length, status);
+    if (!assertSuccess(WHERE, status)) {
+        return;
+    }
+    assertEquals(WHERE, u" 0 3 4 6", getBoundaries(*bi, text));
+    // Clones share the custom dictionary, other instances do not get it.
+    LocalPointer<BreakIterator> clone(bi->clone());
+    assertEquals(WHERE, u" 0 3 4 6", getBoundaries(*clone, text));
+    LocalPointer<BreakIterator> other(BreakIterator::createWordInstance(Locale::getChinese(), status));
+    if (assertSuccess(WHERE, status)) {
+        assertEquals(WHERE, builtIn, getBoundaries(*other, text));
+    }
+    // Replace the dictionary: Kana maps to the same Han engine.
+    static const char16_t *const words2[] = { u"猫狗" };
+    static const int32_t costs2[] = { 1 };
+    std::vector<uint32_t> dict2 = buildCustomDictionary(words2, costs2, UPRV_LENGTHOF(words2), status);
+    bi->addCustomDictionary(USCRIPT_KATAKANA, dict2.data(), (int32_t)(dict2.size() * 4), status);
+    assertSuccess(WHERE, status);
+    assertTrue(WHERE, getBoundaries(*bi, UnicodeString(u"鱼猫狗")).indexOf(u" 1 3") >= 0);
+    // The clone still uses the first dictionary.
+    assertEquals(WHERE, u" 0 3 4 6", getBoundaries(*clone, text));
+
+    // Adding a dictionary discards boundaries cached for the current text.
+    LocalPointer<RuleBasedBreakIterator> bi2((RuleBasedBreakIterator *)
+            BreakIterator::createWordInstance(Locale::getChinese(), status), status);
+    if (assertSuccess(WHERE, status)) {
+        bi2->setText(text);
+        assertEquals(WHERE, u" 0 1 2 3 4 5 6", iterateBoundaries(*bi2));
+        status = U_ZERO_ERROR;  // createWordInstance() may have set a warning
+        bi2->addCustomDictionary(USCRIPT_HAN, dict.data(), length, status);
+        assertEquals(WHERE, U_ZERO_ERROR, status);
+        assertEquals(WHERE, u" 0 3 4 6", iterateBoundaries(*bi2));
+    }
+
+    // Errors.
+    bi->addCustomDictionary(USCRIPT_LATIN, dict.data(), length, status);
+    assertEquals(WHERE, U_UNSUPPORTED_ERROR, status);
+    status = U_ZERO_ERROR;
+    bi->addCustomDictionary(USCRIPT_HAN, reinterpret_cast<const char *>(dict.data()) + 2, length - 4, status);
+    assertEquals(WHERE, U_ILLEGAL_ARGUMENT_ERROR, status);
+    status = U_ZERO_ERROR;
+    bi->addCustomDictionary(USCRIPT_HAN, dict.data(), 16, status);
+    assertEquals(WHERE, U_INVALID_FORMAT_ERROR, status);
+    status = U_ZERO_ERROR;
+    std::vector<uint32_t> bad(dict);
+    reinterpret_cast<DataHeader *>(bad.data())->info.dataFormat[0] = 0x45;
+    bi->addCustomDictionary(USCRIPT_HAN, bad.data(), length, status);
+    assertEquals(WHERE, U_INVALID_FORMAT_ERROR, status);
+#endif
+}
+
+// Break iterators for the same locale and kind are clones of a cached prototype,
+// and share its rule data.
+void RBBITest::TestSharedPrototypes() {
+    UErrorCode status = U_ZERO_ERROR;
+    LocalPointer<RuleBasedBreakIterator> bi1((RuleBasedBreakIterator *)
+            BreakIterator::createWordInstance(Locale::getEnglish(), status), status);
+    LocalPointer<RuleBasedBreakIterator> bi2((RuleBasedBreakIterator *)
+            BreakIterator::createWordInstance(Locale::getEnglish(), status), status);
+    if (!assertSuccess(WHERE, status, true)) {
+        return;
+    }
+    assertTrue(WHERE, bi1->fData == bi2->fData);
+    assertTrue(WHERE, *bi1 == *bi2);
+    assertEquals(WHERE, bi1->getLocale(ULOC_VALID_LOCALE, status).getName(),
+                 bi2->getLocale(ULOC_VALID_LOCALE, status).getName());
+
+    // The instances iterate independently.
+    UnicodeString text1(u"Hi, you.");
+    UnicodeString text2(u"One two");
+    bi1->setText(text1);
+    bi2->setText(text2);
+    assertEquals(WHERE, 2, bi1->next());
+    assertEquals(WHERE, 3, bi2->next());
+    assertEquals(WHERE, 3, bi1->next());
+    assertEquals(WHERE, 4, bi2->next());
+    assertEquals(WHERE, u" 0 2 3 4 7 8", getBoundaries(*bi1, text1));
+
+    // A fresh instance iterates over empty text.
+    LocalPointer<BreakIterator> empty(BreakIterator::createWordInstance(Locale::getEnglish(), status));
+    if (assertSuccess(WHERE, status)) {
+        assertEquals(WHERE, BreakIterator::DONE, empty->next());
+        assertEquals(WHERE, 0, empty->first());
+        assertEquals(WHERE, 0, empty->last());
+    }
+
+    // Locale keywords select different prototypes.
+    LocalPointer<RuleBasedBreakIterator> line((RuleBasedBreakIterator *)
+            BreakIterator::createLineInstance(Locale::getEnglish(), status), status);
+    LocalPointer<RuleBasedBreakIterator> looseLine((RuleBasedBreakIterator *)
+            BreakIterator::createLineInstance(Locale("en@lb=loose"), status), status);
+    if (assertSuccess(WHERE, status)) {
+        assertTrue(WHERE, line->fData != looseLine->fData);
+        assertTrue(WHERE, line->getRules() != looseLine->getRules());
+    }
+}
+
+namespace {
+
+// Counts engine loads, and can simulate a failure or a script without an engine.
+class CountingBreakFactory : public ICULanguageBreakFactory {
+public:
+    CountingBreakFactory(UErrorCode &status) :
+            ICULanguageBreakFactory(status), loadCount(0), failNextLoad(FALSE), noEngine(FALSE) {}
+
+    int32_t loadCount;
+    UBool failNextLoad;
+    UBool noEngine;
+
+protected:
+    virtual const LanguageBreakEngine *loadEngineFor(UChar32 c, UErrorCode &status) {
+        ++loadCount;
+        if (failNextLoad) {
+            failNextLoad = FALSE;
+            status = U_MEMORY_ALLOCATION_ERROR;
+            return NULL;
+        }
+        if (noEngine) {
+            return NULL;
+        }
+        return ICULanguageBreakFactory::loadEngineFor(c, status);
+    }
+};
+
+}  // namespace
+
+// The factory remembers the engine for a dictionary script, or that there is none,
+// but not a failure to load one.
+void RBBITest::TestBreakEngineCache() {
+    UErrorCode status = U_ZERO_ERROR;
+    CountingBreakFactory factory(status);
+    if (!assertSuccess(WHERE, status)) {
+        return;
+    }
+    const UChar32 thai = 0x0e01;
+    factory.failNextLoad = TRUE;
+    assertTrue(WHERE, factory.getEngineFor(thai) == NULL);
+    assertEquals(WHERE, 1, factory.loadCount);
+    const LanguageBreakEngine *engine = factory.getEngineFor(thai);
+    assertEquals(WHERE, 2, factory.loadCount);
+    if (engine == NULL) {
+        dataerrln("%s: no Thai break engine", WHERE);
+        return;
+    }
+    assertTrue(WHERE, factory.getEngineFor(0x0e02) == engine);
+    assertEquals(WHERE, 2, factory.loadCount);
+
+    const UChar32 lao = 0x0e81;
+    factory.noEngine = TRUE;
+    assertTrue(WHERE, factory.getEngineFor(lao) == NULL);
+    assertEquals(WHERE, 3, factory.loadCount);
+    factory.noEngine = FALSE;
+    assertTrue(WHERE, factory.getEngineFor(lao) == NULL);
+    assertEquals(WHERE, 3, factory.loadCount);
+    // Thai is unaffected.
+    assertTrue(WHERE, factory.getEngineFor(thai) == engine);
+}
+
 //
 //  TestDebug    -  A place-holder test for debugging purposes.
 //                  For putting in fragments of other tests that can be invoked
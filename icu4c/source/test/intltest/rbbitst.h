@@ -82,6 +82,9 @@ public:
     void TestReverse();
     void TestReverse(std::unique_ptr<RuleBasedBreakIterator>bi);
     void TestBug13692();
+    void TestCustomDictionary();
+    void TestSharedPrototypes();
+    void TestBreakEngineCache();
 
     void TestDebug();
     void TestProperties();
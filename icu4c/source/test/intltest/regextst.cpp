@@ -42,6 +42,7 @@
 #include "cstr.h"
 #include "regextst.h"
 #include "regexcmp.h"
+#include "simplethread.h"
 #include "uvector.h"
 #include "util.h"
 #include "cmemory.h"
@@ -104,6 +105,13 @@ void RegexTest::runIndexedTest( int32_t index, UBool exec, const char* &name, ch
     TESTCASE_AUTO(TestBug12884);
     TESTCASE_AUTO(TestBug13631);
     TESTCASE_AUTO(TestBug13632);
+    TESTCASE_AUTO(TestLinear);
+    TESTCASE_AUTO(TestLinearRandom);
+    TESTCASE_AUTO(TestPatternCache);
+    TESTCASE_AUTO(TestUsePattern);
+    TESTCASE_AUTO(TestFindAll);
+    TESTCASE_AUTO(TestReplaceAllUTF8);
+    TESTCASE_AUTO(TestSplitIndexes);
     TESTCASE_AUTO_END;
 }
 
@@ -1272,7 +1280,30 @@ void RegexTest::API_Match() {
         REGEX_ASSERT(matcher.getStackLimit() == 1000);
     }
 
+        // Loops on a single character save state at most once for the whole loop,
+        //   and not at all when what follows can't begin with a character of the loop.
+    {
+        UErrorCode status = U_ZERO_ERROR;
+        UnicodeString testString(1000000, 0x31, 1000000);  // Length 1,000,000, filled with '1'
+        testString.append(u'x');
+        RegexMatcher matcher(u"\\d+x", testString, 0, status);
+        matcher.setStackLimit(100, status);
+        REGEX_CHECK_STATUS;
+        REGEX_ASSERT(matcher.matches(status) == TRUE);
+        REGEX_CHECK_STATUS;
+
+        testString.setCharAt(1000000, u'y');
+        matcher.reset(testString);
+        REGEX_ASSERT(matcher.lookingAt(status) == FALSE);
+        REGEX_CHECK_STATUS;
 
+        RegexMatcher matcher2(u"1*1", testString, 0, status);
+        matcher2.setStackLimit(100, status);
+        REGEX_CHECK_STATUS;
+        REGEX_ASSERT(matcher2.lookingAt(status) == TRUE);
+        REGEX_ASSERT(matcher2.end(status) == 1000000);
+        REGEX_CHECK_STATUS;
+    }
 }
 
 
@@ -3154,7 +3185,7 @@ void RegexTest::Extended() {
 
     RegexMatcher    quotedStuffMat(UNICODE_STRING_SIMPLE("\\s*([\\'\\\"/])(.*?)\\1"), 0, status);
     RegexMatcher    commentMat    (UNICODE_STRING_SIMPLE("\\s*(#.*)?$"), 0, status);
-    RegexMatcher    flagsMat      (UNICODE_STRING_SIMPLE("\\s*([ixsmdteDEGLMQvabtyYzZ2-9]*)([:letter:]*)"), 0, status);
+    RegexMatcher    flagsMat      (UNICODE_STRING_SIMPLE("\\s*([ixsmdteDEGLMQvabntyYzZ2-9]*)([:letter:]*)"), 0, status);
 
     RegexMatcher    lineMat(UNICODE_STRING_SIMPLE("(.*?)\\r?\\n"), testString, 0, status);
     UnicodeString   testPattern;   // The pattern for test from the test file.
@@ -3367,6 +3398,9 @@ void RegexTest::regex_find(const UnicodeString &pattern,
     if (flags.indexOf((UChar)0x51) >= 0) { // 'Q' flag
         bflags |= UREGEX_LITERAL;
     }
+    if (flags.indexOf((UChar)0x6e) >= 0) { // 'n' flag
+        bflags |= UREGEX_LINEAR;
+    }
 
 
     callerPattern = RegexPattern::compile(pattern, bflags, pe, status);
@@ -3506,6 +3540,9 @@ void RegexTest::regex_find(const UnicodeString &pattern,
     //
     matcher = callerPattern->matcher(deTaggedInput, status);
     REGEX_CHECK_STATUS_L(line);
+    if ((bflags & UREGEX_LINEAR) == 0) {
+        checkLinear(pattern, bflags, deTaggedInput, srcPath, line);
+    }
     if (flags.indexOf((UChar)0x74) >= 0) {   //  't' trace flag
         matcher->setTrace(TRUE);
     }
@@ -5851,4 +5888,549 @@ void RegexTest::TestBug13632() {
     uregex_close(re);
 }
 
+// TestLinear   UREGEX_LINEAR, matching without backtracking.
+//              Match results are checked by the data driven tests, with the 'n' flag.
+void RegexTest::TestLinear() {
+    // Patterns that need backtracking.
+    const UChar *unsupported[] = { u"(a)\\1", u"a(?=b)", u"a(?!b)", u"(?<=a)b", u"(?<!a)b",
+                                   u"(?>a)", u"a*+", u"a?+", u"a{2}+", u"\\X", nullptr };
+    for (const UChar **pat=unsupported; *pat; ++pat) {
+        UErrorCode status = U_ZERO_ERROR;
+        LocalPointer<RegexPattern> pattern(RegexPattern::compile(*pat, UREGEX_LINEAR, status));
+        if (status != U_REGEX_UNIMPLEMENTED) {
+            errln("%s:%d: pattern #%d, expected U_REGEX_UNIMPLEMENTED, got %s",
+                  __FILE__, __LINE__, (int)(pat-unsupported), u_errorName(status));
+        }
+    }
+
+    // Counted loops are expanded.
+    {
+        UErrorCode status = U_ZERO_ERROR;
+        LocalPointer<RegexPattern> pattern(RegexPattern::compile(u"(a|b){1000}", UREGEX_LINEAR, status));
+        REGEX_CHECK_STATUS;
+        pattern.adoptInstead(RegexPattern::compile(u"((a|b){1000}){1000}", UREGEX_LINEAR, status));
+        REGEX_ASSERT(status == U_REGEX_PATTERN_TOO_BIG);
+
+        // Empty loop bodies.
+        status = U_ZERO_ERROR;
+        pattern.adoptInstead(RegexPattern::compile(u"(?:){0,100000}", UREGEX_LINEAR, status));
+        REGEX_ASSERT(status == U_REGEX_PATTERN_TOO_BIG);
+        status = U_ZERO_ERROR;
+        pattern.adoptInstead(RegexPattern::compile(u"x(?:){1000000}", UREGEX_LINEAR, status));
+        REGEX_CHECK_STATUS;
+        UnicodeString input(u"x");
+        LocalPointer<RegexMatcher> matcher(pattern->matcher(input, status));
+        REGEX_ASSERT(matcher->matches(status));
+        REGEX_CHECK_STATUS;
+    }
+
+    // Exponential with backtracking, no time limit is reached.
+    {
+        UErrorCode status = U_ZERO_ERROR;
+        UnicodeString input;
+        for (int32_t i=0; i<10000; i++) {
+            input.append(u'a');
+        }
+        RegexMatcher matcher(u"(a+)+b", input, UREGEX_LINEAR, status);
+        matcher.setTimeLimit(10, status);
+        REGEX_CHECK_STATUS;
+        REGEX_ASSERT(!matcher.find(status));
+        REGEX_CHECK_STATUS;
+        REGEX_ASSERT(!matcher.matches(status));
+        REGEX_CHECK_STATUS;
+
+        input.append(u'b');
+        matcher.reset(input);
+        REGEX_ASSERT(matcher.matches(status));
+        REGEX_CHECK_STATUS;
+        REGEX_ASSERT(matcher.start(1, status) == 0 && matcher.end(1, status) == 10000);
+    }
+
+    // The C API.
+    {
+        UErrorCode status = U_ZERO_ERROR;
+        URegularExpression *re = uregex_open(u"(\\w+)@(\\w+)", -1, UREGEX_LINEAR, nullptr, &status);
+        REGEX_CHECK_STATUS;
+        const UChar *text = u"mail fox@example now";
+        uregex_setText(re, text, -1, &status);
+        REGEX_ASSERT(uregex_find(re, 0, &status));
+        REGEX_ASSERT(uregex_start(re, 1, &status) == 5 && uregex_end(re, 2, &status) == 16);
+        REGEX_ASSERT(uregex_flags(re, &status) == UREGEX_LINEAR);
+        REGEX_CHECK_STATUS;
+        uregex_close(re);
+    }
+}
+
+// linearRandom   A random number from 0 to limit-1, for TestLinearRandom().
+//                The same sequence on all platforms, from a linear congruential generator.
+static int32_t linearRandom(uint32_t &seed, int32_t limit) {
+    seed = seed * 1103515245 + 12345;
+    return (int32_t)((seed >> 16) % limit);
+}
+
+// checkLinear   Check that a pattern compiled with UREGEX_LINEAR matches the same as with
+//               the backtracking engine: a sequence of find()s over the input, then
+//               lookingAt() and matches(). Patterns that need backtracking are skipped,
+//               and so are matches that run out of time or stack with backtracking.
+void RegexTest::checkLinear(const UnicodeString &pattern, uint32_t flags,
+                            const UnicodeString &input, const char *srcPath, int32_t line) {
+    UErrorCode status = U_ZERO_ERROR;
+    UParseError pe;
+    LocalPointer<RegexPattern> linearPattern(RegexPattern::compile(pattern, flags | UREGEX_LINEAR, pe, status));
+    LocalPointer<RegexPattern> backtrackPattern(RegexPattern::compile(pattern, flags, pe, status));
+    if (U_FAILURE(status)) {
+        return;
+    }
+    LocalPointer<RegexMatcher> linear(linearPattern->matcher(input, status));
+    LocalPointer<RegexMatcher> backtrack(backtrackPattern->matcher(input, status));
+    backtrack->setTimeLimit(50, status);
+    if (U_FAILURE(status)) {
+        errln("%s:%d: error %s creating matchers", srcPath, line, u_errorName(status));
+        return;
+    }
+
+    const char *functions[] = { "find", "lookingAt", "matches" };
+    for (int32_t f=0; f<UPRV_LENGTHOF(functions); f++) {
+        for (int32_t count=0; count<20; count++) {
+            UErrorCode linearStatus = U_ZERO_ERROR;
+            UErrorCode backtrackStatus = U_ZERO_ERROR;
+            UBool linearMatch, backtrackMatch;
+            if (f == 0) {
+                linearMatch    = linear->find(linearStatus);
+                backtrackMatch = backtrack->find(backtrackStatus);
+            } else if (f == 1) {
+                linearMatch    = linear->lookingAt(linearStatus);
+                backtrackMatch = backtrack->lookingAt(backtrackStatus);
+            } else {
+                linearMatch    = linear->matches(linearStatus);
+                backtrackMatch = backtrack->matches(backtrackStatus);
+            }
+            if (U_FAILURE(backtrackStatus)) {
+                return;
+            }
+            if (U_FAILURE(linearStatus) || linearMatch != backtrackMatch) {
+                errln("%s:%d: UREGEX_LINEAR %s() #%d returns %d (%s), with backtracking %d",
+                      srcPath, line, functions[f], count, linearMatch, u_errorName(linearStatus),
+                      backtrackMatch);
+                infoln(UnicodeString("    \"") + pattern + "\"  \"" + input + "\"");
+                return;
+            }
+            if (!linearMatch) {
+                break;
+            }
+            for (int32_t group=0; group<=linear->groupCount(); group++) {
+                int32_t linearStart    = linear->start(group, status);
+                int32_t linearEnd      = linear->end(group, status);
+                int32_t backtrackStart = backtrack->start(group, status);
+                int32_t backtrackEnd   = backtrack->end(group, status);
+                if (linearStart != backtrackStart || linearEnd != backtrackEnd) {
+                    errln("%s:%d: UREGEX_LINEAR %s() #%d group %d is %d-%d, with backtracking %d-%d",
+                          srcPath, line, functions[f], count, group, linearStart, linearEnd,
+                          backtrackStart, backtrackEnd);
+                    infoln(UnicodeString("    \"") + pattern + "\"  \"" + input + "\"");
+                    return;
+                }
+            }
+            if (f != 0) {
+                break;
+            }
+        }
+    }
+    REGEX_CHECK_STATUS;
+}
+
+// TestLinearRandom   UREGEX_LINEAR matches the same as the backtracking engine
+//                    for random patterns, with loops that can match an empty string.
+void RegexTest::TestLinearRandom() {
+    static const char *atoms[] = { "a", "b", "ab", "[ab]", ".", "\\d", "1", "c", "\\s", "[^a]",
+                                   "(?:)", "\\b", "\\B", "^", "$", "\\R", "\\z", "\\G" };
+    static const char *quantifiers[] = { "", "", "*", "+", "?", "*?", "+?", "??", "{2}", "{0,2}",
+                                         "{1,3}?", "{2,}", "{0,}", "{1,}?", "{0,2}?", "{2,}?" };
+    static const char *chars[] = { "a", "b", "c", "1", " ", "\n", "\r" };
+    static const uint32_t flags[] = { 0, UREGEX_CASE_INSENSITIVE, UREGEX_MULTILINE, UREGEX_DOTALL };
+
+    uint32_t seed = 1;
+    for (int32_t i=0; i<1000; i++) {
+        // A pattern of up to 3 levels of groups, each with up to 3 quantified items.
+        UnicodeString pattern;
+        int32_t counts[4];
+        int32_t depth = 0;
+        counts[0] = 1 + linearRandom(seed, 3);
+        while (depth >= 0) {
+            if (counts[depth] == 0) {
+                if (depth > 0) {
+                    pattern.append(u')').append(UnicodeString(quantifiers[linearRandom(seed, UPRV_LENGTHOF(quantifiers))], -1, US_INV));
+                }
+                depth--;
+                continue;
+            }
+            counts[depth]--;
+            int32_t kind = linearRandom(seed, depth < 3 ? 10 : 6);
+            if (kind >= 6) {
+                // A group: capturing, non-capturing, or an alternation.
+                static const char *groupStarts[] = { "(", "(", "(?:", "(" };
+                pattern.append(UnicodeString(groupStarts[kind-6], -1, US_INV));
+                if (kind == 9) {
+                    pattern.append(UnicodeString(atoms[linearRandom(seed, UPRV_LENGTHOF(atoms))], -1, US_INV))
+                           .append(u'|');
+                }
+                depth++;
+                counts[depth] = 1 + linearRandom(seed, 3);
+            } else {
+                pattern.append(UnicodeString(atoms[linearRandom(seed, UPRV_LENGTHOF(atoms))], -1, US_INV))
+                       .append(UnicodeString(quantifiers[linearRandom(seed, UPRV_LENGTHOF(quantifiers))], -1, US_INV));
+            }
+        }
+        UnicodeString input;
+        int32_t length = linearRandom(seed, 10);
+        for (int32_t j=0; j<length; j++) {
+            input.append(UnicodeString(chars[linearRandom(seed, UPRV_LENGTHOF(chars))], -1, US_INV).unescape());
+        }
+        checkLinear(pattern, flags[i % UPRV_LENGTHOF(flags)], input, "random pattern", i);
+    }
+}
+
+// TestPatternCache   Matchers created from a pattern string share the compiled pattern.
+void RegexTest::TestPatternCache() {
+    UErrorCode status = U_ZERO_ERROR;
+    // RegexMatchers compile their own patterns; only the C API shares them.
+    RegexMatcher m1(u"c[a-z]+t", 0, status);
+    UnicodeString input(u"the cat sat");
+    RegexMatcher m2(u"c[a-z]+t", input, 0, status);
+    REGEX_CHECK_STATUS;
+    REGEX_ASSERT(&m1.pattern() != &m2.pattern());
+    REGEX_ASSERT(m1.pattern().patternText(status) != m2.pattern().patternText(status));
+    REGEX_ASSERT(m2.find(status) && m2.start(status) == 4);
+    REGEX_CHECK_STATUS;
+
+    // Handles for the same pattern and flags share the compiled pattern,
+    //   but not its UText.
+    {
+        URegularExpression *re1 = uregex_open(u"c[a-z]+t", -1, 0, nullptr, &status);
+        URegularExpression *re2 = uregex_open(u"c[a-z]+t", -1, 0, nullptr, &status);
+        URegularExpression *re3 = uregex_open(u"c[a-z]+t", -1, UREGEX_CASE_INSENSITIVE, nullptr, &status);
+        REGEX_CHECK_STATUS;
+        REGEX_ASSERT(uregex_patternUText(re1, &status) != uregex_patternUText(re2, &status));
+        REGEX_ASSERT(uregex_flags(re3, &status) == UREGEX_CASE_INSENSITIVE);
+        REGEX_CHECK_STATUS;
+        uregex_close(re1);
+        uregex_close(re2);
+        uregex_close(re3);
+    }
+
+    // Errors are reported the same way each time, including the parse error position.
+    for (int32_t i=0; i<2; i++) {
+        status = U_ZERO_ERROR;
+        RegexMatcher bad(u"ab(c", 0, status);
+        REGEX_ASSERT(status == U_REGEX_MISMATCHED_PAREN);
+
+        status = U_ZERO_ERROR;
+        UParseError pe;
+        pe.offset = 0;
+        URegularExpression *re = uregex_open(u"ab(c", -1, 0, &pe, &status);
+        REGEX_ASSERT(status == U_REGEX_MISMATCHED_PAREN);
+        REGEX_ASSERT(re == nullptr && pe.line == 1 && pe.offset == 4);
+
+        status = U_ZERO_ERROR;
+        pe.offset = 0;
+        REGEX_ASSERT(!RegexPattern::matches(u"ab(c", u"abc", pe, status));
+        REGEX_ASSERT(status == U_REGEX_MISMATCHED_PAREN && pe.offset == 4);
+    }
+
+    // The C API, with clones of the same regular expression.
+    {
+        status = U_ZERO_ERROR;
+        URegularExpression *re1 = uregex_open(u"(\\d+)-(\\d+)", -1, 0, nullptr, &status);
+        URegularExpression *re2 = uregex_openC("(\\d+)-(\\d+)", 0, nullptr, &status);
+        URegularExpression *re3 = uregex_clone(re1, &status);
+        REGEX_CHECK_STATUS;
+        uregex_close(re1);
+        const UChar *text = u"pages 12-34";
+        uregex_setText(re2, text, -1, &status);
+        uregex_setText(re3, text, -1, &status);
+        REGEX_ASSERT(uregex_find(re2, 0, &status) && uregex_start(re2, 2, &status) == 9);
+        REGEX_ASSERT(uregex_find(re3, 0, &status) && uregex_start(re3, 2, &status) == 9);
+        REGEX_CHECK_STATUS;
+        REGEX_ASSERT(u_strcmp(uregex_pattern(re2, nullptr, &status), u"(\\d+)-(\\d+)") == 0);
+        REGEX_ASSERT(u_strcmp(uregex_pattern(re3, nullptr, &status), u"(\\d+)-(\\d+)") == 0);
+        REGEX_CHECK_STATUS;
+        uregex_close(re2);
+        uregex_close(re3);
+    }
+}
+
+// TestUsePattern   RegexMatcher::usePattern(), switching the pattern of an existing matcher.
+void RegexTest::TestUsePattern() {
+    UErrorCode status = U_ZERO_ERROR;
+    LocalPointer<RegexPattern> words(RegexPattern::compile(u"\\w+", 0, status));
+    LocalPointer<RegexPattern> groups(RegexPattern::compile(
+        u"(a)(b)(c)(d)(e)(f)(g)(h)(i)(j)(k)(l)(m)(n)(o)(p)(q)(r)(s)(t)", 0, status));
+    LocalPointer<RegexPattern> backRef(RegexPattern::compile(u"(\\w)\\1", 0, status));
+    REGEX_CHECK_STATUS;
+
+    UnicodeString input(u"xx abcdefghijklmnopqrst  yy");
+    RegexMatcher matcher(u"[a-z]", input, 0, status);
+    REGEX_CHECK_STATUS;
+    REGEX_ASSERT(matcher.find(status) && matcher.start(status) == 0);
+
+    // The region is kept, the match position is not.
+    matcher.region(1, input.length(), status);
+    matcher.usePattern(*words, status);
+    REGEX_CHECK_STATUS;
+    REGEX_ASSERT(&matcher.pattern() == words.getAlias());
+    REGEX_ASSERT(matcher.regionStart() == 1);
+    REGEX_ASSERT(matcher.find(status) && matcher.start(status) == 1 && matcher.end(status) == 2);
+    REGEX_ASSERT(matcher.find(status) && matcher.start(status) == 3);
+    REGEX_CHECK_STATUS;
+
+    // A pattern with more capture groups and a larger data area.
+    matcher.usePattern(*groups, status);
+    REGEX_ASSERT(matcher.find(status));
+    REGEX_ASSERT(matcher.groupCount() == 20 && matcher.start(20, status) == 22);
+    REGEX_CHECK_STATUS;
+
+    // A pattern with back references needs an alternate view of the input.
+    matcher.usePattern(*backRef, status);
+    REGEX_ASSERT(matcher.find(status) && matcher.start(status) == 25);
+    REGEX_ASSERT(!matcher.find(status));
+    REGEX_CHECK_STATUS;
+
+    // Using the current pattern again only resets the match state.
+    matcher.usePattern(matcher.pattern(), status);
+    REGEX_ASSERT(matcher.find(status) && matcher.start(status) == 25);
+    REGEX_CHECK_STATUS;
+
+    // An incoming error leaves the matcher unchanged.
+    status = U_ILLEGAL_ARGUMENT_ERROR;
+    matcher.usePattern(*words, status);
+    REGEX_ASSERT(&matcher.pattern() == backRef.getAlias());
+}
+
+// An executor for RegexPattern::findAll() that runs the tasks in reverse order,
+//   to check that the results don't depend on the order.
+U_CDECL_BEGIN
+static void U_CALLCONV
+reverseExecutor(const void *context, int32_t taskCount, URegexTask *task, void *taskContext) {
+    int32_t *callCount = (int32_t *)context;
+    for (int32_t i=taskCount-1; i>=0; --i) {
+        task(taskContext, i);
+        ++*callCount;
+    }
+}
+
+// The tasks being run by threadExecutor(), shared with the threads of its pool.
+static URegexTask *gFindAllTask = NULL;
+static void *gFindAllTaskContext = NULL;
+static int32_t gFindAllTaskCount = 0;
+static const int32_t FIND_ALL_THREADS = 4;
+
+// An executor for RegexPattern::findAll() that runs the tasks concurrently,
+//   on a pool of test threads. The context is the RegexTest.
+static void U_CALLCONV
+threadExecutor(const void *context, int32_t taskCount, URegexTask *task, void *taskContext) {
+    gFindAllTask = task;
+    gFindAllTaskContext = taskContext;
+    gFindAllTaskCount = taskCount;
+    ThreadPool<RegexTest> threads((RegexTest *)context, FIND_ALL_THREADS, &RegexTest::findAllThread);
+    threads.start();
+    threads.join();
+    gFindAllTask = NULL;
+    gFindAllTaskContext = NULL;
+}
+U_CDECL_END
+
+void RegexTest::findAllThread(int32_t threadNum) {
+    for (int32_t i=threadNum; i<gFindAllTaskCount; i+=FIND_ALL_THREADS) {
+        gFindAllTask(gFindAllTaskContext, i);
+    }
+}
+
+// TestFindAll   RegexPattern::findAll() finds the same matches as repeated find() calls.
+void RegexTest::TestFindAll() {
+    UnicodeString line(u"ab aab\u00e9 \U0001F600aaa\r\nb cab a\n\u2028xaa\n");
+    UnicodeString input;
+    for (int32_t i=0; i<20; i++) {
+        input.append(line);
+    }
+    const char16_t *patterns[] = {
+        u"\\w+",              // Can't match a line end, chunks split at lines.
+        u"a*",                  // Empty matches.
+        u"(?m)^a|b$",
+        u"(?s).{3}",            // Bounded length, matches cross chunk boundaries.
+        u"[^x]{2,5}?b",
+        u"a\\r?\\n?",
+        u"(?<=a)b|a(?=\\n)",
+        u"\\Ga",              // Depends on the previous match, not split.
+        u"(?s)a.*?b",           // Unbounded, not split.
+        u"\\b\\w"
+    };
+    for (int32_t i=0; i<UPRV_LENGTHOF(patterns); i++) {
+        UErrorCode status = U_ZERO_ERROR;
+        LocalPointer<RegexPattern> pattern(RegexPattern::compile(patterns[i], 0, status));
+        LocalPointer<RegexMatcher> matcher(pattern->matcher(input, status));
+        REGEX_CHECK_STATUS;
+        int64_t expected[2000];
+        int32_t expectedCount = 0;
+        while (matcher->find(status) && expectedCount < 1000) {
+            expected[expectedCount*2] = matcher->start64(status);
+            expected[expectedCount*2+1] = matcher->end64(status);
+            expectedCount++;
+        }
+        REGEX_ASSERT(expectedCount < 1000);
+
+        LocalUTextPointer ut(utext_openConstUnicodeString(NULL, &input, &status));
+        for (int32_t taskCount=1; taskCount<=20; taskCount+=3) {
+            int64_t found[2000];
+            int32_t callCount = 0;
+            int32_t foundCount = pattern->findAll(ut.getAlias(), taskCount, reverseExecutor, &callCount,
+                                                  found, UPRV_LENGTHOF(found)/2, status);
+            REGEX_CHECK_STATUS;
+            if (foundCount != expectedCount ||
+                    uprv_memcmp(found, expected, expectedCount*2*sizeof(int64_t)) != 0) {
+                errln("%s:%d findAll() mismatch for pattern %d, %d tasks",
+                      __FILE__, __LINE__, (int)i, (int)taskCount);
+            }
+            REGEX_ASSERT(callCount <= taskCount);
+
+            foundCount = pattern->findAll(ut.getAlias(), taskCount, threadExecutor, this,
+                                          found, UPRV_LENGTHOF(found)/2, status);
+            REGEX_CHECK_STATUS;
+            if (foundCount != expectedCount ||
+                    uprv_memcmp(found, expected, expectedCount*2*sizeof(int64_t)) != 0) {
+                errln("%s:%d threaded findAll() mismatch for pattern %d, %d tasks",
+                      __FILE__, __LINE__, (int)i, (int)taskCount);
+            }
+        }
+    }
+
+    // Buffer overflow, with the match count, and the first matches filled in.
+    UErrorCode status = U_ZERO_ERROR;
+    LocalPointer<RegexPattern> pattern(RegexPattern::compile(u"a+", 0, status));
+    UnicodeString text(u"aa-a-aaa-a\nab");
+    LocalUTextPointer ut(utext_openConstUnicodeString(NULL, &text, &status));
+    int64_t found[4] = {-1, -1, -1, -1};
+    int32_t foundCount = pattern->findAll(ut.getAlias(), 2, NULL, NULL, found, 2, status);
+    REGEX_ASSERT(status == U_BUFFER_OVERFLOW_ERROR);
+    REGEX_ASSERT(foundCount == 5);
+    REGEX_ASSERT(found[0] == 0 && found[1] == 2 && found[2] == 3 && found[3] == 4);
+
+    // Preflighting.
+    status = U_ZERO_ERROR;
+    REGEX_ASSERT(pattern->findAll(ut.getAlias(), 2, NULL, NULL, NULL, 0, status) == 5);
+    REGEX_ASSERT(status == U_BUFFER_OVERFLOW_ERROR);
+
+    status = U_ZERO_ERROR;
+    pattern->findAll(ut.getAlias(), 0, NULL, NULL, found, 2, status);
+    REGEX_ASSERT(status == U_ILLEGAL_ARGUMENT_ERROR);
+}
+
+// TestReplaceAllUTF8   replaceAll() with UTF-8 ByteSink output gives the same
+//                      result as replaceAll() to a UnicodeString.
+void RegexTest::TestReplaceAllUTF8() {
+    static const struct {
+        const char16_t *pattern;
+        const char16_t *replacement;
+        UErrorCode expectedStatus;
+    } cases[] = {
+        { u"(\\d+)-(\\d+)",         u"$2/$1",                   U_ZERO_ERROR },
+        { u"(?<user>\\w+)@\\w+",    u"${user}@[redacted]",      U_ZERO_ERROR },
+        { u"\\d",                   u"#",                       U_ZERO_ERROR },
+        { u"x?",                      u"-",                       U_ZERO_ERROR },
+        { u"b(c)?",                   u"<$1>\\$\\u00e9\\U0001F600", U_ZERO_ERROR },
+        { u"b",                       u"",                        U_ZERO_ERROR },
+        { u"b",                       u"ok$3",                    U_INDEX_OUTOFBOUNDS_ERROR },
+        { u"b",                       u"${nope}",                 U_REGEX_INVALID_CAPTURE_GROUP_NAME },
+        { u"zzz",                     u"$9",                      U_ZERO_ERROR }    // No match, no error.
+    };
+    UnicodeString input(u"mail bob@example.com at 10-20, \u00e9b\U0001F600bc 555-1212");
+
+    for (int32_t i=0; i<UPRV_LENGTHOF(cases); i++) {
+        UErrorCode status = U_ZERO_ERROR;
+        RegexMatcher matcher(cases[i].pattern, input, 0, status);
+        REGEX_CHECK_STATUS;
+
+        UErrorCode expectedStatus = U_ZERO_ERROR;
+        UnicodeString expected = matcher.replaceAll(cases[i].replacement, expectedStatus);
+        REGEX_ASSERT(expectedStatus == cases[i].expectedStatus);
+        std::string expected8;
+        expected.toUTF8String(expected8);
+
+        // UTF-16 input, and UTF-8 input, which is not all in one UText chunk.
+        std::string input8;
+        input.toUTF8String(input8);
+        LocalUTextPointer utf8Input(utext_openUTF8(NULL, input8.data(), (int64_t)input8.length(), &status));
+        for (int32_t mode=0; mode<2; mode++) {
+            if (mode == 1) {
+                matcher.reset(utf8Input.getAlias());
+            }
+            std::string actual;
+            StringByteSink<std::string> sink(&actual);
+            status = U_ZERO_ERROR;
+            matcher.replaceAll(cases[i].replacement, sink, status);
+            REGEX_ASSERT(status == cases[i].expectedStatus);
+            if (U_SUCCESS(status) && actual != expected8) {
+                errln("%s:%d replaceAll to ByteSink, case %d mode %d: expected \"%s\", got \"%s\"",
+                      __FILE__, __LINE__, (int)i, (int)mode, expected8.c_str(), actual.c_str());
+            }
+        }
+    }
+
+    // Output larger than the internal conversion buffers.
+    UErrorCode status = U_ZERO_ERROR;
+    UnicodeString longInput;
+    for (int32_t i=0; i<1000; i++) {
+        longInput.append(u"ab\u00e9\U0001F600 ");
+    }
+    RegexMatcher matcher(u"\\s", longInput, 0, status);
+    UnicodeString expected = matcher.replaceAll(u"\u3000", status);
+    std::string expected8, actual;
+    expected.toUTF8String(expected8);
+    StringByteSink<std::string> sink(&actual);
+    matcher.replaceAll(u"\u3000", sink, status);
+    REGEX_CHECK_STATUS;
+    REGEX_ASSERT(actual == expected8);
+}
+
+// TestSplitIndexes   splitIndexes() gives the bounds of the same fields as split().
+void RegexTest::TestSplitIndexes() {
+    UErrorCode status = U_ZERO_ERROR;
+    UnicodeString input(u"a:b::c<x>d<>");
+    LocalUTextPointer ut(utext_openUnicodeString(NULL, &input, &status));
+    RegexMatcher matcher(u":|<(x)?>", 0, status);
+    REGEX_CHECK_STATUS;
+
+    for (int32_t capacity=1; capacity<=12; capacity++) {
+        UnicodeString fields[12];
+        int64_t bounds[24];
+        int32_t fieldCount = matcher.split(input, fields, capacity, status);
+        int32_t boundsCount = matcher.splitIndexes(ut.getAlias(), bounds, capacity, status);
+        REGEX_CHECK_STATUS;
+        REGEX_ASSERT(fieldCount == boundsCount);
+        for (int32_t i=0; i<fieldCount && i<boundsCount; i++) {
+            UnicodeString field;
+            if (bounds[i*2] >= 0) {
+                field = input.tempSubStringBetween((int32_t)bounds[i*2], (int32_t)bounds[i*2+1]);
+            }
+            if (field != fields[i]) {
+                errln("%s:%d capacity %d, field %d differs from split()",
+                      __FILE__, __LINE__, (int)capacity, (int)i);
+            }
+        }
+    }
+
+    // Fields: "a", (group), "b", (group), "", (group), "c", "x", "d", (group), "".
+    //   The group is unset, except for the delimiter "<x>".
+    int64_t bounds[24];
+    REGEX_ASSERT(matcher.splitIndexes(ut.getAlias(), bounds, 12, status) == 11);
+    REGEX_ASSERT(bounds[0] == 0 && bounds[1] == 1);
+    REGEX_ASSERT(bounds[2] == -1 && bounds[3] == -1);
+    REGEX_ASSERT(bounds[8] == 4 && bounds[9] == 4);
+    REGEX_ASSERT(bounds[14] == 7 && bounds[15] == 8);
+    REGEX_ASSERT(bounds[20] == 12 && bounds[21] == 12);
+    REGEX_CHECK_STATUS;
+
+    matcher.splitIndexes(ut.getAlias(), NULL, 0, status);
+    REGEX_ASSERT(status == U_ILLEGAL_ARGUMENT_ERROR);
+}
+
 #endif  /* !UCONFIG_NO_REGULAR_EXPRESSIONS  */
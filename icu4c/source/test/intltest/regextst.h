@@ -59,6 +59,14 @@ public:
     virtual void TestBug12884();
     virtual void TestBug13631();
     virtual void TestBug13632();
+    virtual void TestLinear();
+    virtual void TestLinearRandom();
+    virtual void TestPatternCache();
+    virtual void TestUsePattern();
+    virtual void TestFindAll();
+    virtual void TestReplaceAllUTF8();
+    virtual void TestSplitIndexes();
+    void findAllThread(int32_t threadNum);
 
     // The following functions are internal to the regexp tests.
     virtual void assertUText(const char *expected, UText *actual, const char *file, int line);
@@ -69,6 +77,8 @@ public:
                             const UnicodeString &input, const char *srcPath, int32_t line);
     virtual void regex_err(const char *pat, int32_t errline, int32_t errcol,
                             UErrorCode expectedStatus, int32_t line);
+    virtual void checkLinear(const UnicodeString &pattern, uint32_t flags,
+                             const UnicodeString &input, const char *srcPath, int32_t line);
     virtual UChar *ReadAndConvertFile(const char *fileName, int32_t &len, const char *charset, UErrorCode &status);
     virtual const char *getPath(char buffer[2048], const char *filename);
 
@@ -0,0 +1,261 @@
+// © 2018 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+/*
+*******************************************************************************
+*   file name:  stringtriemaptest.cpp
+*   encoding:   UTF-8
+*   tab size:   8 (not used)
+*   indentation:4
+*/
+
+#include <string>
+
+#include "unicode/utypes.h"
+#include "unicode/localpointer.h"
+#include "unicode/stringtriemap.h"
+#include "unicode/unistr.h"
+#include "cmemory.h"
+#include "intltest.h"
+
+namespace {
+
+struct KeyAndValue {
+    const char16_t *key;
+    const char *value;
+    int32_t valueLength;
+};
+
+// Values include an empty one and one with NUL bytes.
+const KeyAndValue data[] = {
+    { u"a", "1", 1 },
+    { u"ab", "", 0 },
+    { u"abc", "three\0bytes", 11 },
+    { u"b", "B", 1 },
+    { u"日本", "Japan", 5 },
+    { u"日本語", "Japanese", 8 },
+    { u"😀x", "emoji", 5 }
+};
+
+}  // namespace
+
+class StringTrieMapTest : public IntlTest {
+public:
+    StringTrieMapTest() {}
+    virtual ~StringTrieMapTest() {}
+
+    void runIndexedTest(int32_t index, UBool exec, const char *&name, char *par=NULL);
+    void TestFind();
+    void TestMatch();
+    void TestSerialize();
+    void TestEmpty();
+    void TestDuplicates();
+
+private:
+    StringTrieMap *buildMap(UErrorCode &errorCode);
+    void checkFind(const StringTrieMap &map, const char *which);
+};
+
+extern IntlTest *createStringTrieMapTest() {
+    return new StringTrieMapTest();
+}
+
+void StringTrieMapTest::runIndexedTest(int32_t index, UBool exec, const char *&name, char * /*par*/) {
+    if(exec) {
+        logln("TestSuite StringTrieMapTest: ");
+    }
+    TESTCASE_AUTO_BEGIN;
+    TESTCASE_AUTO(TestFind);
+    TESTCASE_AUTO(TestMatch);
+    TESTCASE_AUTO(TestSerialize);
+    TESTCASE_AUTO(TestEmpty);
+    TESTCASE_AUTO(TestDuplicates);
+    TESTCASE_AUTO_END;
+}
+
+StringTrieMap *StringTrieMapTest::buildMap(UErrorCode &errorCode) {
+    StringTrieMapBuilder builder(errorCode);
+    // Add in reverse order so that value indexes differ from the sorted key order.
+    for(int32_t i=UPRV_LENGTHOF(data)-1; i>=0; --i) {
+        builder.add(UnicodeString(data[i].key), StringPiece(data[i].value, data[i].valueLength), errorCode);
+    }
+    return builder.build(USTRINGTRIE_BUILD_SMALL, errorCode);
+}
+
+void StringTrieMapTest::checkFind(const StringTrieMap &map, const char *which) {
+    assertEquals(UnicodeString(which)+" size()", UPRV_LENGTHOF(data), map.size());
+    UnicodeString keys[UPRV_LENGTHOF(data)];
+    std::string utf8Keys[UPRV_LENGTHOF(data)];
+    StringPiece utf8Pieces[UPRV_LENGTHOF(data)];
+    for(int32_t i=0; i<UPRV_LENGTHOF(data); ++i) {
+        keys[i]=UnicodeString(data[i].key);
+        keys[i].toUTF8String(utf8Keys[i]);
+        utf8Pieces[i]=utf8Keys[i];
+        const std::string &s=utf8Keys[i];
+
+        int32_t valueIndex=map.find(keys[i]);
+        StringPiece value=map.getValue(valueIndex);
+        if(valueIndex<0 || value!=StringPiece(data[i].value, data[i].valueLength)) {
+            errln("%s find(%s) failed: index %d", which, s.c_str(), (int)valueIndex);
+        }
+        assertEquals(UnicodeString(which)+" findUTF8() "+keys[i], valueIndex, map.findUTF8(utf8Pieces[i]));
+    }
+    int32_t indexes[UPRV_LENGTHOF(data)], utf8Indexes[UPRV_LENGTHOF(data)];
+    map.findAll(keys, UPRV_LENGTHOF(data), indexes);
+    map.findAllUTF8(utf8Pieces, UPRV_LENGTHOF(data), utf8Indexes);
+    for(int32_t i=0; i<UPRV_LENGTHOF(data); ++i) {
+        assertEquals(UnicodeString(which)+" findAll() "+keys[i], map.find(keys[i]), indexes[i]);
+        assertEquals(UnicodeString(which)+" findAllUTF8() "+keys[i], indexes[i], utf8Indexes[i]);
+    }
+
+    // Keys that are not in the map.
+    assertEquals(UnicodeString(which)+" find(empty)", -1, map.find(UnicodeString()));
+    assertEquals(UnicodeString(which)+" find(abcd)", -1, map.find(UnicodeString(u"abcd")));
+    assertEquals(UnicodeString(which)+" find(日)", -1, map.find(UnicodeString(u"日")));
+    assertEquals(UnicodeString(which)+" findUTF8(c)", -1, map.findUTF8("c"));
+    assertEquals(UnicodeString(which)+" findUTF8(ill-formed)", -1, map.findUTF8("a\xff"));
+    assertTrue(UnicodeString(which)+" getValue(out of range)", map.getValue(map.size()).empty());
+}
+
+void StringTrieMapTest::TestFind() {
+    IcuTestErrorCode errorCode(*this, "TestFind()");
+    LocalPointer<StringTrieMap> map(buildMap(errorCode));
+    if(errorCode.errIfFailureAndReset("StringTrieMapBuilder.build() failed")) {
+        return;
+    }
+    checkFind(*map, "built");
+}
+
+void StringTrieMapTest::TestMatch() {
+    IcuTestErrorCode errorCode(*this, "TestMatch()");
+    LocalPointer<StringTrieMap> map(buildMap(errorCode));
+    if(errorCode.errIfFailureAndReset("StringTrieMapBuilder.build() failed")) {
+        return;
+    }
+    int32_t matchLength;
+    int32_t valueIndex=map->matchLongest(u"abcd", -1, matchLength);
+    assertEquals("matchLongest(abcd) length", 3, matchLength);
+    assertEquals("matchLongest(abcd) value", map->find(u"abc"), valueIndex);
+    valueIndex=map->matchLongestUTF8("abcd", matchLength);
+    assertEquals("matchLongestUTF8(abcd) length", 3, matchLength);
+    assertEquals("matchLongestUTF8(abcd) value", map->find(u"abc"), valueIndex);
+    valueIndex=map->matchLongest(u"日本語の", -1, matchLength);
+    assertEquals("matchLongest(日本語の) length", 3, matchLength);
+    valueIndex=map->matchLongestUTF8("日本人", matchLength);
+    assertEquals("matchLongestUTF8(日本人) length", 6, matchLength);
+    assertEquals("matchLongestUTF8(日本人) value", map->find(u"日本"), valueIndex);
+    valueIndex=map->matchLongestUTF8("\xf0\x9f\x98\x80xyz", matchLength);
+    assertEquals("matchLongestUTF8(😀xyz) length", 5, matchLength);
+    valueIndex=map->matchLongest(u"xyz", 3, matchLength);
+    assertEquals("matchLongest(xyz) value", -1, valueIndex);
+    assertEquals("matchLongest(xyz) length", 0, matchLength);
+    valueIndex=map->matchLongest(u"abc", 2, matchLength);
+    assertEquals("matchLongest(abc, 2) length", 2, matchLength);
+
+    int32_t lengths[4], indexes[4];
+    int32_t count=map->matchAll(u"abcd", -1, lengths, indexes, UPRV_LENGTHOF(lengths));
+    assertEquals("matchAll(abcd) count", 3, count);
+    if(count==3) {
+        assertEquals("matchAll(abcd) lengths[0]", 1, lengths[0]);
+        assertEquals("matchAll(abcd) lengths[1]", 2, lengths[1]);
+        assertEquals("matchAll(abcd) lengths[2]", 3, lengths[2]);
+        assertEquals("matchAll(abcd) indexes[1]", map->find(u"ab"), indexes[1]);
+    }
+    count=map->matchAllUTF8("日本語", lengths, indexes, UPRV_LENGTHOF(lengths));
+    assertEquals("matchAllUTF8(日本語) count", 2, count);
+    if(count==2) {
+        assertEquals("matchAllUTF8(日本語) lengths[0]", 6, lengths[0]);
+        assertEquals("matchAllUTF8(日本語) lengths[1]", 9, lengths[1]);
+        assertEquals("matchAllUTF8(日本語) indexes[1]", map->find(u"日本語"), indexes[1]);
+    }
+    // Preflighting with too little capacity.
+    count=map->matchAll(u"abc", -1, lengths, indexes, 1);
+    assertEquals("matchAll(abc, capacity 1) count", 3, count);
+    assertEquals("matchAll(abc, capacity 1) lengths[0]", 1, lengths[0]);
+    count=map->matchAllUTF8("abc", NULL, NULL, 0);
+    assertEquals("matchAllUTF8(abc, capacity 0) count", 3, count);
+    // Matching stops at ill-formed UTF-8.
+    count=map->matchAllUTF8("a\x80" "bc", lengths, indexes, UPRV_LENGTHOF(lengths));
+    assertEquals("matchAllUTF8(a\\x80bc) count", 1, count);
+}
+
+void StringTrieMapTest::TestSerialize() {
+    IcuTestErrorCode errorCode(*this, "TestSerialize()");
+    LocalPointer<StringTrieMap> map(buildMap(errorCode));
+    if(errorCode.errIfFailureAndReset("StringTrieMapBuilder.build() failed")) {
+        return;
+    }
+    int32_t length;
+    const void *binary=map->getBinary(length);
+    assertTrue("serialized length is a multiple of 4", length>0 && (length&3)==0);
+    // Copy into separately allocated, aligned memory as if mapped from a file,
+    // and release the original map to make sure that nothing refers to it.
+    MaybeStackArray<int32_t, 64> copy(length/4);
+    uprv_memcpy(copy.getAlias(), binary, length);
+    map.adoptInstead(NULL);
+
+    LocalPointer<StringTrieMap> opened(StringTrieMap::openFromMemory(copy.getAlias(), length, errorCode));
+    if(errorCode.errIfFailureAndReset("StringTrieMap::openFromMemory() failed")) {
+        return;
+    }
+    checkFind(*opened, "opened");
+    int32_t openedLength;
+    assertTrue("getBinary() of an opened map aliases the data",
+               opened->getBinary(openedLength)==copy.getAlias() && openedLength==length);
+    opened.adoptInstead(NULL);
+
+    // Invalid data.
+    delete StringTrieMap::openFromMemory(copy.getAlias(), length-4, errorCode);
+    assertEquals("truncated data", U_INVALID_FORMAT_ERROR, errorCode.reset());
+    delete StringTrieMap::openFromMemory(reinterpret_cast<char *>(copy.getAlias())+1, length-4, errorCode);
+    assertEquals("misaligned data", U_ILLEGAL_ARGUMENT_ERROR, errorCode.reset());
+    copy[0]^=1;
+    delete StringTrieMap::openFromMemory(copy.getAlias(), length, errorCode);
+    assertEquals("bad signature", U_INVALID_FORMAT_ERROR, errorCode.reset());
+}
+
+void StringTrieMapTest::TestEmpty() {
+    IcuTestErrorCode errorCode(*this, "TestEmpty()");
+    StringTrieMapBuilder builder(errorCode);
+    LocalPointer<StringTrieMap> map(builder.build(USTRINGTRIE_BUILD_FAST, errorCode));
+    if(errorCode.errIfFailureAndReset("StringTrieMapBuilder.build() failed for an empty map")) {
+        return;
+    }
+    assertEquals("empty size()", 0, map->size());
+    assertEquals("empty find()", -1, map->find(UnicodeString(u"a")));
+    int32_t matchLength;
+    assertEquals("empty matchLongestUTF8()", -1, map->matchLongestUTF8("a", matchLength));
+    int32_t length;
+    const void *binary=map->getBinary(length);
+    LocalPointer<StringTrieMap> opened(StringTrieMap::openFromMemory(binary, length, errorCode));
+    if(errorCode.errIfFailureAndReset("StringTrieMap::openFromMemory() failed for an empty map")) {
+        return;
+    }
+    assertEquals("opened empty size()", 0, opened->size());
+
+    // The empty string is a valid key, and it matches at the start of any text.
+    LocalPointer<StringTrieMap> withEmptyKey(
+        builder.add(UnicodeString(), "e", errorCode).add(UnicodeString(u"a"), "a", errorCode).
+        build(USTRINGTRIE_BUILD_FAST, errorCode));
+    if(errorCode.errIfFailureAndReset("StringTrieMapBuilder.build() failed with an empty key")) {
+        return;
+    }
+    assertTrue("find(empty)", withEmptyKey->getValue(withEmptyKey->find(UnicodeString()))==StringPiece("e"));
+    int32_t valueIndex=withEmptyKey->matchLongest(u"xyz", -1, matchLength);
+    assertEquals("matchLongest(xyz) with empty key", withEmptyKey->find(UnicodeString()), valueIndex);
+    assertEquals("matchLongest(xyz) with empty key length", 0, matchLength);
+}
+
+void StringTrieMapTest::TestDuplicates() {
+    IcuTestErrorCode errorCode(*this, "TestDuplicates()");
+    StringTrieMapBuilder builder(errorCode);
+    builder.add(UnicodeString(u"x"), "1", errorCode).add(UnicodeString(u"x"), "2", errorCode);
+    delete builder.build(USTRINGTRIE_BUILD_FAST, errorCode);
+    assertEquals("duplicate keys", U_ILLEGAL_ARGUMENT_ERROR, errorCode.reset());
+    builder.clear().add(UnicodeString(u"x"), "1", errorCode);
+    LocalPointer<StringTrieMap> map(builder.build(USTRINGTRIE_BUILD_FAST, errorCode));
+    if(errorCode.errIfFailureAndReset("StringTrieMapBuilder.build() failed after clear()")) {
+        return;
+    }
+    assertEquals("size() after clear()", 1, map->size());
+    assertTrue("value after clear()", map->getValue(map->find(UnicodeString(u"x")))==StringPiece("1"));
+}
@@ -37,6 +37,7 @@ const char gUsageString[] =
     "-unix                      Run test using Unix strxfrm, strcoll services.\n"
     "-uselen                    Use API with string lengths.  Default is null-terminated strings\n"
     "-usekeys                   Run tests using sortkeys rather than strcoll\n"
+    "-compact                   Use compact ICU sort keys (ucol_getCompactSortKey)\n"
     "-strcmp                    Run tests using u_strcmp rather than strcoll\n"
     "-strcmpCPO                 Run tests using u_strcmpCodePointOrder rather than strcoll\n"
     "-loop nnnn                 Loopcount for test.  Adjust for reasonable total running time.\n"
@@ -121,6 +122,7 @@ UBool  opt_win        = FALSE;      // Run with Windows native functions.
 UBool  opt_unix       = FALSE;      // Run with UNIX strcoll, strxfrm functions.
 UBool  opt_uselen     = FALSE;
 UBool  opt_usekeys    = FALSE;
+UBool  opt_compact    = FALSE;
 UBool  opt_strcmp     = FALSE;
 UBool  opt_strcmpCPO  = FALSE;
 UBool  opt_norm       = FALSE;
@@ -159,6 +161,7 @@ OptSpec opts[] = {
     {"-unix",        OptSpec::FLAG,   &opt_unix},
     {"-uselen",      OptSpec::FLAG,   &opt_uselen},
     {"-usekeys",     OptSpec::FLAG,   &opt_usekeys},
+    {"-compact",     OptSpec::FLAG,   &opt_compact},
     {"-strcmp",      OptSpec::FLAG,   &opt_strcmp},
     {"-strcmpCPO",   OptSpec::FLAG,   &opt_strcmpCPO},
     {"-norm",        OptSpec::FLAG,   &opt_norm},
@@ -364,6 +367,19 @@ int ICURandomCmp(const void *a, const void *b) {
     return retVal;
 }
 
+//---------------------------------------------------------------------------------------
+//
+//   icuSortKey()   Get a regular or, with -compact, a compact ICU sort key.
+//
+//---------------------------------------------------------------------------------------
+int32_t icuSortKey(const UChar *name, int32_t len, char *key, int32_t keyLen)
+{
+    if (opt_compact) {
+        return ucol_getCompactSortKey(gCol, name, len, (uint8_t *)key, keyLen);
+    }
+    return ucol_getSortKey(gCol, name, len, (uint8_t *)key, keyLen);
+}
+
 //---------------------------------------------------------------------------------------
 //
 //   doKeyGen()     Key Generation Timing Test
@@ -407,7 +423,7 @@ void doKeyGen()
                     len = gFileLines[line].len;
                 }
                 for (iLoop=0; iLoop < opt_iLoopCount; iLoop++) {
-                    t = ucol_getSortKey(gCol, gFileLines[line].name, len, (unsigned char *)gFileLines[line].icuSortKey, 5000);
+                    t = icuSortKey(gFileLines[line].name, len, gFileLines[line].icuSortKey, 5000);
                 }
             }
         }
@@ -1616,11 +1632,11 @@ int main(int argc, const char** argv) {
     int32_t t;
 
     for (line=0; line<gNumFileLines; line++) {
-         t = ucol_getSortKey(gCol, gFileLines[line].name, -1, (unsigned char *)buf, sizeof(buf));
+         t = icuSortKey(gFileLines[line].name, -1, (char *)buf, sizeof(buf));
          gFileLines[line].icuSortKey  = new char[t];
 
          if (t > (int32_t)sizeof(buf)) {
-             t = ucol_getSortKey(gCol, gFileLines[line].name, -1, (unsigned char *)gFileLines[line].icuSortKey , t);
+             t = icuSortKey(gFileLines[line].name, -1, gFileLines[line].icuSortKey, t);
          }
          else
          {
@@ -0,0 +1,387 @@
+// © 2018 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+/*
+ *************************************************************************
+ *   file name:  convbench.cpp
+ *   encoding:   UTF-8
+ *   tab size:   8 (not used)
+ *   indentation:4
+ *
+ *   Self-contained charset conversion benchmark.
+ *   For each charset, a UTF-16 corpus is generated by repeating built-in
+ *   text in a suitable script (or taken from the -f input file),
+ *   encoded once, and then timed in both directions,
+ *   with and without offsets.
+ *
+ *   The operations per iteration are the corpus code points,
+ *   and the verbose summary reports MB/s of charset bytes.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "unicode/uperf.h"
+#include "unicode/ucnv.h"
+#include "unicode/ustring.h"
+#include "cmemory.h" // for UPRV_LENGTHOF
+#include "uoptions.h"
+
+// Built-in corpus text, one entry per script.
+// Each text must be fully mappable in the charsets that use it.
+enum {
+    WESTERN,        // ISO-8859-1 repertoire
+    WINDOWS_LATIN,  // adds windows-1252 punctuation and the euro sign
+    JAPANESE,
+    SIMPLIFIED_CHINESE,
+    TRADITIONAL_CHINESE,
+    MULTILINGUAL,   // all of the above plus non-BMP text
+    SEED_COUNT
+};
+
+static const UChar westernText[] =
+    u"Die Würde des Menschen ist unantastbar. Sie zu achten und zu schützen "
+    u"ist Verpflichtung aller staatlichen Gewalt. "
+    u"Tous les êtres humains naissent libres et égaux en dignité et en droits. "
+    u"Ils sont doués de raison et de conscience et doivent agir les uns envers "
+    u"les autres dans un esprit de fraternité.\n"
+    u"Todos los seres humanos nacen libres e iguales en dignidad y derechos; "
+    u"¿están dotados de razón y conciencia? ¡Sí!\n"
+    u"Price list 2018: 12,50 £ · 3½ kg · 45° · © Ünïcödé Æsir Øresund.\n";
+
+static const UChar windowsLatinText[] =
+    u"“Smart quotes” and ‘single quotes’ – en dash — em dash… "
+    u"The invoice total is €1.234,56 ‰ (incl. VAT) • Œuvre • Šumava • Žilina ™.\n";
+
+static const UChar japaneseText[] =
+    u"すべての人間は、生まれながらにして自由であり、かつ、尊厳と権利とについて"
+    u"平等である。人間は、理性と良心とを授けられており、互いに同胞の精神をもって"
+    u"行動しなければならない。\n"
+    u"国際標準化機構（ＩＳＯ）とユニコード・コンソーシアムは、文字コードの規格を"
+    u"共同で策定しています。ICU 62.1 のリリースノートを参照してください。\n"
+    u"東京都千代田区丸の内１－１－１　電話：03-1234-5678\n";
+
+static const UChar simplifiedChineseText[] =
+    u"人人生而自由，在尊严和权利上一律平等。他们赋有理性和良心，"
+    u"并应以兄弟关系的精神相对待。\n"
+    u"国际组件（ICU）是一套成熟的、广泛使用的库，为软件应用程序提供"
+    u"Unicode和全球化支持。北京市海淀区中关村大街１号，电话：010-12345678。\n";
+
+static const UChar traditionalChineseText[] =
+    u"人人生而自由，在尊嚴和權利上一律平等。他們賦有理性和良心，"
+    u"並應以兄弟關係的精神相對待。\n"
+    u"國際元件（ICU）是一套成熟的、廣泛使用的程式庫，為軟體應用程式提供"
+    u"Unicode與全球化支援。臺北市中正區重慶南路一段１２２號。\n";
+
+static const UChar multilingualText[] =
+    u"Ελληνικά: Όλοι οι άνθρωποι γεννιούνται ελεύθεροι και ίσοι στην αξιοπρέπεια. "
+    u"Русский: Все люди рождаются свободными и равными в своем достоинстве и правах. "
+    u"עברית: כל בני אדם נולדו בני חורין ושווים בערכם ובזכויותיהם. "
+    u"العربية: يولد جميع الناس أحرارًا متساوين في الكرامة والحقوق. "
+    u"हिन्दी: सभी मनुष्यों को गौरव और अधिकारों के मामले में जन्मजात स्वतन्त्रता प्राप्त है। "
+    u"한국어: 모든 인간은 태어날 때부터 자유로우며 그 존엄과 권리에 있어 동등하다. "
+    u"Emoji: 😀🎉👍🏽 𝔘𝔫𝔦𝔠𝔬𝔡𝔢 𠀀𠀁𠀂\n";
+
+struct Seed {
+    const UChar *text;
+    int32_t length;
+};
+
+static const Seed seeds[SEED_COUNT - 1] = {
+    { westernText, UPRV_LENGTHOF(westernText) - 1 },
+    { windowsLatinText, UPRV_LENGTHOF(windowsLatinText) - 1 },
+    { japaneseText, UPRV_LENGTHOF(japaneseText) - 1 },
+    { simplifiedChineseText, UPRV_LENGTHOF(simplifiedChineseText) - 1 },
+    { traditionalChineseText, UPRV_LENGTHOF(traditionalChineseText) - 1 }
+};
+
+// Charsets under test. The test names are <label>_<direction>[Offsets].
+struct CharsetInfo {
+    const char *label;
+    const char *charset;
+    int32_t seed;
+};
+
+static const CharsetInfo charsets[] = {
+    { "UTF8", "UTF-8", MULTILINGUAL },
+    { "UTF16", "UTF-16LE", MULTILINGUAL },
+    { "Latin1", "ISO-8859-1", WESTERN },
+    { "Windows1252", "windows-1252", WINDOWS_LATIN },
+    { "ShiftJIS", "Shift_JIS", JAPANESE },
+    { "EUCJP", "EUC-JP", JAPANESE },
+    { "GB18030", "GB18030", SIMPLIFIED_CHINESE },
+    { "Big5", "Big5", TRADITIONAL_CHINESE },
+    { "ISO2022JP", "ISO-2022-JP", JAPANESE },
+    { "EBCDIC", "ibm-37", WESTERN }
+};
+
+enum {
+    TO_UNICODE,
+    TO_UNICODE_OFFSETS,
+    FROM_UNICODE,
+    FROM_UNICODE_OFFSETS,
+    DIRECTION_COUNT
+};
+
+static const char *const directionNames[DIRECTION_COUNT] = {
+    "ToUnicode", "ToUnicodeOffsets", "FromUnicode", "FromUnicodeOffsets"
+};
+
+static char testNames[UPRV_LENGTHOF(charsets) * DIRECTION_COUNT][48];
+
+// Command-line options specific to convbench.
+// Options do not have abbreviations: Force readable command lines.
+// (Using U+0001 for abbreviation characters.)
+enum {
+    SIZE,
+    CONVBENCH_OPTIONS_COUNT
+};
+
+static UOption options[CONVBENCH_OPTIONS_COUNT]={
+    UOPTION_DEF("size",     '\x01', UOPT_REQUIRES_ARG)
+};
+
+static const char *const convbench_usage =
+    "\t--size      Minimum length (in UChars) of the generated corpora. [65536]\n"
+    "\t            The built-in text is repeated to reach this length.\n"
+    "\t            With -f, the file contents are used for all charsets instead.\n"
+    "\tTest names: <charset>_ToUnicode, <charset>_ToUnicodeOffsets,\n"
+    "\t            <charset>_FromUnicode, <charset>_FromUnicodeOffsets\n"
+    "\t            with <charset> one of UTF8 UTF16 Latin1 Windows1252 ShiftJIS\n"
+    "\t            EUCJP GB18030 Big5 ISO2022JP EBCDIC\n";
+
+// Test object.
+class ConvBenchTest : public UPerfTest {
+public:
+    ConvBenchTest(int32_t argc, const char *argv[], UErrorCode &status)
+            : UPerfTest(argc, argv, options, UPRV_LENGTHOF(options), convbench_usage, status) {
+        if (U_SUCCESS(status)) {
+            corpusSize = atoi(options[SIZE].value);
+            if (corpusSize < 1 || corpusSize > 0x1000000) {
+                fprintf(stderr, "error: corpus size must be 1..%ld\n", (long)0x1000000);
+                status = U_ILLEGAL_ARGUMENT_ERROR;
+            }
+            if (fileName != NULL) {
+                int32_t inputLength;
+                UPerfTest::getBuffer(inputLength, status);
+            }
+        }
+    }
+
+    virtual UPerfFunction* runIndexedTest(int32_t index, UBool exec, const char* &name, char* par = NULL);
+
+    // Returns a new[] array with the UTF-16 corpus for the charset.
+    UChar *makeCorpus(const CharsetInfo &info, int32_t &length) const;
+
+    UBool hasInputFile() const { return buffer != NULL; }
+
+    int32_t corpusSize;
+};
+
+UChar *ConvBenchTest::makeCorpus(const CharsetInfo &info, int32_t &length) const {
+    UChar *corpus;
+    if (buffer != NULL) {
+        length = bufferLen;
+        corpus = new UChar[length];
+        u_memcpy(corpus, buffer, length);
+        return corpus;
+    }
+    // Concatenate the seed texts for the multilingual corpus,
+    // otherwise use the one text for the charset's script.
+    int32_t first, limit;
+    if (info.seed == MULTILINGUAL) {
+        first = 0;
+        limit = SEED_COUNT - 1;
+    } else {
+        first = info.seed;
+        limit = first + 1;
+    }
+    int32_t unitLength = 0;
+    for (int32_t i = first; i < limit; ++i) {
+        unitLength += seeds[i].length;
+    }
+    if (info.seed == MULTILINGUAL) {
+        unitLength += UPRV_LENGTHOF(multilingualText) - 1;
+    }
+    int32_t count = (corpusSize + unitLength - 1) / unitLength;
+    length = count * unitLength;
+    corpus = new UChar[length];
+    UChar *p = corpus;
+    while (count-- > 0) {
+        for (int32_t i = first; i < limit; ++i) {
+            u_memcpy(p, seeds[i].text, seeds[i].length);
+            p += seeds[i].length;
+        }
+        if (info.seed == MULTILINGUAL) {
+            u_memcpy(p, multilingualText, UPRV_LENGTHOF(multilingualText) - 1);
+            p += UPRV_LENGTHOF(multilingualText) - 1;
+        }
+    }
+    return corpus;
+}
+
+// Converts a whole corpus in one call, so that the timing reflects the
+// converter's inner loops rather than buffer management.
+class ConvFunction : public UPerfFunction {
+public:
+    static UPerfFunction* get(const ConvBenchTest &testcase, const CharsetInfo &info, int32_t direction) {
+        ConvFunction *t = new ConvFunction(testcase, info, direction);
+        if (U_SUCCESS(t->errorCode)) {
+            return t;
+        } else {
+            fprintf(stderr, "error setting up %s %s - %s\n",
+                    info.charset, directionNames[direction], u_errorName(t->errorCode));
+            delete t;
+            return NULL;
+        }
+    }
+
+    virtual ~ConvFunction() {
+        ucnv_close(cnv);
+        delete[] unicode;
+        delete[] bytes;
+        delete[] uOutput;
+        delete[] bOutput;
+        delete[] offsets;
+    }
+
+    virtual void call(UErrorCode* pErrorCode) {
+        int32_t *pOffsets = (direction == TO_UNICODE_OFFSETS || direction == FROM_UNICODE_OFFSETS) ?
+            offsets : NULL;
+        if (direction <= TO_UNICODE_OFFSETS) {
+            const char *source = bytes;
+            UChar *target = uOutput;
+            ucnv_resetToUnicode(cnv);
+            ucnv_toUnicode(cnv, &target, uOutput + unicodeLength,
+                           &source, bytes + bytesLength, pOffsets, TRUE, pErrorCode);
+            outputLength = (int32_t)(target - uOutput);
+        } else {
+            const UChar *source = unicode;
+            char *target = bOutput;
+            ucnv_resetFromUnicode(cnv);
+            ucnv_fromUnicode(cnv, &target, bOutput + bytesLength,
+                             &source, unicode + unicodeLength, pOffsets, TRUE, pErrorCode);
+            outputLength = (int32_t)(target - bOutput);
+        }
+    }
+
+    virtual long getOperationsPerIteration() {
+        return countCodePoints;
+    }
+
+    virtual long getBytesPerIteration() {
+        return bytesLength;
+    }
+
+private:
+    ConvFunction(const ConvBenchTest &testcase, const CharsetInfo &info, int32_t dir)
+            : direction(dir), cnv(NULL),
+              unicode(NULL), unicodeLength(0), bytes(NULL), bytesLength(0),
+              uOutput(NULL), bOutput(NULL), offsets(NULL), outputLength(0),
+              countCodePoints(0), errorCode(U_ZERO_ERROR) {
+        cnv = ucnv_open(info.charset, &errorCode);
+        if (U_FAILURE(errorCode)) {
+            return;
+        }
+        unicode = testcase.makeCorpus(info, unicodeLength);
+        countCodePoints = u_countChar32(unicode, unicodeLength);
+
+        // Encode the corpus once. Unmappable code points in a user-supplied file
+        // are substituted; the result is then decoded again for the UTF-16 side
+        // so that both directions process the same text.
+        bytesLength = ucnv_fromUChars(cnv, NULL, 0, unicode, unicodeLength, &errorCode);
+        if (errorCode == U_BUFFER_OVERFLOW_ERROR) {
+            errorCode = U_ZERO_ERROR;
+        }
+        bytes = new char[bytesLength + 1];
+        ucnv_fromUChars(cnv, bytes, bytesLength + 1, unicode, unicodeLength, &errorCode);
+        if (U_FAILURE(errorCode)) {
+            return;
+        }
+        int32_t decodedLength = ucnv_toUChars(cnv, NULL, 0, bytes, bytesLength, &errorCode);
+        if (errorCode == U_BUFFER_OVERFLOW_ERROR) {
+            errorCode = U_ZERO_ERROR;
+        }
+        UChar *decoded = new UChar[decodedLength + 1];
+        ucnv_toUChars(cnv, decoded, decodedLength + 1, bytes, bytesLength, &errorCode);
+        if (U_SUCCESS(errorCode) && !testcase.hasInputFile() &&
+                (decodedLength != unicodeLength || u_memcmp(decoded, unicode, unicodeLength) != 0)) {
+            // The built-in text must round-trip.
+            fprintf(stderr, "error: built-in text does not round-trip through %s\n", info.charset);
+            errorCode = U_INVALID_CHAR_FOUND;
+        }
+        delete[] unicode;
+        unicode = decoded;
+        unicodeLength = decodedLength;
+        if (U_FAILURE(errorCode)) {
+            return;
+        }
+        countCodePoints = u_countChar32(unicode, unicodeLength);
+
+        uOutput = new UChar[unicodeLength];
+        bOutput = new char[bytesLength];
+        offsets = new int32_t[unicodeLength > bytesLength ? unicodeLength : bytesLength];
+
+        // Untimed warm-up run which also verifies the output length,
+        // so that a broken converter cannot report a good throughput.
+        call(&errorCode);
+        if (U_SUCCESS(errorCode) &&
+                outputLength != (direction <= TO_UNICODE_OFFSETS ? unicodeLength : bytesLength)) {
+            fprintf(stderr, "error: %s %s output length %ld != expected\n",
+                    info.charset, directionNames[direction], (long)outputLength);
+            errorCode = U_INTERNAL_PROGRAM_ERROR;
+        }
+    }
+
+    int32_t direction;
+    UConverter *cnv;
+    UChar *unicode;
+    int32_t unicodeLength;
+    char *bytes;
+    int32_t bytesLength;
+    UChar *uOutput;
+    char *bOutput;
+    int32_t *offsets;
+    int32_t outputLength;
+    int32_t countCodePoints;
+    UErrorCode errorCode;
+};
+
+UPerfFunction* ConvBenchTest::runIndexedTest(int32_t index, UBool exec, const char* &name, char* /*par*/) {
+    if (index < 0 || index >= UPRV_LENGTHOF(testNames)) {
+        name = "";
+        return NULL;
+    }
+    const CharsetInfo &info = charsets[index / DIRECTION_COUNT];
+    int32_t direction = index % DIRECTION_COUNT;
+    char *testName = testNames[index];
+    if (testName[0] == 0) {
+        sprintf(testName, "%s_%s", info.label, directionNames[direction]);
+    }
+    name = testName;
+    if (exec) {
+        return ConvFunction::get(*this, info, direction);
+    }
+    return NULL;
+}
+
+int main(int argc, const char *argv[])
+{
+    // Default values for command-line options.
+    options[SIZE].value = "65536";
+
+    UErrorCode status = U_ZERO_ERROR;
+    ConvBenchTest test(argc, argv, status);
+
+    if (U_FAILURE(status)){
+        printf("The error is %s\n", u_errorName(status));
+        test.usage();
+        return status;
+    }
+
+    if (test.run() == FALSE){
+        fprintf(stderr, "FAILED: Tests could not be run please check the "
+                        "arguments.\n");
+        return -1;
+    }
+    return 0;
+}
@@ -64,6 +64,12 @@ my $tests = {
     ####
     "ISO2022JP From Unicode",   ["$p1,TestICU_ISO2022JP_FromUnicode",   "$p2,TestICU_ISO2022JP_FromUnicode" ],
     "ISO2022JP To Unicode",     ["$p1,TestICU_ISO2022JP_ToUnicode",     "$p2,TestICU_ISO2022JP_ToUnicode" ],
+    ####
+    "ISO2022CN From Unicode",   ["$p1,TestICU_ISO2022CN_FromUnicode",   "$p2,TestICU_ISO2022CN_FromUnicode" ],
+    "ISO2022CN To Unicode",     ["$p1,TestICU_ISO2022CN_ToUnicode",     "$p2,TestICU_ISO2022CN_ToUnicode" ],
+    ####
+    "HZ From Unicode",          ["$p1,TestICU_HZ_FromUnicode",          "$p2,TestICU_HZ_FromUnicode" ],
+    "HZ To Unicode",            ["$p1,TestICU_HZ_ToUnicode",            "$p2,TestICU_HZ_ToUnicode" ],
 };
 
 
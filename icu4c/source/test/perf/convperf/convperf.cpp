@@ -116,6 +116,14 @@ UPerfFunction* ConverterPerformanceTest::runIndexedTest(int32_t index, UBool exe
         TESTCASE(52,TestWinANSI_ISO2022JP_ToUnicode);
         TESTCASE(53,TestWinANSI_ISO2022JP_FromUnicode);
 
+        TESTCASE(54,TestICU_GB18030_ToUnicode);
+        TESTCASE(55,TestICU_GB18030_FromUnicode);
+
+        TESTCASE(56,TestICU_ISO2022CN_ToUnicode);
+        TESTCASE(57,TestICU_ISO2022CN_FromUnicode);
+        TESTCASE(58,TestICU_HZ_ToUnicode);
+        TESTCASE(59,TestICU_HZ_FromUnicode);
+
         default: 
             name = ""; 
             return NULL;
@@ -657,3 +665,64 @@ UPerfFunction*  ConverterPerformanceTest::TestWinANSI_ISO2022JP_ToUnicode(){
     }
     return pf;
 }
+
+//#################
+
+
+UPerfFunction* ConverterPerformanceTest::TestICU_GB18030_FromUnicode(){
+    UErrorCode status = U_ZERO_ERROR;
+    ICUFromUnicodePerfFunction* pf = new ICUFromUnicodePerfFunction("gb18030",gb18030_uniSource, UPRV_LENGTHOF(gb18030_uniSource), status);
+    if(U_FAILURE(status)){
+        return NULL;
+    }
+    return pf;
+}
+
+UPerfFunction*  ConverterPerformanceTest::TestICU_GB18030_ToUnicode(){
+    UErrorCode status = U_ZERO_ERROR;
+    UPerfFunction* pf = new ICUToUnicodePerfFunction("gb18030",(char*)gb18030_encSource, UPRV_LENGTHOF(gb18030_encSource), status);
+    if(U_FAILURE(status)){
+        return NULL;
+    }
+    return pf;
+}
+
+//#################
+
+UPerfFunction* ConverterPerformanceTest::TestICU_ISO2022CN_FromUnicode(){
+    UErrorCode status = U_ZERO_ERROR;
+    ICUFromUnicodePerfFunction* pf = new ICUFromUnicodePerfFunction("iso-2022-cn",iso2022cn_uniSource, UPRV_LENGTHOF(iso2022cn_uniSource), status);
+    if(U_FAILURE(status)){
+        return NULL;
+    }
+    return pf;
+}
+
+UPerfFunction*  ConverterPerformanceTest::TestICU_ISO2022CN_ToUnicode(){
+    UErrorCode status = U_ZERO_ERROR;
+    UPerfFunction* pf = new ICUToUnicodePerfFunction("iso-2022-cn",(char*)iso2022cn_encSource, UPRV_LENGTHOF(iso2022cn_encSource), status);
+    if(U_FAILURE(status)){
+        return NULL;
+    }
+    return pf;
+}
+
+//#################
+
+UPerfFunction* ConverterPerformanceTest::TestICU_HZ_FromUnicode(){
+    UErrorCode status = U_ZERO_ERROR;
+    ICUFromUnicodePerfFunction* pf = new ICUFromUnicodePerfFunction("hz",iso2022cn_uniSource, UPRV_LENGTHOF(iso2022cn_uniSource), status);
+    if(U_FAILURE(status)){
+        return NULL;
+    }
+    return pf;
+}
+
+UPerfFunction*  ConverterPerformanceTest::TestICU_HZ_ToUnicode(){
+    UErrorCode status = U_ZERO_ERROR;
+    UPerfFunction* pf = new ICUToUnicodePerfFunction("hz",(char*)hz_encSource, UPRV_LENGTHOF(hz_encSource), status);
+    if(U_FAILURE(status)){
+        return NULL;
+    }
+    return pf;
+}
@@ -566,6 +566,15 @@ public:
     UPerfFunction* TestWinIML2_ISO2022JP_ToUnicode();
     UPerfFunction* TestWinIML2_ISO2022JP_FromUnicode(); 
 
+    UPerfFunction* TestICU_GB18030_ToUnicode();
+    UPerfFunction* TestICU_GB18030_FromUnicode();
+
+    UPerfFunction* TestICU_ISO2022CN_ToUnicode();
+    UPerfFunction* TestICU_ISO2022CN_FromUnicode();
+
+    UPerfFunction* TestICU_HZ_ToUnicode();
+    UPerfFunction* TestICU_HZ_FromUnicode();
+
 };
 
 #endif
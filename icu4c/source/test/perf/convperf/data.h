@@ -2731,5 +2731,391 @@ unsigned char utf8_encSmSource[]={
     0xE3,0x80,0x80,0xE3,0x80,0x81,0xE3,0x80,0x82,0x20,0xEF,0xBC,0x8E,0xE3,0x83,0xBB,
     0xEF,0xBC,0x9A,0xEF,0xBC,0x9B,0x0D,0x0A
 };
+
+unsigned char gb18030_encSource[]={
+    0x82,0x37,0xCF,0x35,0x82,0x37,0xCF,0x36,0x82,0x37,0xCF,0x37,0x82,0x37,0xCF,0x38,0x82,0x37,0xCF,0x39,
+    0x82,0x37,0xD0,0x30,0x82,0x37,0xD0,0x31,0x82,0x37,0xD0,0x32,0x82,0x37,0xD0,0x33,0x82,0x37,0xD0,0x34,
+    0x20,0x82,0x37,0xD0,0x35,0x82,0x37,0xD0,0x36,0x82,0x37,0xD0,0x37,0x82,0x37,0xD0,0x38,0x82,0x37,0xD0,
+    0x39,0x82,0x37,0xD1,0x30,0x82,0x37,0xD1,0x31,0x82,0x37,0xD1,0x32,0x82,0x37,0xD1,0x33,0x82,0x37,0xD1,
+    0x34,0x20,0x82,0x37,0xD1,0x35,0x82,0x37,0xD1,0x36,0x82,0x37,0xD1,0x37,0x82,0x37,0xD1,0x38,0x82,0x37,
+    0xD1,0x39,0x82,0x37,0xD2,0x30,0x82,0x37,0xD2,0x31,0x82,0x37,0xD2,0x32,0x82,0x37,0xD2,0x33,0x82,0x37,
+    0xD2,0x34,0x20,0x82,0x37,0xD2,0x35,0x82,0x37,0xD2,0x36,0x82,0x37,0xD2,0x37,0x82,0x37,0xD2,0x38,0x82,
+    0x37,0xD2,0x39,0x82,0x37,0xD3,0x30,0x82,0x37,0xD3,0x31,0x82,0x37,0xD3,0x32,0x82,0x37,0xD3,0x33,0x82,
+    0x37,0xD3,0x34,0x20,0x82,0x37,0xD3,0x35,0x82,0x37,0xD3,0x36,0x82,0x37,0xD3,0x37,0x82,0x37,0xD3,0x38,
+    0x82,0x37,0xD3,0x39,0x82,0x37,0xD4,0x30,0x82,0x37,0xD4,0x31,0x82,0x37,0xD4,0x32,0x82,0x37,0xD4,0x33,
+    0x82,0x37,0xD4,0x34,0x20,0x82,0x37,0xD4,0x35,0x82,0x37,0xD4,0x36,0x82,0x37,0xD4,0x37,0x82,0x37,0xD4,
+    0x38,0x82,0x37,0xD4,0x39,0x82,0x37,0xD5,0x30,0x82,0x37,0xD5,0x31,0x82,0x37,0xD5,0x32,0x82,0x37,0xD5,
+    0x33,0x82,0x37,0xD5,0x34,0x20,0x0D,0x0A,0x81,0x30,0xD3,0x30,0x81,0x30,0xD3,0x31,0x81,0x30,0xD3,0x32,
+    0x81,0x30,0xD3,0x33,0x81,0x30,0xD3,0x34,0x81,0x30,0xD3,0x35,0x81,0x30,0xD3,0x36,0x81,0x30,0xD3,0x37,
+    0x81,0x30,0xD3,0x38,0x81,0x30,0xD3,0x39,0x20,0x81,0x30,0xD4,0x30,0x81,0x30,0xD4,0x31,0x81,0x30,0xD4,
+    0x32,0x81,0x30,0xD4,0x33,0x81,0x30,0xD4,0x34,0x81,0x30,0xD4,0x35,0x81,0x30,0xD4,0x36,0x81,0x30,0xD4,
+    0x37,0x81,0x30,0xD4,0x38,0x81,0x30,0xD4,0x39,0x20,0x0D,0x0A,0x0D,0x0A,0x81,0x35,0xFE,0x34,0x81,0x35,
+    0xFE,0x35,0x81,0x35,0xFE,0x36,0x81,0x35,0xFE,0x37,0x81,0x35,0xFE,0x38,0x81,0x35,0xFE,0x39,0x81,0x36,
+    0x81,0x30,0x81,0x36,0x81,0x31,0x81,0x36,0x81,0x32,0x81,0x36,0x81,0x33,0x20,0x81,0x36,0x81,0x34,0x81,
+    0x36,0x81,0x35,0x81,0x36,0x81,0x36,0x81,0x36,0x81,0x37,0x81,0x36,0x81,0x38,0x81,0x36,0x81,0x39,0x81,
+    0x36,0x82,0x30,0x81,0x36,0x82,0x31,0x81,0x36,0x82,0x32,0x81,0x36,0x82,0x33,0x20,0x81,0x36,0x82,0x34,
+    0x81,0x36,0x82,0x35,0x81,0x36,0x82,0x36,0x81,0x36,0x82,0x37,0x81,0x36,0x82,0x38,0x81,0x36,0x82,0x39,
+    0x81,0x36,0x83,0x30,0x81,0x36,0x83,0x31,0x81,0x36,0x83,0x32,0x81,0x36,0x83,0x33,0x20,0x0D,0x0A,0x82,
+    0x35,0x98,0x33,0x82,0x35,0x98,0x34,0x82,0x35,0x98,0x35,0x82,0x35,0x98,0x36,0x82,0x35,0x98,0x37,0x82,
+    0x35,0x98,0x38,0x82,0x35,0x98,0x39,0x82,0x35,0x99,0x30,0x82,0x35,0x99,0x31,0x82,0x35,0x99,0x32,0x20,
+    0x82,0x35,0x99,0x33,0x82,0x35,0x99,0x34,0x82,0x35,0x99,0x35,0x82,0x35,0x99,0x36,0x82,0x35,0x99,0x37,
+    0x82,0x35,0x99,0x38,0x82,0x35,0x99,0x39,0x82,0x35,0x9A,0x30,0x82,0x35,0x9A,0x31,0x82,0x35,0x9A,0x32,
+    0x20,0x82,0x35,0x9A,0x33,0x82,0x35,0x9A,0x34,0x82,0x35,0x9A,0x35,0x82,0x35,0x9A,0x36,0x82,0x35,0x9A,
+    0x37,0x82,0x35,0x9A,0x38,0x82,0x35,0x9A,0x39,0x82,0x35,0x9B,0x30,0x82,0x35,0x9B,0x31,0x82,0x35,0x9B,
+    0x32,0x20,0x82,0x35,0x9B,0x33,0x82,0x35,0x9B,0x34,0x82,0x35,0x9B,0x35,0x82,0x35,0x9B,0x36,0x82,0x35,
+    0x9B,0x37,0x82,0x35,0x9B,0x38,0x82,0x35,0x9B,0x39,0x82,0x35,0x9C,0x30,0x82,0x35,0x9C,0x31,0x82,0x35,
+    0x9C,0x32,0x20,0x0D,0x0A,0x95,0x32,0x82,0x36,0x95,0x32,0x82,0x37,0x95,0x32,0x82,0x38,0x95,0x32,0x82,
+    0x39,0x95,0x32,0x83,0x30,0x95,0x32,0x83,0x31,0x95,0x32,0x83,0x32,0x95,0x32,0x83,0x33,0x95,0x32,0x83,
+    0x34,0x95,0x32,0x83,0x35,0x20,0x95,0x32,0x83,0x36,0x95,0x32,0x83,0x37,0x95,0x32,0x83,0x38,0x95,0x32,
+    0x83,0x39,0x95,0x32,0x84,0x30,0x95,0x32,0x84,0x31,0x95,0x32,0x84,0x32,0x95,0x32,0x84,0x33,0x95,0x32,
+    0x84,0x34,0x95,0x32,0x84,0x35,0x20,0x95,0x32,0x84,0x36,0x95,0x32,0x84,0x37,0x95,0x32,0x84,0x38,0x95,
+    0x32,0x84,0x39,0x95,0x32,0x85,0x30,0x95,0x32,0x85,0x31,0x95,0x32,0x85,0x32,0x95,0x32,0x85,0x33,0x95,
+    0x32,0x85,0x34,0x95,0x32,0x85,0x35,0x20,0x95,0x32,0x85,0x36,0x95,0x32,0x85,0x37,0x95,0x32,0x85,0x38,
+    0x95,0x32,0x85,0x39,0x95,0x32,0x86,0x30,0x95,0x32,0x86,0x31,0x95,0x32,0x86,0x32,0x95,0x32,0x86,0x33,
+    0x95,0x32,0x86,0x34,0x95,0x32,0x86,0x35,0x20,0x0D,0x0A,0x82,0x37,0xE9,0x31,0x82,0x37,0xE9,0x32,0x82,
+    0x37,0xE9,0x33,0x82,0x37,0xE9,0x34,0x82,0x37,0xE9,0x35,0x82,0x37,0xE9,0x36,0x82,0x37,0xE9,0x37,0x82,
+    0x37,0xE9,0x38,0x82,0x37,0xE9,0x39,0x82,0x37,0xEA,0x30,0x20,0x82,0x37,0xEA,0x31,0x82,0x37,0xEA,0x32,
+    0x82,0x37,0xEA,0x33,0x82,0x37,0xEA,0x34,0x82,0x37,0xEA,0x35,0x82,0x37,0xEA,0x36,0x82,0x37,0xEA,0x37,
+    0x82,0x37,0xEA,0x38,0x82,0x37,0xEA,0x39,0x82,0x37,0xEB,0x30,0x20,0x82,0x37,0xEB,0x31,0x82,0x37,0xEB,
+    0x32,0x82,0x37,0xEB,0x33,0x82,0x37,0xEB,0x34,0x82,0x37,0xEB,0x35,0x82,0x37,0xEB,0x36,0x82,0x37,0xEB,
+    0x37,0x82,0x37,0xEB,0x38,0x82,0x37,0xEB,0x39,0x82,0x37,0xEC,0x30,0x20,0x82,0x37,0xEC,0x31,0x82,0x37,
+    0xEC,0x32,0x82,0x37,0xEC,0x33,0x82,0x37,0xEC,0x34,0x82,0x37,0xEC,0x35,0x82,0x37,0xEC,0x36,0x82,0x37,
+    0xEC,0x37,0x82,0x37,0xEC,0x38,0x82,0x37,0xEC,0x39,0x82,0x37,0xED,0x30,0x20,0x82,0x37,0xED,0x31,0x82,
+    0x37,0xED,0x32,0x82,0x37,0xED,0x33,0x82,0x37,0xED,0x34,0x82,0x37,0xED,0x35,0x82,0x37,0xED,0x36,0x82,
+    0x37,0xED,0x37,0x82,0x37,0xED,0x38,0x82,0x37,0xED,0x39,0x82,0x37,0xEE,0x30,0x20,0x82,0x37,0xEE,0x31,
+    0x82,0x37,0xEE,0x32,0x82,0x37,0xEE,0x33,0x82,0x37,0xEE,0x34,0x82,0x37,0xEE,0x35,0x82,0x37,0xEE,0x36,
+    0x82,0x37,0xEE,0x37,0x82,0x37,0xEE,0x38,0x82,0x37,0xEE,0x39,0x82,0x37,0xEF,0x30,0x20,0x0D,0x0A,0x81,
+    0x30,0xE4,0x34,0x81,0x30,0xE4,0x35,0x81,0x30,0xE4,0x36,0x81,0x30,0xE4,0x37,0x81,0x30,0xE4,0x38,0x81,
+    0x30,0xE4,0x39,0x81,0x30,0xE5,0x30,0x81,0x30,0xE5,0x31,0x81,0x30,0xE5,0x32,0x81,0x30,0xE5,0x33,0x20,
+    0x81,0x30,0xE5,0x34,0x81,0x30,0xE5,0x35,0x81,0x30,0xE5,0x36,0x81,0x30,0xE5,0x37,0x81,0x30,0xE5,0x38,
+    0x81,0x30,0xE5,0x39,0x81,0x30,0xE6,0x30,0x81,0x30,0xE6,0x31,0x81,0x30,0xE6,0x32,0x81,0x30,0xE6,0x33,
+    0x20,0x0D,0x0A,0x98,0x35,0xF7,0x38,0x98,0x35,0xF7,0x39,0x98,0x35,0xF8,0x30,0x98,0x35,0xF8,0x31,0x98,
+    0x35,0xF8,0x32,0x98,0x35,0xF8,0x33,0x98,0x35,0xF8,0x34,0x98,0x35,0xF8,0x35,0x98,0x35,0xF8,0x36,0x98,
+    0x35,0xF8,0x37,0x20,0x98,0x35,0xF8,0x38,0x98,0x35,0xF8,0x39,0x98,0x35,0xF9,0x30,0x98,0x35,0xF9,0x31,
+    0x98,0x35,0xF9,0x32,0x98,0x35,0xF9,0x33,0x98,0x35,0xF9,0x34,0x98,0x35,0xF9,0x35,0x98,0x35,0xF9,0x36,
+    0x98,0x35,0xF9,0x37,0x20,0x98,0x35,0xF9,0x38,0x98,0x35,0xF9,0x39,0x98,0x35,0xFA,0x30,0x98,0x35,0xFA,
+    0x31,0x98,0x35,0xFA,0x32,0x98,0x35,0xFA,0x33,0x98,0x35,0xFA,0x34,0x98,0x35,0xFA,0x35,0x98,0x35,0xFA,
+    0x36,0x98,0x35,0xFA,0x37,0x20,0x0D,0x0A
+};
+WCHAR gb18030_uniSource[]={
+    0xAC00,0xAC01,0xAC02,0xAC03,0xAC04,0xAC05,0xAC06,0xAC07,0xAC08,0xAC09,
+    0x0020,0xAC0A,0xAC0B,0xAC0C,0xAC0D,0xAC0E,0xAC0F,0xAC10,0xAC11,0xAC12,
+    0xAC13,0x0020,0xAC14,0xAC15,0xAC16,0xAC17,0xAC18,0xAC19,0xAC1A,0xAC1B,
+    0xAC1C,0xAC1D,0x0020,0xAC1E,0xAC1F,0xAC20,0xAC21,0xAC22,0xAC23,0xAC24,
+    0xAC25,0xAC26,0xAC27,0x0020,0xAC28,0xAC29,0xAC2A,0xAC2B,0xAC2C,0xAC2D,
+    0xAC2E,0xAC2F,0xAC30,0xAC31,0x0020,0xAC32,0xAC33,0xAC34,0xAC35,0xAC36,
+    0xAC37,0xAC38,0xAC39,0xAC3A,0xAC3B,0x0020,0x000D,0x000A,0x0452,0x0453,
+    0x0454,0x0455,0x0456,0x0457,0x0458,0x0459,0x045A,0x045B,0x0020,0x045C,
+    0x045D,0x045E,0x045F,0x0460,0x0461,0x0462,0x0463,0x0464,0x0465,0x0020,
+    0x000D,0x000A,0x000D,0x000A,0x1EA0,0x1EA1,0x1EA2,0x1EA3,0x1EA4,0x1EA5,
+    0x1EA6,0x1EA7,0x1EA8,0x1EA9,0x0020,0x1EAA,0x1EAB,0x1EAC,0x1EAD,0x1EAE,
+    0x1EAF,0x1EB0,0x1EB1,0x1EB2,0x1EB3,0x0020,0x1EB4,0x1EB5,0x1EB6,0x1EB7,
+    0x1EB8,0x1EB9,0x1EBA,0x1EBB,0x1EBC,0x1EBD,0x0020,0x000D,0x000A,0xA000,
+    0xA001,0xA002,0xA003,0xA004,0xA005,0xA006,0xA007,0xA008,0xA009,0x0020,
+    0xA00A,0xA00B,0xA00C,0xA00D,0xA00E,0xA00F,0xA010,0xA011,0xA012,0xA013,
+    0x0020,0xA014,0xA015,0xA016,0xA017,0xA018,0xA019,0xA01A,0xA01B,0xA01C,
+    0xA01D,0x0020,0xA01E,0xA01F,0xA020,0xA021,0xA022,0xA023,0xA024,0xA025,
+    0xA026,0xA027,0x0020,0x000D,0x000A,0xD840,0xDC00,0xD840,0xDC01,0xD840,
+    0xDC02,0xD840,0xDC03,0xD840,0xDC04,0xD840,0xDC05,0xD840,0xDC06,0xD840,
+    0xDC07,0xD840,0xDC08,0xD840,0xDC09,0x0020,0xD840,0xDC0A,0xD840,0xDC0B,
+    0xD840,0xDC0C,0xD840,0xDC0D,0xD840,0xDC0E,0xD840,0xDC0F,0xD840,0xDC10,
+    0xD840,0xDC11,0xD840,0xDC12,0xD840,0xDC13,0x0020,0xD840,0xDC14,0xD840,
+    0xDC15,0xD840,0xDC16,0xD840,0xDC17,0xD840,0xDC18,0xD840,0xDC19,0xD840,
+    0xDC1A,0xD840,0xDC1B,0xD840,0xDC1C,0xD840,0xDC1D,0x0020,0xD840,0xDC1E,
+    0xD840,0xDC1F,0xD840,0xDC20,0xD840,0xDC21,0xD840,0xDC22,0xD840,0xDC23,
+    0xD840,0xDC24,0xD840,0xDC25,0xD840,0xDC26,0xD840,0xDC27,0x0020,0x000D,
+    0x000A,0xAD00,0xAD01,0xAD02,0xAD03,0xAD04,0xAD05,0xAD06,0xAD07,0xAD08,
+    0xAD09,0x0020,0xAD0A,0xAD0B,0xAD0C,0xAD0D,0xAD0E,0xAD0F,0xAD10,0xAD11,
+    0xAD12,0xAD13,0x0020,0xAD14,0xAD15,0xAD16,0xAD17,0xAD18,0xAD19,0xAD1A,
+    0xAD1B,0xAD1C,0xAD1D,0x0020,0xAD1E,0xAD1F,0xAD20,0xAD21,0xAD22,0xAD23,
+    0xAD24,0xAD25,0xAD26,0xAD27,0x0020,0xAD28,0xAD29,0xAD2A,0xAD2B,0xAD2C,
+    0xAD2D,0xAD2E,0xAD2F,0xAD30,0xAD31,0x0020,0xAD32,0xAD33,0xAD34,0xAD35,
+    0xAD36,0xAD37,0xAD38,0xAD39,0xAD3A,0xAD3B,0x0020,0x000D,0x000A,0x0500,
+    0x0501,0x0502,0x0503,0x0504,0x0505,0x0506,0x0507,0x0508,0x0509,0x0020,
+    0x050A,0x050B,0x050C,0x050D,0x050E,0x050F,0x0510,0x0511,0x0512,0x0513,
+    0x0020,0x000D,0x000A,0xD869,0xDF00,0xD869,0xDF01,0xD869,0xDF02,0xD869,
+    0xDF03,0xD869,0xDF04,0xD869,0xDF05,0xD869,0xDF06,0xD869,0xDF07,0xD869,
+    0xDF08,0xD869,0xDF09,0x0020,0xD869,0xDF0A,0xD869,0xDF0B,0xD869,0xDF0C,
+    0xD869,0xDF0D,0xD869,0xDF0E,0xD869,0xDF0F,0xD869,0xDF10,0xD869,0xDF11,
+    0xD869,0xDF12,0xD869,0xDF13,0x0020,0xD869,0xDF14,0xD869,0xDF15,0xD869,
+    0xDF16,0xD869,0xDF17,0xD869,0xDF18,0xD869,0xDF19,0xD869,0xDF1A,0xD869,
+    0xDF1B,0xD869,0xDF1C,0xD869,0xDF1D,0x0020,0x000D,0x000A
+};
+
+/* Chinese e-mail style text for the 7-bit ISO-2022-CN and HZ encodings */
+WCHAR iso2022cn_uniSource[]={
+    0x0053,0x0075,0x0062,0x006A,0x0065,0x0063,0x0074,0x003A,0x0020,0x4F1A,
+    0x8BAE,0x901A,0x77E5,0x0020,0x0028,0x004D,0x0065,0x0065,0x0074,0x0069,
+    0x006E,0x0067,0x0020,0x006E,0x006F,0x0074,0x0069,0x0063,0x0065,0x0029,
+    0x000D,0x000A,0x5404,0x4F4D,0x540C,0x4E8B,0xFF1A,0x000D,0x000A,0x672C,
+    0x5468,0x4E94,0x4E0B,0x5348,0x4E09,0x70B9,0x5728,0x4E8C,0x697C,0x4F1A,
+    0x8BAE,0x5BA4,0x53EC,0x5F00,0x9879,0x76EE,0x8FDB,0x5EA6,0x4F1A,0x8BAE,
+    0xFF0C,0x8BF7,0x5927,0x5BB6,0x51C6,0x65F6,0x53C2,0x52A0,0x3002,0x000D,
+    0x000A,0x4F1A,0x8BAE,0x5185,0x5BB9,0x5305,0x62EC,0xFF1A,0x4E00,0x3001,
+    0x4E0A,0x6708,0x5DE5,0x4F5C,0x603B,0x7ED3,0xFF1B,0x4E8C,0x3001,0x672C,
+    0x6708,0x5F00,0x53D1,0x8BA1,0x5212,0xFF1B,0x4E09,0x3001,0x6D4B,0x8BD5,
+    0x4E0E,0x53D1,0x5E03,0x5B89,0x6392,0x3002,0x000D,0x000A,0x8BF7,0x5404,
+    0x5C0F,0x7EC4,0x8D1F,0x8D23,0x4EBA,0x63D0,0x524D,0x51C6,0x5907,0x597D,
+    0x76F8,0x5173,0x6750,0x6599,0xFF0C,0x5E76,0x4E8E,0x5468,0x56DB,0x4E0B,
+    0x5348,0x4E94,0x70B9,0x524D,0x53D1,0x9001,0x5230,0x9879,0x76EE,0x90AE,
+    0x7BB1,0x3002,0x000D,0x000A,0x5982,0x6709,0x95EE,0x9898,0xFF0C,0x8BF7,
+    0x4E0E,0x529E,0x516C,0x5BA4,0x8054,0x7CFB,0xFF0C,0x7535,0x8BDD,0xFF1A,
+    0x0030,0x0031,0x0030,0x002D,0x0031,0x0032,0x0033,0x0034,0x0035,0x0036,
+    0x0037,0x0038,0x3002,0x000D,0x000A,0x8C22,0x8C22,0xFF01,0x000D,0x000A,
+    0x9879,0x76EE,0x7BA1,0x7406,0x529E,0x516C,0x5BA4,0x000D,0x000A,0x0032,
+    0x0030,0x0031,0x0038,0x5E74,0x0036,0x6708,0x0031,0x0038,0x65E5,0x000D,
+    0x000A,0x000D,0x000A,0x9644,0x4EF6,0x8BF4,0x660E,0xFF1A,0x000D,0x000A,
+    0x0031,0x002E,0x0020,0x8FDB,0x5EA6,0x62A5,0x544A,0xFF08,0x7B2C,0x4E8C,
+    0x5B63,0x5EA6,0xFF09,0x000D,0x000A,0x0032,0x002E,0x0020,0x6D4B,0x8BD5,
+    0x7ED3,0x679C,0x6C47,0x603B,0x8868,0x000D,0x000A,0x0033,0x002E,0x0020,
+    0x4E0B,0x4E00,0x9636,0x6BB5,0x7684,0x9700,0x6C42,0x6587,0x6863,0x000D,
+    0x000A,0x6211,0x4EEC,0x5E0C,0x671B,0x901A,0x8FC7,0x8FD9,0x6B21,0x4F1A,
+    0x8BAE,0x8FDB,0x4E00,0x6B65,0x660E,0x786E,0x5404,0x90E8,0x95E8,0x7684,
+    0x5206,0x5DE5,0xFF0C,0x63D0,0x9AD8,0x5DE5,0x4F5C,0x6548,0x7387,0xFF0C,
+    0x4FDD,0x8BC1,0x4EA7,0x54C1,0x6309,0x65F6,0x9AD8,0x8D28,0x91CF,0x5730,
+    0x5B8C,0x6210,0x3002,0x000D,0x000A,0x0053,0x0075,0x0062,0x006A,0x0065,
+    0x0063,0x0074,0x003A,0x0020,0x4F1A,0x8BAE,0x901A,0x77E5,0x0020,0x0028,
+    0x004D,0x0065,0x0065,0x0074,0x0069,0x006E,0x0067,0x0020,0x006E,0x006F,
+    0x0074,0x0069,0x0063,0x0065,0x0029,0x000D,0x000A,0x5404,0x4F4D,0x540C,
+    0x4E8B,0xFF1A,0x000D,0x000A,0x672C,0x5468,0x4E94,0x4E0B,0x5348,0x4E09,
+    0x70B9,0x5728,0x4E8C,0x697C,0x4F1A,0x8BAE,0x5BA4,0x53EC,0x5F00,0x9879,
+    0x76EE,0x8FDB,0x5EA6,0x4F1A,0x8BAE,0xFF0C,0x8BF7,0x5927,0x5BB6,0x51C6,
+    0x65F6,0x53C2,0x52A0,0x3002,0x000D,0x000A,0x4F1A,0x8BAE,0x5185,0x5BB9,
+    0x5305,0x62EC,0xFF1A,0x4E00,0x3001,0x4E0A,0x6708,0x5DE5,0x4F5C,0x603B,
+    0x7ED3,0xFF1B,0x4E8C,0x3001,0x672C,0x6708,0x5F00,0x53D1,0x8BA1,0x5212,
+    0xFF1B,0x4E09,0x3001,0x6D4B,0x8BD5,0x4E0E,0x53D1,0x5E03,0x5B89,0x6392,
+    0x3002,0x000D,0x000A,0x8BF7,0x5404,0x5C0F,0x7EC4,0x8D1F,0x8D23,0x4EBA,
+    0x63D0,0x524D,0x51C6,0x5907,0x597D,0x76F8,0x5173,0x6750,0x6599,0xFF0C,
+    0x5E76,0x4E8E,0x5468,0x56DB,0x4E0B,0x5348,0x4E94,0x70B9,0x524D,0x53D1,
+    0x9001,0x5230,0x9879,0x76EE,0x90AE,0x7BB1,0x3002,0x000D,0x000A,0x5982,
+    0x6709,0x95EE,0x9898,0xFF0C,0x8BF7,0x4E0E,0x529E,0x516C,0x5BA4,0x8054,
+    0x7CFB,0xFF0C,0x7535,0x8BDD,0xFF1A,0x0030,0x0031,0x0030,0x002D,0x0031,
+    0x0032,0x0033,0x0034,0x0035,0x0036,0x0037,0x0038,0x3002,0x000D,0x000A,
+    0x8C22,0x8C22,0xFF01,0x000D,0x000A,0x9879,0x76EE,0x7BA1,0x7406,0x529E,
+    0x516C,0x5BA4,0x000D,0x000A,0x0032,0x0030,0x0031,0x0038,0x5E74,0x0036,
+    0x6708,0x0031,0x0038,0x65E5,0x000D,0x000A,0x000D,0x000A,0x9644,0x4EF6,
+    0x8BF4,0x660E,0xFF1A,0x000D,0x000A,0x0031,0x002E,0x0020,0x8FDB,0x5EA6,
+    0x62A5,0x544A,0xFF08,0x7B2C,0x4E8C,0x5B63,0x5EA6,0xFF09,0x000D,0x000A,
+    0x0032,0x002E,0x0020,0x6D4B,0x8BD5,0x7ED3,0x679C,0x6C47,0x603B,0x8868,
+    0x000D,0x000A,0x0033,0x002E,0x0020,0x4E0B,0x4E00,0x9636,0x6BB5,0x7684,
+    0x9700,0x6C42,0x6587,0x6863,0x000D,0x000A,0x6211,0x4EEC,0x5E0C,0x671B,
+    0x901A,0x8FC7,0x8FD9,0x6B21,0x4F1A,0x8BAE,0x8FDB,0x4E00,0x6B65,0x660E,
+    0x786E,0x5404,0x90E8,0x95E8,0x7684,0x5206,0x5DE5,0xFF0C,0x63D0,0x9AD8,
+    0x5DE5,0x4F5C,0x6548,0x7387,0xFF0C,0x4FDD,0x8BC1,0x4EA7,0x54C1,0x6309,
+    0x65F6,0x9AD8,0x8D28,0x91CF,0x5730,0x5B8C,0x6210,0x3002,0x000D,0x000A,
+    0x0053,0x0075,0x0062,0x006A,0x0065,0x0063,0x0074,0x003A,0x0020,0x4F1A,
+    0x8BAE,0x901A,0x77E5,0x0020,0x0028,0x004D,0x0065,0x0065,0x0074,0x0069,
+    0x006E,0x0067,0x0020,0x006E,0x006F,0x0074,0x0069,0x0063,0x0065,0x0029,
+    0x000D,0x000A,0x5404,0x4F4D,0x540C,0x4E8B,0xFF1A,0x000D,0x000A,0x672C,
+    0x5468,0x4E94,0x4E0B,0x5348,0x4E09,0x70B9,0x5728,0x4E8C,0x697C,0x4F1A,
+    0x8BAE,0x5BA4,0x53EC,0x5F00,0x9879,0x76EE,0x8FDB,0x5EA6,0x4F1A,0x8BAE,
+    0xFF0C,0x8BF7,0x5927,0x5BB6,0x51C6,0x65F6,0x53C2,0x52A0,0x3002,0x000D,
+    0x000A,0x4F1A,0x8BAE,0x5185,0x5BB9,0x5305,0x62EC,0xFF1A,0x4E00,0x3001,
+    0x4E0A,0x6708,0x5DE5,0x4F5C,0x603B,0x7ED3,0xFF1B,0x4E8C,0x3001,0x672C,
+    0x6708,0x5F00,0x53D1,0x8BA1,0x5212,0xFF1B,0x4E09,0x3001,0x6D4B,0x8BD5,
+    0x4E0E,0x53D1,0x5E03,0x5B89,0x6392,0x3002,0x000D,0x000A,0x8BF7,0x5404,
+    0x5C0F,0x7EC4,0x8D1F,0x8D23,0x4EBA,0x63D0,0x524D,0x51C6,0x5907,0x597D,
+    0x76F8,0x5173,0x6750,0x6599,0xFF0C,0x5E76,0x4E8E,0x5468,0x56DB,0x4E0B,
+    0x5348,0x4E94,0x70B9,0x524D,0x53D1,0x9001,0x5230,0x9879,0x76EE,0x90AE,
+    0x7BB1,0x3002,0x000D,0x000A,0x5982,0x6709,0x95EE,0x9898,0xFF0C,0x8BF7,
+    0x4E0E,0x529E,0x516C,0x5BA4,0x8054,0x7CFB,0xFF0C,0x7535,0x8BDD,0xFF1A,
+    0x0030,0x0031,0x0030,0x002D,0x0031,0x0032,0x0033,0x0034,0x0035,0x0036,
+    0x0037,0x0038,0x3002,0x000D,0x000A,0x8C22,0x8C22,0xFF01,0x000D,0x000A,
+    0x9879,0x76EE,0x7BA1,0x7406,0x529E,0x516C,0x5BA4,0x000D,0x000A,0x0032,
+    0x0030,0x0031,0x0038,0x5E74,0x0036,0x6708,0x0031,0x0038,0x65E5,0x000D,
+    0x000A,0x000D,0x000A,0x9644,0x4EF6,0x8BF4,0x660E,0xFF1A,0x000D,0x000A,
+    0x0031,0x002E,0x0020,0x8FDB,0x5EA6,0x62A5,0x544A,0xFF08,0x7B2C,0x4E8C,
+    0x5B63,0x5EA6,0xFF09,0x000D,0x000A,0x0032,0x002E,0x0020,0x6D4B,0x8BD5,
+    0x7ED3,0x679C,0x6C47,0x603B,0x8868,0x000D,0x000A,0x0033,0x002E,0x0020,
+    0x4E0B,0x4E00,0x9636,0x6BB5,0x7684,0x9700,0x6C42,0x6587,0x6863,0x000D,
+    0x000A,0x6211,0x4EEC,0x5E0C,0x671B,0x901A,0x8FC7,0x8FD9,0x6B21,0x4F1A,
+    0x8BAE,0x8FDB,0x4E00,0x6B65,0x660E,0x786E,0x5404,0x90E8,0x95E8,0x7684,
+    0x5206,0x5DE5,0xFF0C,0x63D0,0x9AD8,0x5DE5,0x4F5C,0x6548,0x7387,0xFF0C,
+    0x4FDD,0x8BC1,0x4EA7,0x54C1,0x6309,0x65F6,0x9AD8,0x8D28,0x91CF,0x5730,
+    0x5B8C,0x6210,0x3002,0x000D,0x000A
+};
+
+unsigned char iso2022cn_encSource[]={
+    0x53,0x75,0x62,0x6A,0x65,0x63,0x74,0x3A,0x20,0x1B,0x24,0x29,0x41,0x0E,0x3B,0x61,0x52,0x69,0x4D,0x28,
+    0x56,0x2A,0x0F,0x20,0x28,0x4D,0x65,0x65,0x74,0x69,0x6E,0x67,0x20,0x6E,0x6F,0x74,0x69,0x63,0x65,0x29,
+    0x0D,0x0A,0x1B,0x24,0x29,0x41,0x0E,0x38,0x77,0x4E,0x3B,0x4D,0x2C,0x4A,0x42,0x23,0x3A,0x0F,0x0D,0x0A,
+    0x1B,0x24,0x29,0x41,0x0E,0x31,0x3E,0x56,0x5C,0x4E,0x65,0x4F,0x42,0x4E,0x67,0x48,0x7D,0x35,0x63,0x54,
+    0x5A,0x36,0x7E,0x42,0x25,0x3B,0x61,0x52,0x69,0x4A,0x52,0x55,0x59,0x3F,0x2A,0x4F,0x6E,0x44,0x3F,0x3D,
+    0x78,0x36,0x48,0x3B,0x61,0x52,0x69,0x23,0x2C,0x47,0x6B,0x34,0x73,0x3C,0x52,0x57,0x3C,0x4A,0x31,0x32,
+    0x4E,0x3C,0x53,0x21,0x23,0x0F,0x0D,0x0A,0x1B,0x24,0x29,0x41,0x0E,0x3B,0x61,0x52,0x69,0x44,0x5A,0x48,
+    0x5D,0x30,0x7C,0x40,0x28,0x23,0x3A,0x52,0x3B,0x21,0x22,0x49,0x4F,0x54,0x42,0x39,0x24,0x57,0x77,0x57,
+    0x5C,0x3D,0x61,0x23,0x3B,0x36,0x7E,0x21,0x22,0x31,0x3E,0x54,0x42,0x3F,0x2A,0x37,0x22,0x3C,0x46,0x3B,
+    0x2E,0x23,0x3B,0x48,0x7D,0x21,0x22,0x32,0x62,0x4A,0x54,0x53,0x6B,0x37,0x22,0x32,0x3C,0x30,0x32,0x45,
+    0x45,0x21,0x23,0x0F,0x0D,0x0A,0x1B,0x24,0x29,0x41,0x0E,0x47,0x6B,0x38,0x77,0x50,0x21,0x57,0x69,0x38,
+    0x3A,0x54,0x70,0x48,0x4B,0x4C,0x61,0x47,0x30,0x57,0x3C,0x31,0x38,0x3A,0x43,0x4F,0x60,0x39,0x58,0x32,
+    0x44,0x41,0x4F,0x23,0x2C,0x32,0x22,0x53,0x5A,0x56,0x5C,0x4B,0x44,0x4F,0x42,0x4E,0x67,0x4E,0x65,0x35,
+    0x63,0x47,0x30,0x37,0x22,0x4B,0x4D,0x35,0x3D,0x4F,0x6E,0x44,0x3F,0x53,0x4A,0x4F,0x64,0x21,0x23,0x0F,
+    0x0D,0x0A,0x1B,0x24,0x29,0x41,0x0E,0x48,0x67,0x53,0x50,0x4E,0x4A,0x4C,0x62,0x23,0x2C,0x47,0x6B,0x53,
+    0x6B,0x30,0x6C,0x39,0x2B,0x4A,0x52,0x41,0x2A,0x4F,0x35,0x23,0x2C,0x35,0x67,0x3B,0x30,0x23,0x3A,0x0F,
+    0x30,0x31,0x30,0x2D,0x31,0x32,0x33,0x34,0x35,0x36,0x37,0x38,0x0E,0x21,0x23,0x0F,0x0D,0x0A,0x1B,0x24,
+    0x29,0x41,0x0E,0x50,0x3B,0x50,0x3B,0x23,0x21,0x0F,0x0D,0x0A,0x1B,0x24,0x29,0x41,0x0E,0x4F,0x6E,0x44,
+    0x3F,0x39,0x5C,0x40,0x6D,0x30,0x6C,0x39,0x2B,0x4A,0x52,0x0F,0x0D,0x0A,0x32,0x30,0x31,0x38,0x1B,0x24,
+    0x29,0x41,0x0E,0x44,0x6A,0x0F,0x36,0x0E,0x54,0x42,0x0F,0x31,0x38,0x0E,0x48,0x55,0x0F,0x0D,0x0A,0x0D,
+    0x0A,0x1B,0x24,0x29,0x41,0x0E,0x38,0x3D,0x3C,0x7E,0x4B,0x35,0x43,0x77,0x23,0x3A,0x0F,0x0D,0x0A,0x31,
+    0x2E,0x20,0x1B,0x24,0x29,0x41,0x0E,0x3D,0x78,0x36,0x48,0x31,0x28,0x38,0x66,0x23,0x28,0x35,0x5A,0x36,
+    0x7E,0x3C,0x3E,0x36,0x48,0x23,0x29,0x0F,0x0D,0x0A,0x32,0x2E,0x20,0x1B,0x24,0x29,0x41,0x0E,0x32,0x62,
+    0x4A,0x54,0x3D,0x61,0x39,0x7B,0x3B,0x63,0x57,0x5C,0x31,0x6D,0x0F,0x0D,0x0A,0x33,0x2E,0x20,0x1B,0x24,
+    0x29,0x41,0x0E,0x4F,0x42,0x52,0x3B,0x3D,0x57,0x36,0x4E,0x35,0x44,0x50,0x68,0x47,0x73,0x4E,0x44,0x35,
+    0x35,0x0F,0x0D,0x0A,0x1B,0x24,0x29,0x41,0x0E,0x4E,0x52,0x43,0x47,0x4F,0x23,0x4D,0x7B,0x4D,0x28,0x39,
+    0x7D,0x55,0x62,0x34,0x4E,0x3B,0x61,0x52,0x69,0x3D,0x78,0x52,0x3B,0x32,0x3D,0x43,0x77,0x48,0x37,0x38,
+    0x77,0x32,0x3F,0x43,0x45,0x35,0x44,0x37,0x56,0x39,0x24,0x23,0x2C,0x4C,0x61,0x38,0x5F,0x39,0x24,0x57,
+    0x77,0x50,0x27,0x42,0x4A,0x23,0x2C,0x31,0x23,0x56,0x24,0x32,0x7A,0x46,0x37,0x30,0x34,0x4A,0x31,0x38,
+    0x5F,0x56,0x4A,0x41,0x3F,0x35,0x58,0x4D,0x6A,0x33,0x49,0x21,0x23,0x0F,0x0D,0x0A,0x53,0x75,0x62,0x6A,
+    0x65,0x63,0x74,0x3A,0x20,0x1B,0x24,0x29,0x41,0x0E,0x3B,0x61,0x52,0x69,0x4D,0x28,0x56,0x2A,0x0F,0x20,
+    0x28,0x4D,0x65,0x65,0x74,0x69,0x6E,0x67,0x20,0x6E,0x6F,0x74,0x69,0x63,0x65,0x29,0x0D,0x0A,0x1B,0x24,
+    0x29,0x41,0x0E,0x38,0x77,0x4E,0x3B,0x4D,0x2C,0x4A,0x42,0x23,0x3A,0x0F,0x0D,0x0A,0x1B,0x24,0x29,0x41,
+    0x0E,0x31,0x3E,0x56,0x5C,0x4E,0x65,0x4F,0x42,0x4E,0x67,0x48,0x7D,0x35,0x63,0x54,0x5A,0x36,0x7E,0x42,
+    0x25,0x3B,0x61,0x52,0x69,0x4A,0x52,0x55,0x59,0x3F,0x2A,0x4F,0x6E,0x44,0x3F,0x3D,0x78,0x36,0x48,0x3B,
+    0x61,0x52,0x69,0x23,0x2C,0x47,0x6B,0x34,0x73,0x3C,0x52,0x57,0x3C,0x4A,0x31,0x32,0x4E,0x3C,0x53,0x21,
+    0x23,0x0F,0x0D,0x0A,0x1B,0x24,0x29,0x41,0x0E,0x3B,0x61,0x52,0x69,0x44,0x5A,0x48,0x5D,0x30,0x7C,0x40,
+    0x28,0x23,0x3A,0x52,0x3B,0x21,0x22,0x49,0x4F,0x54,0x42,0x39,0x24,0x57,0x77,0x57,0x5C,0x3D,0x61,0x23,
+    0x3B,0x36,0x7E,0x21,0x22,0x31,0x3E,0x54,0x42,0x3F,0x2A,0x37,0x22,0x3C,0x46,0x3B,0x2E,0x23,0x3B,0x48,
+    0x7D,0x21,0x22,0x32,0x62,0x4A,0x54,0x53,0x6B,0x37,0x22,0x32,0x3C,0x30,0x32,0x45,0x45,0x21,0x23,0x0F,
+    0x0D,0x0A,0x1B,0x24,0x29,0x41,0x0E,0x47,0x6B,0x38,0x77,0x50,0x21,0x57,0x69,0x38,0x3A,0x54,0x70,0x48,
+    0x4B,0x4C,0x61,0x47,0x30,0x57,0x3C,0x31,0x38,0x3A,0x43,0x4F,0x60,0x39,0x58,0x32,0x44,0x41,0x4F,0x23,
+    0x2C,0x32,0x22,0x53,0x5A,0x56,0x5C,0x4B,0x44,0x4F,0x42,0x4E,0x67,0x4E,0x65,0x35,0x63,0x47,0x30,0x37,
+    0x22,0x4B,0x4D,0x35,0x3D,0x4F,0x6E,0x44,0x3F,0x53,0x4A,0x4F,0x64,0x21,0x23,0x0F,0x0D,0x0A,0x1B,0x24,
+    0x29,0x41,0x0E,0x48,0x67,0x53,0x50,0x4E,0x4A,0x4C,0x62,0x23,0x2C,0x47,0x6B,0x53,0x6B,0x30,0x6C,0x39,
+    0x2B,0x4A,0x52,0x41,0x2A,0x4F,0x35,0x23,0x2C,0x35,0x67,0x3B,0x30,0x23,0x3A,0x0F,0x30,0x31,0x30,0x2D,
+    0x31,0x32,0x33,0x34,0x35,0x36,0x37,0x38,0x0E,0x21,0x23,0x0F,0x0D,0x0A,0x1B,0x24,0x29,0x41,0x0E,0x50,
+    0x3B,0x50,0x3B,0x23,0x21,0x0F,0x0D,0x0A,0x1B,0x24,0x29,0x41,0x0E,0x4F,0x6E,0x44,0x3F,0x39,0x5C,0x40,
+    0x6D,0x30,0x6C,0x39,0x2B,0x4A,0x52,0x0F,0x0D,0x0A,0x32,0x30,0x31,0x38,0x1B,0x24,0x29,0x41,0x0E,0x44,
+    0x6A,0x0F,0x36,0x0E,0x54,0x42,0x0F,0x31,0x38,0x0E,0x48,0x55,0x0F,0x0D,0x0A,0x0D,0x0A,0x1B,0x24,0x29,
+    0x41,0x0E,0x38,0x3D,0x3C,0x7E,0x4B,0x35,0x43,0x77,0x23,0x3A,0x0F,0x0D,0x0A,0x31,0x2E,0x20,0x1B,0x24,
+    0x29,0x41,0x0E,0x3D,0x78,0x36,0x48,0x31,0x28,0x38,0x66,0x23,0x28,0x35,0x5A,0x36,0x7E,0x3C,0x3E,0x36,
+    0x48,0x23,0x29,0x0F,0x0D,0x0A,0x32,0x2E,0x20,0x1B,0x24,0x29,0x41,0x0E,0x32,0x62,0x4A,0x54,0x3D,0x61,
+    0x39,0x7B,0x3B,0x63,0x57,0x5C,0x31,0x6D,0x0F,0x0D,0x0A,0x33,0x2E,0x20,0x1B,0x24,0x29,0x41,0x0E,0x4F,
+    0x42,0x52,0x3B,0x3D,0x57,0x36,0x4E,0x35,0x44,0x50,0x68,0x47,0x73,0x4E,0x44,0x35,0x35,0x0F,0x0D,0x0A,
+    0x1B,0x24,0x29,0x41,0x0E,0x4E,0x52,0x43,0x47,0x4F,0x23,0x4D,0x7B,0x4D,0x28,0x39,0x7D,0x55,0x62,0x34,
+    0x4E,0x3B,0x61,0x52,0x69,0x3D,0x78,0x52,0x3B,0x32,0x3D,0x43,0x77,0x48,0x37,0x38,0x77,0x32,0x3F,0x43,
+    0x45,0x35,0x44,0x37,0x56,0x39,0x24,0x23,0x2C,0x4C,0x61,0x38,0x5F,0x39,0x24,0x57,0x77,0x50,0x27,0x42,
+    0x4A,0x23,0x2C,0x31,0x23,0x56,0x24,0x32,0x7A,0x46,0x37,0x30,0x34,0x4A,0x31,0x38,0x5F,0x56,0x4A,0x41,
+    0x3F,0x35,0x58,0x4D,0x6A,0x33,0x49,0x21,0x23,0x0F,0x0D,0x0A,0x53,0x75,0x62,0x6A,0x65,0x63,0x74,0x3A,
+    0x20,0x1B,0x24,0x29,0x41,0x0E,0x3B,0x61,0x52,0x69,0x4D,0x28,0x56,0x2A,0x0F,0x20,0x28,0x4D,0x65,0x65,
+    0x74,0x69,0x6E,0x67,0x20,0x6E,0x6F,0x74,0x69,0x63,0x65,0x29,0x0D,0x0A,0x1B,0x24,0x29,0x41,0x0E,0x38,
+    0x77,0x4E,0x3B,0x4D,0x2C,0x4A,0x42,0x23,0x3A,0x0F,0x0D,0x0A,0x1B,0x24,0x29,0x41,0x0E,0x31,0x3E,0x56,
+    0x5C,0x4E,0x65,0x4F,0x42,0x4E,0x67,0x48,0x7D,0x35,0x63,0x54,0x5A,0x36,0x7E,0x42,0x25,0x3B,0x61,0x52,
+    0x69,0x4A,0x52,0x55,0x59,0x3F,0x2A,0x4F,0x6E,0x44,0x3F,0x3D,0x78,0x36,0x48,0x3B,0x61,0x52,0x69,0x23,
+    0x2C,0x47,0x6B,0x34,0x73,0x3C,0x52,0x57,0x3C,0x4A,0x31,0x32,0x4E,0x3C,0x53,0x21,0x23,0x0F,0x0D,0x0A,
+    0x1B,0x24,0x29,0x41,0x0E,0x3B,0x61,0x52,0x69,0x44,0x5A,0x48,0x5D,0x30,0x7C,0x40,0x28,0x23,0x3A,0x52,
+    0x3B,0x21,0x22,0x49,0x4F,0x54,0x42,0x39,0x24,0x57,0x77,0x57,0x5C,0x3D,0x61,0x23,0x3B,0x36,0x7E,0x21,
+    0x22,0x31,0x3E,0x54,0x42,0x3F,0x2A,0x37,0x22,0x3C,0x46,0x3B,0x2E,0x23,0x3B,0x48,0x7D,0x21,0x22,0x32,
+    0x62,0x4A,0x54,0x53,0x6B,0x37,0x22,0x32,0x3C,0x30,0x32,0x45,0x45,0x21,0x23,0x0F,0x0D,0x0A,0x1B,0x24,
+    0x29,0x41,0x0E,0x47,0x6B,0x38,0x77,0x50,0x21,0x57,0x69,0x38,0x3A,0x54,0x70,0x48,0x4B,0x4C,0x61,0x47,
+    0x30,0x57,0x3C,0x31,0x38,0x3A,0x43,0x4F,0x60,0x39,0x58,0x32,0x44,0x41,0x4F,0x23,0x2C,0x32,0x22,0x53,
+    0x5A,0x56,0x5C,0x4B,0x44,0x4F,0x42,0x4E,0x67,0x4E,0x65,0x35,0x63,0x47,0x30,0x37,0x22,0x4B,0x4D,0x35,
+    0x3D,0x4F,0x6E,0x44,0x3F,0x53,0x4A,0x4F,0x64,0x21,0x23,0x0F,0x0D,0x0A,0x1B,0x24,0x29,0x41,0x0E,0x48,
+    0x67,0x53,0x50,0x4E,0x4A,0x4C,0x62,0x23,0x2C,0x47,0x6B,0x53,0x6B,0x30,0x6C,0x39,0x2B,0x4A,0x52,0x41,
+    0x2A,0x4F,0x35,0x23,0x2C,0x35,0x67,0x3B,0x30,0x23,0x3A,0x0F,0x30,0x31,0x30,0x2D,0x31,0x32,0x33,0x34,
+    0x35,0x36,0x37,0x38,0x0E,0x21,0x23,0x0F,0x0D,0x0A,0x1B,0x24,0x29,0x41,0x0E,0x50,0x3B,0x50,0x3B,0x23,
+    0x21,0x0F,0x0D,0x0A,0x1B,0x24,0x29,0x41,0x0E,0x4F,0x6E,0x44,0x3F,0x39,0x5C,0x40,0x6D,0x30,0x6C,0x39,
+    0x2B,0x4A,0x52,0x0F,0x0D,0x0A,0x32,0x30,0x31,0x38,0x1B,0x24,0x29,0x41,0x0E,0x44,0x6A,0x0F,0x36,0x0E,
+    0x54,0x42,0x0F,0x31,0x38,0x0E,0x48,0x55,0x0F,0x0D,0x0A,0x0D,0x0A,0x1B,0x24,0x29,0x41,0x0E,0x38,0x3D,
+    0x3C,0x7E,0x4B,0x35,0x43,0x77,0x23,0x3A,0x0F,0x0D,0x0A,0x31,0x2E,0x20,0x1B,0x24,0x29,0x41,0x0E,0x3D,
+    0x78,0x36,0x48,0x31,0x28,0x38,0x66,0x23,0x28,0x35,0x5A,0x36,0x7E,0x3C,0x3E,0x36,0x48,0x23,0x29,0x0F,
+    0x0D,0x0A,0x32,0x2E,0x20,0x1B,0x24,0x29,0x41,0x0E,0x32,0x62,0x4A,0x54,0x3D,0x61,0x39,0x7B,0x3B,0x63,
+    0x57,0x5C,0x31,0x6D,0x0F,0x0D,0x0A,0x33,0x2E,0x20,0x1B,0x24,0x29,0x41,0x0E,0x4F,0x42,0x52,0x3B,0x3D,
+    0x57,0x36,0x4E,0x35,0x44,0x50,0x68,0x47,0x73,0x4E,0x44,0x35,0x35,0x0F,0x0D,0x0A,0x1B,0x24,0x29,0x41,
+    0x0E,0x4E,0x52,0x43,0x47,0x4F,0x23,0x4D,0x7B,0x4D,0x28,0x39,0x7D,0x55,0x62,0x34,0x4E,0x3B,0x61,0x52,
+    0x69,0x3D,0x78,0x52,0x3B,0x32,0x3D,0x43,0x77,0x48,0x37,0x38,0x77,0x32,0x3F,0x43,0x45,0x35,0x44,0x37,
+    0x56,0x39,0x24,0x23,0x2C,0x4C,0x61,0x38,0x5F,0x39,0x24,0x57,0x77,0x50,0x27,0x42,0x4A,0x23,0x2C,0x31,
+    0x23,0x56,0x24,0x32,0x7A,0x46,0x37,0x30,0x34,0x4A,0x31,0x38,0x5F,0x56,0x4A,0x41,0x3F,0x35,0x58,0x4D,
+    0x6A,0x33,0x49,0x21,0x23,0x0F,0x0D,0x0A
+};
+
+unsigned char hz_encSource[]={
+    0x7E,0x7D,0x53,0x75,0x62,0x6A,0x65,0x63,0x74,0x3A,0x20,0x7E,0x7B,0x3B,0x61,0x52,0x69,0x4D,0x28,0x56,
+    0x2A,0x7E,0x7D,0x20,0x28,0x4D,0x65,0x65,0x74,0x69,0x6E,0x67,0x20,0x6E,0x6F,0x74,0x69,0x63,0x65,0x29,
+    0x0D,0x0A,0x7E,0x7B,0x38,0x77,0x4E,0x3B,0x4D,0x2C,0x4A,0x42,0x23,0x3A,0x7E,0x7D,0x0D,0x0A,0x7E,0x7B,
+    0x31,0x3E,0x56,0x5C,0x4E,0x65,0x4F,0x42,0x4E,0x67,0x48,0x7D,0x35,0x63,0x54,0x5A,0x36,0x7E,0x42,0x25,
+    0x3B,0x61,0x52,0x69,0x4A,0x52,0x55,0x59,0x3F,0x2A,0x4F,0x6E,0x44,0x3F,0x3D,0x78,0x36,0x48,0x3B,0x61,
+    0x52,0x69,0x23,0x2C,0x47,0x6B,0x34,0x73,0x3C,0x52,0x57,0x3C,0x4A,0x31,0x32,0x4E,0x3C,0x53,0x21,0x23,
+    0x7E,0x7D,0x0D,0x0A,0x7E,0x7B,0x3B,0x61,0x52,0x69,0x44,0x5A,0x48,0x5D,0x30,0x7C,0x40,0x28,0x23,0x3A,
+    0x52,0x3B,0x21,0x22,0x49,0x4F,0x54,0x42,0x39,0x24,0x57,0x77,0x57,0x5C,0x3D,0x61,0x23,0x3B,0x36,0x7E,
+    0x21,0x22,0x31,0x3E,0x54,0x42,0x3F,0x2A,0x37,0x22,0x3C,0x46,0x3B,0x2E,0x23,0x3B,0x48,0x7D,0x21,0x22,
+    0x32,0x62,0x4A,0x54,0x53,0x6B,0x37,0x22,0x32,0x3C,0x30,0x32,0x45,0x45,0x21,0x23,0x7E,0x7D,0x0D,0x0A,
+    0x7E,0x7B,0x47,0x6B,0x38,0x77,0x50,0x21,0x57,0x69,0x38,0x3A,0x54,0x70,0x48,0x4B,0x4C,0x61,0x47,0x30,
+    0x57,0x3C,0x31,0x38,0x3A,0x43,0x4F,0x60,0x39,0x58,0x32,0x44,0x41,0x4F,0x23,0x2C,0x32,0x22,0x53,0x5A,
+    0x56,0x5C,0x4B,0x44,0x4F,0x42,0x4E,0x67,0x4E,0x65,0x35,0x63,0x47,0x30,0x37,0x22,0x4B,0x4D,0x35,0x3D,
+    0x4F,0x6E,0x44,0x3F,0x53,0x4A,0x4F,0x64,0x21,0x23,0x7E,0x7D,0x0D,0x0A,0x7E,0x7B,0x48,0x67,0x53,0x50,
+    0x4E,0x4A,0x4C,0x62,0x23,0x2C,0x47,0x6B,0x53,0x6B,0x30,0x6C,0x39,0x2B,0x4A,0x52,0x41,0x2A,0x4F,0x35,
+    0x23,0x2C,0x35,0x67,0x3B,0x30,0x23,0x3A,0x7E,0x7D,0x30,0x31,0x30,0x2D,0x31,0x32,0x33,0x34,0x35,0x36,
+    0x37,0x38,0x7E,0x7B,0x21,0x23,0x7E,0x7D,0x0D,0x0A,0x7E,0x7B,0x50,0x3B,0x50,0x3B,0x23,0x21,0x7E,0x7D,
+    0x0D,0x0A,0x7E,0x7B,0x4F,0x6E,0x44,0x3F,0x39,0x5C,0x40,0x6D,0x30,0x6C,0x39,0x2B,0x4A,0x52,0x7E,0x7D,
+    0x0D,0x0A,0x32,0x30,0x31,0x38,0x7E,0x7B,0x44,0x6A,0x7E,0x7D,0x36,0x7E,0x7B,0x54,0x42,0x7E,0x7D,0x31,
+    0x38,0x7E,0x7B,0x48,0x55,0x7E,0x7D,0x0D,0x0A,0x0D,0x0A,0x7E,0x7B,0x38,0x3D,0x3C,0x7E,0x4B,0x35,0x43,
+    0x77,0x23,0x3A,0x7E,0x7D,0x0D,0x0A,0x31,0x2E,0x20,0x7E,0x7B,0x3D,0x78,0x36,0x48,0x31,0x28,0x38,0x66,
+    0x23,0x28,0x35,0x5A,0x36,0x7E,0x3C,0x3E,0x36,0x48,0x23,0x29,0x7E,0x7D,0x0D,0x0A,0x32,0x2E,0x20,0x7E,
+    0x7B,0x32,0x62,0x4A,0x54,0x3D,0x61,0x39,0x7B,0x3B,0x63,0x57,0x5C,0x31,0x6D,0x7E,0x7D,0x0D,0x0A,0x33,
+    0x2E,0x20,0x7E,0x7B,0x4F,0x42,0x52,0x3B,0x3D,0x57,0x36,0x4E,0x35,0x44,0x50,0x68,0x47,0x73,0x4E,0x44,
+    0x35,0x35,0x7E,0x7D,0x0D,0x0A,0x7E,0x7B,0x4E,0x52,0x43,0x47,0x4F,0x23,0x4D,0x7B,0x4D,0x28,0x39,0x7D,
+    0x55,0x62,0x34,0x4E,0x3B,0x61,0x52,0x69,0x3D,0x78,0x52,0x3B,0x32,0x3D,0x43,0x77,0x48,0x37,0x38,0x77,
+    0x32,0x3F,0x43,0x45,0x35,0x44,0x37,0x56,0x39,0x24,0x23,0x2C,0x4C,0x61,0x38,0x5F,0x39,0x24,0x57,0x77,
+    0x50,0x27,0x42,0x4A,0x23,0x2C,0x31,0x23,0x56,0x24,0x32,0x7A,0x46,0x37,0x30,0x34,0x4A,0x31,0x38,0x5F,
+    0x56,0x4A,0x41,0x3F,0x35,0x58,0x4D,0x6A,0x33,0x49,0x21,0x23,0x7E,0x7D,0x0D,0x0A,0x53,0x75,0x62,0x6A,
+    0x65,0x63,0x74,0x3A,0x20,0x7E,0x7B,0x3B,0x61,0x52,0x69,0x4D,0x28,0x56,0x2A,0x7E,0x7D,0x20,0x28,0x4D,
+    0x65,0x65,0x74,0x69,0x6E,0x67,0x20,0x6E,0x6F,0x74,0x69,0x63,0x65,0x29,0x0D,0x0A,0x7E,0x7B,0x38,0x77,
+    0x4E,0x3B,0x4D,0x2C,0x4A,0x42,0x23,0x3A,0x7E,0x7D,0x0D,0x0A,0x7E,0x7B,0x31,0x3E,0x56,0x5C,0x4E,0x65,
+    0x4F,0x42,0x4E,0x67,0x48,0x7D,0x35,0x63,0x54,0x5A,0x36,0x7E,0x42,0x25,0x3B,0x61,0x52,0x69,0x4A,0x52,
+    0x55,0x59,0x3F,0x2A,0x4F,0x6E,0x44,0x3F,0x3D,0x78,0x36,0x48,0x3B,0x61,0x52,0x69,0x23,0x2C,0x47,0x6B,
+    0x34,0x73,0x3C,0x52,0x57,0x3C,0x4A,0x31,0x32,0x4E,0x3C,0x53,0x21,0x23,0x7E,0x7D,0x0D,0x0A,0x7E,0x7B,
+    0x3B,0x61,0x52,0x69,0x44,0x5A,0x48,0x5D,0x30,0x7C,0x40,0x28,0x23,0x3A,0x52,0x3B,0x21,0x22,0x49,0x4F,
+    0x54,0x42,0x39,0x24,0x57,0x77,0x57,0x5C,0x3D,0x61,0x23,0x3B,0x36,0x7E,0x21,0x22,0x31,0x3E,0x54,0x42,
+    0x3F,0x2A,0x37,0x22,0x3C,0x46,0x3B,0x2E,0x23,0x3B,0x48,0x7D,0x21,0x22,0x32,0x62,0x4A,0x54,0x53,0x6B,
+    0x37,0x22,0x32,0x3C,0x30,0x32,0x45,0x45,0x21,0x23,0x7E,0x7D,0x0D,0x0A,0x7E,0x7B,0x47,0x6B,0x38,0x77,
+    0x50,0x21,0x57,0x69,0x38,0x3A,0x54,0x70,0x48,0x4B,0x4C,0x61,0x47,0x30,0x57,0x3C,0x31,0x38,0x3A,0x43,
+    0x4F,0x60,0x39,0x58,0x32,0x44,0x41,0x4F,0x23,0x2C,0x32,0x22,0x53,0x5A,0x56,0x5C,0x4B,0x44,0x4F,0x42,
+    0x4E,0x67,0x4E,0x65,0x35,0x63,0x47,0x30,0x37,0x22,0x4B,0x4D,0x35,0x3D,0x4F,0x6E,0x44,0x3F,0x53,0x4A,
+    0x4F,0x64,0x21,0x23,0x7E,0x7D,0x0D,0x0A,0x7E,0x7B,0x48,0x67,0x53,0x50,0x4E,0x4A,0x4C,0x62,0x23,0x2C,
+    0x47,0x6B,0x53,0x6B,0x30,0x6C,0x39,0x2B,0x4A,0x52,0x41,0x2A,0x4F,0x35,0x23,0x2C,0x35,0x67,0x3B,0x30,
+    0x23,0x3A,0x7E,0x7D,0x30,0x31,0x30,0x2D,0x31,0x32,0x33,0x34,0x35,0x36,0x37,0x38,0x7E,0x7B,0x21,0x23,
+    0x7E,0x7D,0x0D,0x0A,0x7E,0x7B,0x50,0x3B,0x50,0x3B,0x23,0x21,0x7E,0x7D,0x0D,0x0A,0x7E,0x7B,0x4F,0x6E,
+    0x44,0x3F,0x39,0x5C,0x40,0x6D,0x30,0x6C,0x39,0x2B,0x4A,0x52,0x7E,0x7D,0x0D,0x0A,0x32,0x30,0x31,0x38,
+    0x7E,0x7B,0x44,0x6A,0x7E,0x7D,0x36,0x7E,0x7B,0x54,0x42,0x7E,0x7D,0x31,0x38,0x7E,0x7B,0x48,0x55,0x7E,
+    0x7D,0x0D,0x0A,0x0D,0x0A,0x7E,0x7B,0x38,0x3D,0x3C,0x7E,0x4B,0x35,0x43,0x77,0x23,0x3A,0x7E,0x7D,0x0D,
+    0x0A,0x31,0x2E,0x20,0x7E,0x7B,0x3D,0x78,0x36,0x48,0x31,0x28,0x38,0x66,0x23,0x28,0x35,0x5A,0x36,0x7E,
+    0x3C,0x3E,0x36,0x48,0x23,0x29,0x7E,0x7D,0x0D,0x0A,0x32,0x2E,0x20,0x7E,0x7B,0x32,0x62,0x4A,0x54,0x3D,
+    0x61,0x39,0x7B,0x3B,0x63,0x57,0x5C,0x31,0x6D,0x7E,0x7D,0x0D,0x0A,0x33,0x2E,0x20,0x7E,0x7B,0x4F,0x42,
+    0x52,0x3B,0x3D,0x57,0x36,0x4E,0x35,0x44,0x50,0x68,0x47,0x73,0x4E,0x44,0x35,0x35,0x7E,0x7D,0x0D,0x0A,
+    0x7E,0x7B,0x4E,0x52,0x43,0x47,0x4F,0x23,0x4D,0x7B,0x4D,0x28,0x39,0x7D,0x55,0x62,0x34,0x4E,0x3B,0x61,
+    0x52,0x69,0x3D,0x78,0x52,0x3B,0x32,0x3D,0x43,0x77,0x48,0x37,0x38,0x77,0x32,0x3F,0x43,0x45,0x35,0x44,
+    0x37,0x56,0x39,0x24,0x23,0x2C,0x4C,0x61,0x38,0x5F,0x39,0x24,0x57,0x77,0x50,0x27,0x42,0x4A,0x23,0x2C,
+    0x31,0x23,0x56,0x24,0x32,0x7A,0x46,0x37,0x30,0x34,0x4A,0x31,0x38,0x5F,0x56,0x4A,0x41,0x3F,0x35,0x58,
+    0x4D,0x6A,0x33,0x49,0x21,0x23,0x7E,0x7D,0x0D,0x0A,0x53,0x75,0x62,0x6A,0x65,0x63,0x74,0x3A,0x20,0x7E,
+    0x7B,0x3B,0x61,0x52,0x69,0x4D,0x28,0x56,0x2A,0x7E,0x7D,0x20,0x28,0x4D,0x65,0x65,0x74,0x69,0x6E,0x67,
+    0x20,0x6E,0x6F,0x74,0x69,0x63,0x65,0x29,0x0D,0x0A,0x7E,0x7B,0x38,0x77,0x4E,0x3B,0x4D,0x2C,0x4A,0x42,
+    0x23,0x3A,0x7E,0x7D,0x0D,0x0A,0x7E,0x7B,0x31,0x3E,0x56,0x5C,0x4E,0x65,0x4F,0x42,0x4E,0x67,0x48,0x7D,
+    0x35,0x63,0x54,0x5A,0x36,0x7E,0x42,0x25,0x3B,0x61,0x52,0x69,0x4A,0x52,0x55,0x59,0x3F,0x2A,0x4F,0x6E,
+    0x44,0x3F,0x3D,0x78,0x36,0x48,0x3B,0x61,0x52,0x69,0x23,0x2C,0x47,0x6B,0x34,0x73,0x3C,0x52,0x57,0x3C,
+    0x4A,0x31,0x32,0x4E,0x3C,0x53,0x21,0x23,0x7E,0x7D,0x0D,0x0A,0x7E,0x7B,0x3B,0x61,0x52,0x69,0x44,0x5A,
+    0x48,0x5D,0x30,0x7C,0x40,0x28,0x23,0x3A,0x52,0x3B,0x21,0x22,0x49,0x4F,0x54,0x42,0x39,0x24,0x57,0x77,
+    0x57,0x5C,0x3D,0x61,0x23,0x3B,0x36,0x7E,0x21,0x22,0x31,0x3E,0x54,0x42,0x3F,0x2A,0x37,0x22,0x3C,0x46,
+    0x3B,0x2E,0x23,0x3B,0x48,0x7D,0x21,0x22,0x32,0x62,0x4A,0x54,0x53,0x6B,0x37,0x22,0x32,0x3C,0x30,0x32,
+    0x45,0x45,0x21,0x23,0x7E,0x7D,0x0D,0x0A,0x7E,0x7B,0x47,0x6B,0x38,0x77,0x50,0x21,0x57,0x69,0x38,0x3A,
+    0x54,0x70,0x48,0x4B,0x4C,0x61,0x47,0x30,0x57,0x3C,0x31,0x38,0x3A,0x43,0x4F,0x60,0x39,0x58,0x32,0x44,
+    0x41,0x4F,0x23,0x2C,0x32,0x22,0x53,0x5A,0x56,0x5C,0x4B,0x44,0x4F,0x42,0x4E,0x67,0x4E,0x65,0x35,0x63,
+    0x47,0x30,0x37,0x22,0x4B,0x4D,0x35,0x3D,0x4F,0x6E,0x44,0x3F,0x53,0x4A,0x4F,0x64,0x21,0x23,0x7E,0x7D,
+    0x0D,0x0A,0x7E,0x7B,0x48,0x67,0x53,0x50,0x4E,0x4A,0x4C,0x62,0x23,0x2C,0x47,0x6B,0x53,0x6B,0x30,0x6C,
+    0x39,0x2B,0x4A,0x52,0x41,0x2A,0x4F,0x35,0x23,0x2C,0x35,0x67,0x3B,0x30,0x23,0x3A,0x7E,0x7D,0x30,0x31,
+    0x30,0x2D,0x31,0x32,0x33,0x34,0x35,0x36,0x37,0x38,0x7E,0x7B,0x21,0x23,0x7E,0x7D,0x0D,0x0A,0x7E,0x7B,
+    0x50,0x3B,0x50,0x3B,0x23,0x21,0x7E,0x7D,0x0D,0x0A,0x7E,0x7B,0x4F,0x6E,0x44,0x3F,0x39,0x5C,0x40,0x6D,
+    0x30,0x6C,0x39,0x2B,0x4A,0x52,0x7E,0x7D,0x0D,0x0A,0x32,0x30,0x31,0x38,0x7E,0x7B,0x44,0x6A,0x7E,0x7D,
+    0x36,0x7E,0x7B,0x54,0x42,0x7E,0x7D,0x31,0x38,0x7E,0x7B,0x48,0x55,0x7E,0x7D,0x0D,0x0A,0x0D,0x0A,0x7E,
+    0x7B,0x38,0x3D,0x3C,0x7E,0x4B,0x35,0x43,0x77,0x23,0x3A,0x7E,0x7D,0x0D,0x0A,0x31,0x2E,0x20,0x7E,0x7B,
+    0x3D,0x78,0x36,0x48,0x31,0x28,0x38,0x66,0x23,0x28,0x35,0x5A,0x36,0x7E,0x3C,0x3E,0x36,0x48,0x23,0x29,
+    0x7E,0x7D,0x0D,0x0A,0x32,0x2E,0x20,0x7E,0x7B,0x32,0x62,0x4A,0x54,0x3D,0x61,0x39,0x7B,0x3B,0x63,0x57,
+    0x5C,0x31,0x6D,0x7E,0x7D,0x0D,0x0A,0x33,0x2E,0x20,0x7E,0x7B,0x4F,0x42,0x52,0x3B,0x3D,0x57,0x36,0x4E,
+    0x35,0x44,0x50,0x68,0x47,0x73,0x4E,0x44,0x35,0x35,0x7E,0x7D,0x0D,0x0A,0x7E,0x7B,0x4E,0x52,0x43,0x47,
+    0x4F,0x23,0x4D,0x7B,0x4D,0x28,0x39,0x7D,0x55,0x62,0x34,0x4E,0x3B,0x61,0x52,0x69,0x3D,0x78,0x52,0x3B,
+    0x32,0x3D,0x43,0x77,0x48,0x37,0x38,0x77,0x32,0x3F,0x43,0x45,0x35,0x44,0x37,0x56,0x39,0x24,0x23,0x2C,
+    0x4C,0x61,0x38,0x5F,0x39,0x24,0x57,0x77,0x50,0x27,0x42,0x4A,0x23,0x2C,0x31,0x23,0x56,0x24,0x32,0x7A,
+    0x46,0x37,0x30,0x34,0x4A,0x31,0x38,0x5F,0x56,0x4A,0x41,0x3F,0x35,0x58,0x4D,0x6A,0x33,0x49,0x21,0x23,
+    0x7E,0x7D,0x0D,0x0A
+};
 #endif
 
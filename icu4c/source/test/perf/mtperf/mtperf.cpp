@@ -0,0 +1,331 @@
+// © 2018 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+/*
+ *************************************************************************
+ *   file name:  mtperf.cpp
+ *   encoding:   UTF-8
+ *   tab size:   8 (not used)
+ *   indentation:4
+ *
+ *   Multithreaded scalability benchmark for ICU services.
+ *   Each test runs one common operation (service object creation plus a
+ *   little use of it) from a given number of threads at once.
+ *   Operations rotate through several locales or names so that the
+ *   shared caches and their locks are exercised, not just one entry.
+ *
+ *   At the end, the best throughput for each thread count is compared
+ *   with the single-thread throughput to report speedup and efficiency.
+ *   Efficiency far below 100% on an otherwise idle machine points to
+ *   lock contention.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <thread>
+#include "unicode/uperf.h"
+#include "unicode/brkiter.h"
+#include "unicode/coll.h"
+#include "unicode/datefmt.h"
+#include "unicode/numfmt.h"
+#include "unicode/translit.h"
+#include "unicode/tznames.h"
+#include "unicode/ucnv.h"
+#include "unicode/ures.h"
+#include "cmemory.h" // for UPRV_LENGTHOF
+#include "uoptions.h"
+#include "uresimp.h"
+
+static const char *const localeIDs[] = {
+    "en_US", "de_DE", "fr_FR", "ja_JP", "zh_Hans_CN", "ar_EG", "ru_RU", "hi_IN"
+};
+
+static const char *const charsetNames[] = {
+    "UTF-8", "ISO-8859-1", "windows-1252", "Shift_JIS", "GB18030", "Big5", "EUC-KR", "ibm-37"
+};
+
+static const Locale &getLocale(int32_t i) {
+    static const Locale locales[UPRV_LENGTHOF(localeIDs)] = {
+        Locale(localeIDs[0]), Locale(localeIDs[1]), Locale(localeIDs[2]), Locale(localeIDs[3]),
+        Locale(localeIDs[4]), Locale(localeIDs[5]), Locale(localeIDs[6]), Locale(localeIDs[7])
+    };
+    return locales[i % UPRV_LENGTHOF(locales)];
+}
+
+// Operations. Each one does one unit of work for rotation index i.
+// Objects are created per call; the threads share only ICU's internal caches
+// and registries (UnifiedCache, converter cache, resource bundle cache,
+// Transliterator registry, time zone names cache) and their locks.
+
+static void numberFormatOp(int32_t i, UErrorCode &status) {
+    LocalPointer<NumberFormat> fmt(NumberFormat::createInstance(getLocale(i), status));
+    if (U_SUCCESS(status)) {
+        UnicodeString result;
+        fmt->format(1234567.891, result);
+    }
+}
+
+static void dateFormatOp(int32_t i, UErrorCode &status) {
+    LocalPointer<DateFormat> fmt(
+        DateFormat::createDateTimeInstance(DateFormat::kMedium, DateFormat::kMedium, getLocale(i)));
+    if (fmt.isNull()) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    UnicodeString result;
+    fmt->format((UDate)1.5e12, result);
+}
+
+static void converterOp(int32_t i, UErrorCode &status) {
+    UConverter *cnv = ucnv_open(charsetNames[i % UPRV_LENGTHOF(charsetNames)], &status);
+    ucnv_close(cnv);
+}
+
+static void breakIteratorOp(int32_t i, UErrorCode &status) {
+    LocalPointer<BreakIterator> bi(BreakIterator::createWordInstance(getLocale(i), status));
+    if (U_SUCCESS(status)) {
+        bi->setText(UnicodeString(u"The quick brown fox jumps over the lazy dog."));
+        while (bi->next() != BreakIterator::DONE) {}
+    }
+}
+
+static void collatorOp(int32_t i, UErrorCode &status) {
+    LocalPointer<Collator> coll(Collator::createInstance(getLocale(i), status));
+    if (U_SUCCESS(status)) {
+        coll->compare(UnicodeString(u"résumé"), UnicodeString(u"resume"), status);
+    }
+}
+
+static void transliteratorOp(int32_t i, UErrorCode &status) {
+    static const char16_t *const ids[] = { u"Any-Latin", u"Latin-ASCII", u"Any-Upper", u"NFD; [:M:] Remove; NFC" };
+    LocalPointer<Transliterator> t(
+        Transliterator::createInstance(UnicodeString(ids[i % UPRV_LENGTHOF(ids)]), UTRANS_FORWARD, status));
+    if (U_SUCCESS(status)) {
+        UnicodeString s(u"Ελληνικά Русский résumé");
+        t->transliterate(s);
+    }
+}
+
+static void resourceBundleOp(int32_t i, UErrorCode &status) {
+    LocalUResourceBundlePointer rb(ures_open(NULL, localeIDs[i % UPRV_LENGTHOF(localeIDs)], &status));
+    LocalUResourceBundlePointer sub(
+        ures_getByKeyWithFallback(rb.getAlias(), "NumberElements/latn/symbols", NULL, &status));
+    int32_t length;
+    ures_getStringByKeyWithFallback(sub.getAlias(), "decimal", &length, &status);
+}
+
+static void timeZoneNamesOp(int32_t i, UErrorCode &status) {
+    static const char16_t *const zones[] = {
+        u"America/Los_Angeles", u"Europe/Berlin", u"Asia/Tokyo", u"Australia/Sydney"
+    };
+    LocalPointer<TimeZoneNames> tzn(TimeZoneNames::createInstance(getLocale(i), status));
+    if (U_SUCCESS(status)) {
+        UnicodeString name;
+        tzn->getDisplayName(UnicodeString(zones[i % UPRV_LENGTHOF(zones)]),
+                            UTZNM_LONG_STANDARD, (UDate)1.5e12, name);
+    }
+}
+
+typedef void OpFn(int32_t i, UErrorCode &status);
+
+struct Operation {
+    const char *name;
+    OpFn *fn;
+};
+
+static const Operation operations[] = {
+    { "NumberFormat", numberFormatOp },
+    { "DateFormat", dateFormatOp },
+    { "Converter", converterOp },
+    { "BreakIterator", breakIteratorOp },
+    { "Collator", collatorOp },
+    { "Transliterator", transliteratorOp },
+    { "ResourceBundle", resourceBundleOp },
+    { "TimeZoneNames", timeZoneNamesOp }
+};
+
+// Thread counts 1, 2, 4, ... up to and including the maximum.
+static const int32_t MAX_THREAD_COUNTS = 16;
+static int32_t threadCounts[MAX_THREAD_COUNTS];
+static int32_t numThreadCounts = 0;
+
+static char testNames[UPRV_LENGTHOF(operations) * MAX_THREAD_COUNTS][40];
+
+// Best observed throughput in operations per second, for the scaling summary.
+static double bestRates[UPRV_LENGTHOF(operations)][MAX_THREAD_COUNTS];
+
+// Command-line options specific to mtperf.
+// Options do not have abbreviations: Force readable command lines.
+// (Using U+0001 for abbreviation characters.)
+enum {
+    THREADS,
+    OPS,
+    MTPERF_OPTIONS_COUNT
+};
+
+static UOption options[MTPERF_OPTIONS_COUNT]={
+    UOPTION_DEF("threads",  '\x01', UOPT_REQUIRES_ARG),
+    UOPTION_DEF("ops",      '\x01', UOPT_REQUIRES_ARG)
+};
+
+static const char *const mtperf_usage =
+    "\t--threads   Maximum number of threads; tests run with 1, 2, 4, ... threads\n"
+    "\t            up to this number. [number of hardware threads]\n"
+    "\t--ops       Operations per thread per iteration. [100]\n";
+
+// Test object.
+class MTPerfTest : public UPerfTest {
+public:
+    MTPerfTest(int32_t argc, const char *argv[], UErrorCode &status)
+            : UPerfTest(argc, argv, options, UPRV_LENGTHOF(options), mtperf_usage, status) {
+        if (U_SUCCESS(status)) {
+            int32_t maxThreads;
+            if (options[THREADS].doesOccur) {
+                maxThreads = atoi(options[THREADS].value);
+            } else {
+                maxThreads = (int32_t)std::thread::hardware_concurrency();
+                if (maxThreads < 1) {
+                    maxThreads = 1;
+                }
+            }
+            if (maxThreads < 1 || maxThreads > 1024) {
+                fprintf(stderr, "error: thread count must be 1..1024\n");
+                status = U_ILLEGAL_ARGUMENT_ERROR;
+                return;
+            }
+            opsPerThread = atoi(options[OPS].value);
+            if (opsPerThread < 1) {
+                fprintf(stderr, "error: ops must be at least 1\n");
+                status = U_ILLEGAL_ARGUMENT_ERROR;
+                return;
+            }
+            for (int32_t n = 1;; n *= 2) {
+                if (n >= maxThreads || numThreadCounts == MAX_THREAD_COUNTS - 1) {
+                    threadCounts[numThreadCounts++] = maxThreads;
+                    break;
+                }
+                threadCounts[numThreadCounts++] = n;
+            }
+        }
+    }
+
+    virtual UPerfFunction* runIndexedTest(int32_t index, UBool exec, const char* &name, char* par = NULL);
+
+    void printScaling() const;
+
+    int32_t opsPerThread;
+};
+
+// Runs one operation from a number of threads at once.
+// Thread creation is included in the time but amortized over opsPerThread operations.
+class ThreadedOperation : public UPerfFunction {
+public:
+    ThreadedOperation(int32_t opIndex, int32_t countIndex, int32_t opsPerThread)
+            : opIndex(opIndex), countIndex(countIndex),
+              numThreads(threadCounts[countIndex]), opsPerThread(opsPerThread) {}
+
+    virtual void call(UErrorCode* pErrorCode) {
+        OpFn *fn = operations[opIndex].fn;
+        int32_t ops = opsPerThread;
+        UErrorCode *errors = new UErrorCode[numThreads];
+        std::thread *threads = new std::thread[numThreads];
+        for (int32_t t = 0; t < numThreads; ++t) {
+            errors[t] = U_ZERO_ERROR;
+            UErrorCode *pThreadError = errors + t;
+            threads[t] = std::thread([fn, ops, t, pThreadError]() {
+                // Start each thread at a different locale/name.
+                for (int32_t i = 0; i < ops && U_SUCCESS(*pThreadError); ++i) {
+                    fn(t + i, *pThreadError);
+                }
+            });
+        }
+        for (int32_t t = 0; t < numThreads; ++t) {
+            threads[t].join();
+            if (U_FAILURE(errors[t]) && U_SUCCESS(*pErrorCode)) {
+                *pErrorCode = errors[t];
+            }
+        }
+        delete[] threads;
+        delete[] errors;
+    }
+
+    virtual long getOperationsPerIteration() {
+        return (long)numThreads * opsPerThread;
+    }
+
+    virtual double time(int32_t n, UErrorCode* status) {
+        double t = UPerfFunction::time(n, status);
+        if (U_SUCCESS(*status) && t > 0) {
+            double rate = ((double)n * getOperationsPerIteration()) / t;
+            if (rate > bestRates[opIndex][countIndex]) {
+                bestRates[opIndex][countIndex] = rate;
+            }
+        }
+        return t;
+    }
+
+private:
+    int32_t opIndex;
+    int32_t countIndex;
+    int32_t numThreads;
+    int32_t opsPerThread;
+};
+
+UPerfFunction* MTPerfTest::runIndexedTest(int32_t index, UBool exec, const char* &name, char* /*par*/) {
+    if (index < 0 || index >= UPRV_LENGTHOF(operations) * numThreadCounts) {
+        name = "";
+        return NULL;
+    }
+    int32_t opIndex = index / numThreadCounts;
+    int32_t countIndex = index % numThreadCounts;
+    char *testName = testNames[index];
+    if (testName[0] == 0) {
+        sprintf(testName, "%s_%dT", operations[opIndex].name, (int)threadCounts[countIndex]);
+    }
+    name = testName;
+    if (exec) {
+        return new ThreadedOperation(opIndex, countIndex, opsPerThread);
+    }
+    return NULL;
+}
+
+void MTPerfTest::printScaling() const {
+    for (int32_t op = 0; op < UPRV_LENGTHOF(operations); ++op) {
+        double base = bestRates[op][0];
+        if (base <= 0) {
+            continue;  // Single-thread test did not run.
+        }
+        for (int32_t c = 0; c < numThreadCounts; ++c) {
+            double rate = bestRates[op][c];
+            if (rate <= 0) {
+                continue;
+            }
+            double speedup = rate / base;
+            fprintf(stdout, "*= %s threads: %d ops/s: %.4g speedup: %.3g efficiency: %.1f%%\n",
+                    operations[op].name, (int)threadCounts[c], rate, speedup,
+                    100.0 * speedup / threadCounts[c]);
+        }
+    }
+}
+
+int main(int argc, const char *argv[])
+{
+    // Default values for command-line options.
+    options[OPS].value = "100";
+
+    UErrorCode status = U_ZERO_ERROR;
+    MTPerfTest test(argc, argv, status);
+
+    if (U_FAILURE(status)){
+        printf("The error is %s\n", u_errorName(status));
+        test.usage();
+        return status;
+    }
+
+    if (test.run() == FALSE){
+        fprintf(stderr, "FAILED: Tests could not be run please check the "
+                        "arguments.\n");
+        return -1;
+    }
+    test.printScaling();
+    return 0;
+}
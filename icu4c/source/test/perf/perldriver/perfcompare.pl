@@ -0,0 +1,83 @@
+#!/usr/bin/perl
+#  ***********************************************************************
+#  * Copyright (C) 2018 and later: Unicode, Inc. and others.
+#  * License & terms of use: http://www.unicode.org/copyright.html#License
+#  ***********************************************************************
+
+# Compares two result files written by a UPerfTest-based test with --json or --csv.
+#
+# Usage: perfcompare.pl [--threshold percent] baseline-file new-file
+#
+# Tests are matched by suite and name, and compared by the median ns/op.
+# A test is reported as slower or faster only if the change exceeds the threshold
+# (default 5%) and the pass time ranges do not overlap
+# (new min > baseline p90 or new p90 < baseline min).
+# The exit code is 1 if any test got slower, so that this can gate regressions.
+
+use strict;
+use Getopt::Long;
+
+my $threshold = 5;
+GetOptions("threshold=f" => \$threshold)
+    or die "usage: $0 [--threshold percent] baseline-file new-file\n";
+die "usage: $0 [--threshold percent] baseline-file new-file\n" if @ARGV != 2;
+
+# Returns a hash of "suite/name" -> hash of result fields.
+sub readResults {
+    my ($file) = @_;
+    open(my $fh, "<", $file) or die "can't open $file: $!\n";
+    local $/;
+    my $content = <$fh>;
+    close($fh);
+    my %results;
+    if ($content =~ /^\s*\{/) {
+        require JSON::PP;
+        my $data = JSON::PP::decode_json($content);
+        foreach my $test (@{$data->{tests}}) {
+            $results{"$data->{suite}/$test->{name}"} = $test;
+        }
+    } else {
+        my @lines = split(/\r?\n/, $content);
+        my @header = split(/,/, shift(@lines));
+        foreach my $line (@lines) {
+            next if $line eq "";
+            my @values = split(/,/, $line, -1);
+            my %test;
+            @test{@header} = @values;
+            $results{"$test{suite}/$test{test}"} = \%test;
+        }
+    }
+    return \%results;
+}
+
+my $baseline = readResults($ARGV[0]);
+my $current = readResults($ARGV[1]);
+my $slower = 0;
+
+printf("%-48s %12s %12s %9s  %s\n", "test", "base ns/op", "new ns/op", "change", "verdict");
+foreach my $key (sort keys %$baseline) {
+    my $b = $baseline->{$key};
+    my $c = $current->{$key};
+    if (!defined($c)) {
+        printf("%-48s %12.4g %12s %9s  %s\n", $key, $b->{nsPerOp}, "-", "-", "missing");
+        next;
+    }
+    my $change = ($c->{nsPerOp} - $b->{nsPerOp}) * 100 / $b->{nsPerOp};
+    # Compare pass times per operation so that runs with different loop counts match.
+    my $bScale = 1 / ($b->{loops} * $b->{operations});
+    my $cScale = 1 / ($c->{loops} * $c->{operations});
+    my $verdict = "~";
+    if ($change > $threshold && $c->{min} * $cScale > $b->{p90} * $bScale) {
+        $verdict = "SLOWER";
+        ++$slower;
+    } elsif ($change < -$threshold && $c->{p90} * $cScale < $b->{min} * $bScale) {
+        $verdict = "faster";
+    }
+    printf("%-48s %12.4g %12.4g %+8.1f%%  %s\n", $key, $b->{nsPerOp}, $c->{nsPerOp}, $change, $verdict);
+}
+foreach my $key (sort keys %$current) {
+    if (!defined($baseline->{$key})) {
+        printf("%-48s %12s %12.4g %9s  %s\n", $key, "-", $current->{$key}->{nsPerOp}, "-", "new");
+    }
+}
+exit($slower > 0 ? 1 : 0);
@@ -160,6 +160,16 @@ UPerfFunction* BreakIteratorPerformanceTest::TestICUIsBound()
   return new ICUIsBound(locale, m_mode_, m_file_, m_fileLen_);
 }
 
+UPerfFunction* BreakIteratorPerformanceTest::TestICUCreate()
+{
+  return new ICUCreate(locale, m_mode_, m_file_, m_fileLen_);
+}
+
+UPerfFunction* BreakIteratorPerformanceTest::TestICUClone()
+{
+  return new ICUClone(locale, m_mode_, m_file_, m_fileLen_);
+}
+
 UPerfFunction* BreakIteratorPerformanceTest::TestDarwinForward()
 {
   return NULL;
@@ -179,6 +189,8 @@ UPerfFunction* BreakIteratorPerformanceTest::runIndexedTest(int32_t index, UBool
 		TESTCASE(1, TestICUIsBound);
 		TESTCASE(2, TestDarwinForward);
 		TESTCASE(3, TestDarwinIsBound);
+		TESTCASE(4, TestICUCreate);
+		TESTCASE(5, TestICUClone);
         default: 
             name = ""; 
             return NULL;
@@ -190,17 +202,18 @@ UOption options[]={
                       UOPTION_DEF( "mode",        'm', UOPT_REQUIRES_ARG)
                   };
 
+static const char ubrkperf_usage[] =
+    "\t-m or --mode        Required mode for breakiterator: char, word, line or sentence\n";
+
 
+// The mode option is parsed together with the common UPerfTest options;
+// u_parseArgs() rejects options that it does not know.
 BreakIteratorPerformanceTest::BreakIteratorPerformanceTest(int32_t argc, const char* argv[], UErrorCode& status)
-: UPerfTest(argc,argv,status),
+: UPerfTest(argc,argv,options,UPRV_LENGTHOF(options),ubrkperf_usage,status),
 m_mode_(NULL),
 m_file_(NULL),
 m_fileLen_(0)
 {
-
-    _remainingArgc = u_parseArgs(_remainingArgc, (char**)argv, UPRV_LENGTHOF(options), options);
-
-
     if(options[0].doesOccur) {
       m_mode_ = options[0].value;
       switch(options[0].value[0]) {
@@ -221,7 +234,7 @@ m_fileLen_(0)
 
     if(status== U_ILLEGAL_ARGUMENT_ERROR){
        fprintf(stderr, gUsageString, "ubrkperf");
-       fprintf(stderr, "\t-m or --mode        Required mode for breakiterator: char, word, line or sentence\n");
+       fputs(ubrkperf_usage, stderr);
 
        return;
     }
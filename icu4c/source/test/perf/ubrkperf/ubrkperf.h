@@ -16,6 +16,23 @@
 
 #include <unicode/brkiter.h>
 
+static BreakIterator *createBreakIterator(const char *locale, const char *mode, UErrorCode &status) {
+  switch(mode[0]) {
+  case 'c' :
+    return BreakIterator::createCharacterInstance(locale, status);
+  case 'w' :
+    return BreakIterator::createWordInstance(locale, status);
+  case 'l' :
+    return BreakIterator::createLineInstance(locale, status);
+  case 's' :
+    return BreakIterator::createSentenceInstance(locale, status);
+  default:
+    // should not happen as we already check for this in the caller
+    status = U_ILLEGAL_ARGUMENT_ERROR;
+    return NULL;
+  }
+}
+
 class ICUBreakFunction : public UPerfFunction {
 protected:
   BreakIterator *m_brkIt_;
@@ -31,24 +48,7 @@ public:
       m_noBreaks_(-1),
       m_status_(U_ZERO_ERROR)
   {
-    switch(mode[0]) {
-    case 'c' :
-      m_brkIt_ = BreakIterator::createCharacterInstance(locale, m_status_);
-      break;
-    case 'w' : 
-      m_brkIt_ = BreakIterator::createWordInstance(locale, m_status_);
-      break;
-    case 'l' :
-      m_brkIt_ = BreakIterator::createLineInstance(locale, m_status_);
-      break;
-    case 's' :
-      m_brkIt_ = BreakIterator::createSentenceInstance(locale, m_status_);
-      break;
-    default:
-      // should not happen as we already check for this in the caller
-      m_status_ = U_ILLEGAL_ARGUMENT_ERROR;
-      break;
-    }
+    m_brkIt_ = createBreakIterator(locale, mode, m_status_);
   }
 
   ~ICUBreakFunction() {  delete m_brkIt_; }
@@ -107,6 +107,56 @@ public:
   }
 };
 
+// Per-request use: create an iterator, find the breaks in a short text, delete it.
+// The text is the start of the test file.
+class ICUCreate : public ICUBreakFunction {
+protected:
+  const char *m_locale_;
+  const char *m_mode_;
+public:
+  enum { kTextLength = 64, kCount = 100 };
+  ICUCreate(const char *locale, const char *mode, const UChar *file, int32_t file_len) :
+      ICUBreakFunction(locale, mode, file, file_len < kTextLength ? file_len : kTextLength),
+      m_locale_(locale),
+      m_mode_(mode)
+  {
+    m_noBreaks_ = 0;
+  }
+  virtual BreakIterator *create(UErrorCode &status) {
+    return createBreakIterator(m_locale_, m_mode_, status);
+  }
+  virtual void call(UErrorCode *status)
+  {
+    UnicodeString text(FALSE, m_file_, m_fileLen_);
+    m_noBreaks_ = 0;
+    for(int32_t i = 0; i < kCount && U_SUCCESS(*status); i++) {
+      BreakIterator *bi = create(*status);
+      if(U_SUCCESS(*status)) {
+        bi->setText(text);
+        while(bi->next() != BreakIterator::DONE) {
+          m_noBreaks_++;
+        }
+      }
+      delete bi;
+    }
+  }
+  virtual long getOperationsPerIteration() { return kCount; }
+};
+
+// Like ICUCreate, but clones one iterator instead of creating new ones.
+class ICUClone : public ICUCreate {
+public:
+  ICUClone(const char *locale, const char *mode, const UChar *file, int32_t file_len) :
+      ICUCreate(locale, mode, file, file_len) {}
+  virtual BreakIterator *create(UErrorCode &status) {
+    BreakIterator *bi = m_brkIt_->clone();
+    if(bi == NULL) {
+      status = U_MEMORY_ALLOCATION_ERROR;
+    }
+    return bi;
+  }
+};
+
 class DarwinBreakFunction : public UPerfFunction {
 public:
   virtual void call(UErrorCode *status) {};
@@ -127,6 +177,8 @@ public:
 
   UPerfFunction* TestICUForward();
   UPerfFunction* TestICUIsBound();
+  UPerfFunction* TestICUCreate();
+  UPerfFunction* TestICUClone();
 
   UPerfFunction* TestDarwinForward();
   UPerfFunction* TestDarwinIsBound();
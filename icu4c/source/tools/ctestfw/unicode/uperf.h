@@ -111,6 +111,15 @@ public:
     virtual long getEventsPerIteration(){
         return -1;
     }
+    /**
+     * Subclasses that process a byte stream (e.g., charset conversion)
+     * may override this method to return the number of input bytes
+     * in a single call to this object's call() method.
+     * When positive, the verbose summary also reports throughput in MB/s.
+     */
+    virtual long getBytesPerIteration(){
+        return -1;
+    }
     /**
      * Call call() n times in a tight loop and return the elapsed
      * milliseconds.  If n is small and call() is fast the return
@@ -130,6 +139,22 @@ public:
 };
 
 
+/**
+ * Statistics for one test, collected over all timed passes.
+ * Times are in seconds per pass of loops iterations.
+ * Counters are per operation, or negative if not collected.
+ */
+struct UPerfResult {
+    const char *name;
+    int32_t passes;
+    int32_t loops;
+    long ops;
+    long events;
+    long bytes;
+    double min, median, mean, max, stddev, p90, p95;
+    double counters[4];  // cycles, instructions, cache misses, branch misses
+};
+
 class T_CTEST_EXPORT_API UPerfTest {
 public:
     UBool run();
@@ -164,6 +189,9 @@ protected:
 
     virtual UBool callTest( UPerfTest& testToBeCalled, char* par );
 
+    // Appends one test's results to the --json and --csv files, if any.
+    void writeResult(const UPerfResult &result);
+
     int32_t      _argc;
     const char** _argv;
     const char * _addUsage;
@@ -185,7 +213,13 @@ protected:
     int32_t      iterations;
     int32_t      time;
     const char*  locale;
+    int32_t      warmup;
+    UBool        useCounters;
 private:
+    FILE*        jsonFile;
+    FILE*        csvFile;
+    int32_t      resultCount;
+    const char*  suiteName;
     UPerfTest*   caller;
     char*        path;           // specifies subtests
 
@@ -13,9 +13,26 @@
 #include "unicode/uperf.h"
 #include "uoptions.h"
 #include "cmemory.h"
+#include "cstring.h"
+#include "uarrsort.h"
+#include <math.h>
 #include <stdio.h>
 #include <stdlib.h>
 
+// Linux-only CPU pinning and hardware counters.
+// g++ and clang++ on glibc define _GNU_SOURCE, which exposes sched_setaffinity() and syscall().
+#if U_PLATFORM == U_PF_LINUX && defined(_GNU_SOURCE)
+#   define UPERF_HAVE_LINUX_PERF 1
+#   include <sched.h>
+#   include <string.h>
+#   include <unistd.h>
+#   include <sys/ioctl.h>
+#   include <sys/syscall.h>
+#   include <linux/perf_event.h>
+#else
+#   define UPERF_HAVE_LINUX_PERF 0
+#endif
+
 #if !UCONFIG_NO_CONVERSION
 
 UPerfFunction::~UPerfFunction() {}
@@ -43,7 +60,13 @@ const char UPerfTest::gUsageString[] =
     "\t-l or --line-mode    The data file should be processed in line mode\n"
     "\t-b or --bulk-mode    The data file should be processed in file based.\n"
     "\t                     Cannot be used with --line-mode\n"
-    "\t-L or --locale       Locale for the test\n";
+    "\t-L or --locale       Locale for the test\n"
+    "\t--warmup             Number of untimed passes before the timed passes. [0]\n"
+    "\t--json               Write the results to this file in JSON format\n"
+    "\t--csv                Write the results to this file in CSV format\n"
+    "\t--cpu                Pin the test to this CPU number (Linux only)\n"
+    "\t--counters           Collect hardware counters via perf_event_open (Linux only)\n"
+    "\t                     Use -p with several passes for meaningful percentiles.\n";
 
 enum
 {
@@ -60,6 +83,11 @@ enum
     LINE_MODE,
     BULK_MODE,
     LOCALE,
+    WARMUP,
+    JSON_FILE,
+    CSV_FILE,
+    CPU,
+    COUNTERS,
     OPTIONS_COUNT
 };
 
@@ -77,9 +105,136 @@ static UOption options[OPTIONS_COUNT+20]={
     UOPTION_DEF( "time",          't', UOPT_REQUIRES_ARG),
     UOPTION_DEF( "line-mode",     'l', UOPT_NO_ARG),
     UOPTION_DEF( "bulk-mode",     'b', UOPT_NO_ARG),
-    UOPTION_DEF( "locale",        'L', UOPT_REQUIRES_ARG)
+    UOPTION_DEF( "locale",        'L', UOPT_REQUIRES_ARG),
+    UOPTION_DEF( "warmup",        '\x01', UOPT_REQUIRES_ARG),
+    UOPTION_DEF( "json",          '\x01', UOPT_REQUIRES_ARG),
+    UOPTION_DEF( "csv",           '\x01', UOPT_REQUIRES_ARG),
+    UOPTION_DEF( "cpu",           '\x01', UOPT_REQUIRES_ARG),
+    UOPTION_DEF( "counters",      '\x01', UOPT_NO_ARG)
+};
+
+// Hardware counters collected with --counters.
+enum {
+    COUNTER_CYCLES,
+    COUNTER_INSTRUCTIONS,
+    COUNTER_CACHE_MISSES,
+    COUNTER_BRANCH_MISSES,
+    COUNTER_COUNT
+};
+
+static const char *const counterNames[COUNTER_COUNT] = {
+    "cycles", "instructions", "cacheMisses", "branchMisses"
 };
 
+static void closeCounters(int fds[]) {
+    for (int32_t i = 0; i < COUNTER_COUNT; ++i) {
+#if UPERF_HAVE_LINUX_PERF
+        if (fds[i] >= 0) {
+            close(fds[i]);
+        }
+#endif
+        fds[i] = -1;
+    }
+}
+
+// Opens the counters for the calling thread, each one independently
+// so that a counter not supported by the CPU or VM does not disable the others.
+// Returns FALSE if none could be opened (no kernel support, or not permitted).
+static UBool openCounters(int fds[]) {
+    UBool any = FALSE;
+#if UPERF_HAVE_LINUX_PERF
+    static const uint64_t configs[COUNTER_COUNT] = {
+        PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+        PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES
+    };
+    for (int32_t i = 0; i < COUNTER_COUNT; ++i) {
+        struct perf_event_attr attr;
+        memset(&attr, 0, sizeof(attr));
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.size = sizeof(attr);
+        attr.config = configs[i];
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        fds[i] = (int)syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+        if (fds[i] >= 0) {
+            any = TRUE;
+        }
+    }
+#else
+    closeCounters(fds);
+#endif
+    return any;
+}
+
+static void startCounters(int fds[]) {
+#if UPERF_HAVE_LINUX_PERF
+    for (int32_t i = 0; i < COUNTER_COUNT; ++i) {
+        if (fds[i] >= 0) {
+            ioctl(fds[i], PERF_EVENT_IOC_RESET, 0);
+            ioctl(fds[i], PERF_EVENT_IOC_ENABLE, 0);
+        }
+    }
+#else
+    (void)fds;
+#endif
+}
+
+// Stops the counters and adds their values to sums[]; -1 marks an unavailable counter.
+static void stopCounters(int fds[], double sums[]) {
+    for (int32_t i = 0; i < COUNTER_COUNT; ++i) {
+#if UPERF_HAVE_LINUX_PERF
+        uint64_t value;
+        if (fds[i] >= 0) {
+            ioctl(fds[i], PERF_EVENT_IOC_DISABLE, 0);
+            if (read(fds[i], &value, sizeof(value)) == (ssize_t)sizeof(value)) {
+                if (sums[i] < 0) {
+                    sums[i] = 0;
+                }
+                sums[i] += (double)value;
+            }
+        }
+#else
+        (void)fds;
+        (void)sums;
+#endif
+    }
+}
+
+static int32_t U_CALLCONV compareDoubles(const void * /*context*/, const void *left, const void *right) {
+    double l = *(const double *)left, r = *(const double *)right;
+    return l < r ? -1 : (l > r ? 1 : 0);
+}
+
+// Percentile of sorted values, linearly interpolated between the closest ranks.
+static double percentile(const double sorted[], int32_t count, double p) {
+    if (count <= 0) {
+        return 0.0;
+    }
+    double rank = p * (count - 1);
+    int32_t lower = (int32_t)rank;
+    if (lower >= count - 1) {
+        return sorted[count - 1];
+    }
+    return sorted[lower] + (rank - lower) * (sorted[lower + 1] - sorted[lower]);
+}
+
+// Writes s as a JSON string literal.
+static void writeJSONString(FILE *f, const char *s) {
+    fputc('"', f);
+    for (; *s != 0; ++s) {
+        if (*s == '"' || *s == '\\') {
+            fputc('\\', f);
+            fputc(*s, f);
+        } else if ((uint8_t)*s < 0x20) {
+            fprintf(f, "\\u%04x", (int)(uint8_t)*s);
+        } else {
+            fputc(*s, f);
+        }
+    }
+    fputc('"', f);
+}
+
 UPerfTest::UPerfTest(int32_t argc, const char* argv[], UErrorCode& status)
         : _argc(argc), _argv(argv), _addUsage(NULL),
           ucharBuf(NULL), encoding(""),
@@ -115,6 +270,12 @@ void UPerfTest::init(UOption addOptions[], int32_t addOptionsCount,
     U_MAIN_INIT_ARGS(_argc, _argv);
 
     resolvedFileName = NULL;
+    warmup = 0;
+    jsonFile = NULL;
+    csvFile = NULL;
+    resultCount = 0;
+    suiteName = "";
+    useCounters = FALSE;
 
     // add specific options
     int32_t optionsCount = OPTIONS_COUNT;
@@ -186,6 +347,62 @@ void UPerfTest::init(UOption addOptions[], int32_t addOptionsCount,
         locale = options[LOCALE].value;
     }
 
+    if(options[WARMUP].doesOccur) {
+        warmup = atoi(options[WARMUP].value);
+    }
+
+    if(options[CPU].doesOccur) {
+#if UPERF_HAVE_LINUX_PERF
+        cpu_set_t cpus;
+        CPU_ZERO(&cpus);
+        CPU_SET(atoi(options[CPU].value), &cpus);
+        if(sched_setaffinity(0, sizeof(cpus), &cpus) != 0) {
+            fprintf(stderr, "Unable to pin the test to CPU %s\n", options[CPU].value);
+        }
+#else
+        fprintf(stderr, "--cpu is not supported on this platform\n");
+#endif
+    }
+
+    if(options[COUNTERS].doesOccur) {
+#if UPERF_HAVE_LINUX_PERF
+        useCounters = TRUE;
+#else
+        fprintf(stderr, "--counters is not supported on this platform\n");
+#endif
+    }
+
+    // Results files are written incrementally; the destructor closes the JSON array.
+    const char *suite = uprv_strrchr(_argv[0], '/');
+    suite = suite != NULL ? suite + 1 : _argv[0];
+    if(options[JSON_FILE].doesOccur) {
+        jsonFile = fopen(options[JSON_FILE].value, "w");
+        if(jsonFile == NULL) {
+            fprintf(stderr, "Unable to open %s\n", options[JSON_FILE].value);
+            status = U_FILE_ACCESS_ERROR;
+            return;
+        }
+        fprintf(jsonFile, "{\n  \"suite\": ");
+        writeJSONString(jsonFile, suite);
+        fprintf(jsonFile, ",\n  \"icuVersion\": \"%s\",\n  \"passes\": %d,\n  \"warmup\": %d,\n  \"tests\": [",
+                U_ICU_VERSION, (int)passes, (int)warmup);
+    }
+    if(options[CSV_FILE].doesOccur) {
+        csvFile = fopen(options[CSV_FILE].value, "w");
+        if(csvFile == NULL) {
+            fprintf(stderr, "Unable to open %s\n", options[CSV_FILE].value);
+            status = U_FILE_ACCESS_ERROR;
+            return;
+        }
+        fprintf(csvFile, "suite,test,icuVersion,passes,loops,operations,events,bytes,"
+                         "min,median,mean,max,stddev,p90,p95,nsPerOp,mbPerSec");
+        for(int32_t i = 0; i < COUNTER_COUNT; ++i) {
+            fprintf(csvFile, ",%sPerOp", counterNames[i]);
+        }
+        fputc('\n', csvFile);
+    }
+    suiteName = suite;
+
     int32_t len = 0;
     if(fileName!=NULL){
         //pre-flight
@@ -410,8 +627,31 @@ UBool UPerfTest::runTestLoop( char* testname, char* par )
 
             double min_t=1000000.0, sum_t=0.0;
             long events = -1;
+            long bytes = testFunction->getBytesPerIteration();
+
+            for(int32_t w = 0; w < warmup && U_SUCCESS(status); ++w) {
+                testFunction->time(loops, &status);
+            }
+
+            // Per-pass times for the median, percentiles and standard deviation.
+            double *times = (double *)uprv_malloc((passes > 0 ? passes : 1) * sizeof(double));
+            if(times == NULL) {
+                delete testFunction;
+                return FALSE;
+            }
+            int32_t completed = 0;
+            int counterFDs[COUNTER_COUNT];
+            double counterSums[COUNTER_COUNT];
+            for(int32_t i = 0; i < COUNTER_COUNT; ++i) {
+                counterFDs[i] = -1;
+                counterSums[i] = -1;
+            }
+            if(useCounters && !openCounters(counterFDs)) {
+                fprintf(stderr, "Hardware counters are not available (perf_event_open failed)\n");
+                useCounters = FALSE;
+            }
 
-            for(int32_t ps =0; ps < passes; ps++){
+            for(int32_t ps =0; ps < passes && U_SUCCESS(status); ps++){
                 fprintf(stdout,"= %s begin " ,name);
                 if(verbose==TRUE){
                     if(iterations > 0) {
@@ -422,11 +662,14 @@ UBool UPerfTest::runTestLoop( char* testname, char* par )
                 } else {
                     fprintf(stdout, "\n");
                 }
+                startCounters(counterFDs);
                 t = testFunction->time(loops, &status);
+                stopCounters(counterFDs, counterSums);
                 if(U_FAILURE(status)){
                     printf("Performance test failed with error: %s \n", u_errorName(status));
                     break;
                 }
+                times[completed++] = t;
                 sum_t+=t;
                 if(t<min_t) {
                     min_t=t;
@@ -464,7 +707,49 @@ UBool UPerfTest::runTestLoop( char* testname, char* par )
                     fprintf(stdout, "_= %s min: %.4g loops: %i min/op: %.4g ns min/event: %.4g ns\n",
                             name, min_t, (int)loops, (min_t*1E9)/(loops*ops), (min_t*1E9)/(loops*events));
                 }
+                if (bytes > 0 && min_t > 0) {
+                    fprintf(stdout, "#= %s bytes: %li avg: %.4g MB/s max: %.4g MB/s\n",
+                            name, bytes, ((double)bytes*loops)/(avg_t*1E6), ((double)bytes*loops)/(min_t*1E6));
+                }
+            }
+            closeCounters(counterFDs);
+            if(completed > 0 && loops > 0) {
+                UPerfResult result;
+                result.name = name;
+                result.passes = completed;
+                result.loops = loops;
+                result.ops = ops;
+                result.events = events;
+                result.bytes = bytes;
+                uprv_sortArray(times, completed, (int32_t)sizeof(double), compareDoubles, NULL, FALSE, &status);
+                result.min = times[0];
+                result.max = times[completed - 1];
+                result.mean = sum_t / completed;
+                double sumSquares = 0.0;
+                for(int32_t i = 0; i < completed; ++i) {
+                    sumSquares += (times[i] - result.mean) * (times[i] - result.mean);
+                }
+                result.stddev = completed > 1 ? sqrt(sumSquares / (completed - 1)) : 0.0;
+                result.median = percentile(times, completed, 0.5);
+                result.p90 = percentile(times, completed, 0.9);
+                result.p95 = percentile(times, completed, 0.95);
+                for(int32_t i = 0; i < COUNTER_COUNT; ++i) {
+                    result.counters[i] = counterSums[i] < 0 ? -1 :
+                        counterSums[i] / ((double)completed * loops * ops);
+                }
+                if(verbose) {
+                    fprintf(stdout, "^= %s median: %.4g p90: %.4g p95: %.4g stddev: %.4g passes: %i median/op: %.4g ns\n",
+                            name, result.median, result.p90, result.p95, result.stddev, (int)completed,
+                            (result.median*1E9)/(loops*ops));
+                    for(int32_t i = 0; i < COUNTER_COUNT; ++i) {
+                        if(result.counters[i] >= 0) {
+                            fprintf(stdout, "$= %s %s/op: %.4g\n", name, counterNames[i], result.counters[i]);
+                        }
+                    }
+                }
+                writeResult(result);
             }
+            uprv_free(times);
             delete testFunction;
         }
         index++;
@@ -474,6 +759,55 @@ UBool UPerfTest::runTestLoop( char* testname, char* par )
     return rval;
 }
 
+void UPerfTest::writeResult(const UPerfResult &result) {
+    double nsPerOp = (result.median*1E9)/((double)result.loops*result.ops);
+    double mbPerSec = result.bytes > 0 && result.median > 0 ?
+        ((double)result.bytes*result.loops)/(result.median*1E6) : -1;
+    if(jsonFile != NULL) {
+        fprintf(jsonFile, "%s\n    {\"name\": ", resultCount > 0 ? "," : "");
+        writeJSONString(jsonFile, result.name);
+        fprintf(jsonFile, ", \"passes\": %d, \"loops\": %d, \"operations\": %ld, \"events\": %ld, \"bytes\": %ld,"
+                          " \"min\": %.9g, \"median\": %.9g, \"mean\": %.9g, \"max\": %.9g, \"stddev\": %.9g,"
+                          " \"p90\": %.9g, \"p95\": %.9g, \"nsPerOp\": %.9g",
+                (int)result.passes, (int)result.loops, result.ops, result.events, result.bytes,
+                result.min, result.median, result.mean, result.max, result.stddev,
+                result.p90, result.p95, nsPerOp);
+        if(mbPerSec >= 0) {
+            fprintf(jsonFile, ", \"mbPerSec\": %.9g", mbPerSec);
+        }
+        UBool first = TRUE;
+        for(int32_t i = 0; i < COUNTER_COUNT; ++i) {
+            if(result.counters[i] >= 0) {
+                fprintf(jsonFile, "%s\"%s\": %.9g", first ? ", \"perOp\": {" : ", ",
+                        counterNames[i], result.counters[i]);
+                first = FALSE;
+            }
+        }
+        fprintf(jsonFile, "%s}", first ? "" : "}");
+        fflush(jsonFile);
+    }
+    if(csvFile != NULL) {
+        // Test names do not contain commas or quotes.
+        fprintf(csvFile, "%s,%s,%s,%d,%d,%ld,%ld,%ld,%.9g,%.9g,%.9g,%.9g,%.9g,%.9g,%.9g,%.9g,",
+                suiteName, result.name, U_ICU_VERSION,
+                (int)result.passes, (int)result.loops, result.ops, result.events, result.bytes,
+                result.min, result.median, result.mean, result.max, result.stddev,
+                result.p90, result.p95, nsPerOp);
+        if(mbPerSec >= 0) {
+            fprintf(csvFile, "%.9g", mbPerSec);
+        }
+        for(int32_t i = 0; i < COUNTER_COUNT; ++i) {
+            fputc(',', csvFile);
+            if(result.counters[i] >= 0) {
+                fprintf(csvFile, "%.9g", result.counters[i]);
+            }
+        }
+        fputc('\n', csvFile);
+        fflush(csvFile);
+    }
+    ++resultCount;
+}
+
 /**
 * Print a usage message for this test class.
 */
@@ -530,6 +864,13 @@ UPerfTest::~UPerfTest(){
         uprv_free(resolvedFileName);
     }
     ucbuf_close(ucharBuf);
+    if(jsonFile!=NULL){
+        fprintf(jsonFile, "\n  ]\n}\n");
+        fclose(jsonFile);
+    }
+    if(csvFile!=NULL){
+        fclose(csvFile);
+    }
 }
 
 #endif